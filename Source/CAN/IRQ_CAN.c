@@ -14,6 +14,7 @@
  *----------------------------------------------------------------------------*/
 
 #include "CAN.h"                      /* LPC17xx CAN adaption layer */
+#include "../main/cpu_profiler.h"
 
 
 extern uint8_t icr ; 				//icr and result must be global in order to work with both real and simulated landtiger.
@@ -27,6 +28,7 @@ extern CAN_msg CAN_RxMsg;    /* CAN message for receiving */
   CAN interrupt handler
  *----------------------------------------------------------------------------*/
 void CAN_IRQHandler (void)  {
+	PROFILE_IRQ_ENTER(PROFILE_CAN);
 
 	/* CAN Controller 1 */
 	
@@ -58,7 +60,7 @@ void CAN_IRQHandler (void)  {
 		LPC_CAN2->CMR = (1 << 2);                    		/* Release receive buffer */
 		
 		
-		handle_CAN_update_stats(CAN_RxMsg.data);
+		handle_CAN_receive_stats(CAN_RxMsg.data);	/* Drawn later by the render flush task */
 		
 		
 	}
@@ -67,4 +69,6 @@ void CAN_IRQHandler (void)  {
 	if (icr & (1 << 1)) {
 		//your code
 	}
+
+	PROFILE_IRQ_EXIT(PROFILE_CAN);
 }
@@ -22,6 +22,15 @@
 /* Includes ------------------------------------------------------------------*/
 #include "GLCD.h" 
 #include "AsciiLib.h"
+#ifdef HOST_BUILD
+#include "host_lcd_model.h"   /* The bus cycles go to the controller model */
+#ifndef HOST_BUS_DECODER
+#define LCD_HOST_MODEL        /* ... straight, not through the pins */
+#endif
+#else
+#include "../timer/timer.h"   /* TIMER1 paces the GPDMA fills */
+#include "../main/cpu_profiler.h"
+#endif
 
 /* Private variables ---------------------------------------------------------*/
 static uint8_t LCD_Code;
@@ -43,6 +52,9 @@ static uint8_t LCD_Code;
 #define  LGDP4535   13 /* 0x4535 */  
 #define  SSD2119    14 /* 3.5 LCD 0x9919 */
 
+/* Private function prototypes -----------------------------------------------*/
+static void LCD_FillInit(void);
+
 /*******************************************************************************
 * Function Name  : Lcd_Configuration
 * Description    : Configures LCD Control lines
@@ -61,6 +73,7 @@ static void LCD_Configuration(void)
 	LPC_GPIO0->FIOSET    = 0x03f80000;
 }
 
+#ifndef LCD_HOST_MODEL   /* The model takes the words without the pins */
 /*******************************************************************************
 * Function Name  : LCD_Send
 * Description    : LCDд
@@ -69,17 +82,30 @@ static void LCD_Configuration(void)
 * Return         : None
 * Attention		 : None
 *******************************************************************************/
-static __attribute__((always_inline)) void LCD_Send (uint16_t byte) 
+static __inline __attribute__((always_inline)) void LCD_Send (uint16_t byte) 
 {
-	LPC_GPIO2->FIODIR |= 0xFF;          /* P2.0...P2.7 Output */
+	LCD_DATA_OUT()                      /* P2.0...P2.7 Output */
 	LCD_DIR(1)		   				    				/* Interface A->B */
 	LCD_EN(0)	                        	/* Enable 2A->2B */
-	LPC_GPIO2->FIOPIN =  byte;          /* Write D0..D7 */
+	LCD_DATA( byte )                    /* Write D0..D7 */
 	LCD_LE(1)                         
 	LCD_LE(0)														/* latch D0..D7	*/
-	LPC_GPIO2->FIOPIN =  byte >> 8;     /* Write D8..D15 */
+	LCD_DATA( byte >> 8 )               /* Write D8..D15 */
 }
+#endif
+
+/* Write strobe within the ILI9325 80-system bus limits (write cycle >= 100 ns,
+   WR low >= 50 ns, WR high >= 50 ns, data setup >= 10 ns and hold >= 15 ns)
+   at 100 MHz, a pin store taking at least one cycle: WR stays low five cycles
+   and the data lines are not touched in the cycle after it rises. */
+#define LCD_WR_STROBE()   LCD_WR(0) LCD_NOP() LCD_NOP() LCD_NOP() LCD_NOP() LCD_WR(1) LCD_NOP()
+
+/* Next pixel of a stream (CS and RS low and high, the bus driven): latch the
+   low byte, drive the high byte, strobe. Six cycles of WR high. */
+#define LCD_STREAM_PIXEL(color) \
+	LCD_DATA( color ) LCD_LE(1) LCD_LE(0) LCD_DATA( (color) >> 8 ) LCD_WR_STROBE()
 
+#ifndef LCD_HOST_MODEL
 /*******************************************************************************
 * Function Name  : wait_delay
 * Description    : Delay Time
@@ -91,7 +117,11 @@ static __attribute__((always_inline)) void LCD_Send (uint16_t byte)
 *******************************************************************************/
 static void wait_delay(int count)
 {
+#ifdef HOST_BUS_DECODER
+	host_bus_idle(4 * (count + 1));   /* About four cycles a turn */
+#else
 	while(count--);
+#endif
 }
 
 /*******************************************************************************
@@ -102,21 +132,22 @@ static void wait_delay(int count)
 * Return         : ضȡ
 * Attention		 : None
 *******************************************************************************/
-static __attribute__((always_inline)) uint16_t LCD_Read (void) 
+static __inline __attribute__((always_inline)) uint16_t LCD_Read (void) 
 {
 	uint16_t value;
 	
-	LPC_GPIO2->FIODIR &= ~(0xFF);              /* P2.0...P2.7 Input */
+	LCD_DATA_IN()                              /* P2.0...P2.7 Input */
 	LCD_DIR(0);		   				           				 /* Interface B->A */
 	LCD_EN(0);	                               /* Enable 2B->2A */
 	wait_delay(30);							   						 /* delay some times */
-	value = LPC_GPIO2->FIOPIN0;                /* Read D8..D15 */
+	value = LCD_DATA_READ();                   /* Read D8..D15 */
 	LCD_EN(1);	                               /* Enable 1B->1A */
 	wait_delay(30);							   						 /* delay some times */
-	value = (value << 8) | LPC_GPIO2->FIOPIN0; /* Read D0..D7 */
+	value = (value << 8) | LCD_DATA_READ();    /* Read D0..D7 */
 	LCD_DIR(1);
 	return  value;
 }
+#endif
 
 /*******************************************************************************
 * Function Name  : LCD_WriteIndex
@@ -126,17 +157,18 @@ static __attribute__((always_inline)) uint16_t LCD_Read (void)
 * Return         : None
 * Attention		 : None
 *******************************************************************************/
-static __attribute__((always_inline)) void LCD_WriteIndex(uint16_t index)
+static __inline __attribute__((always_inline)) void LCD_WriteIndex(uint16_t index)
 {
+#ifdef LCD_HOST_MODEL
+	host_lcd_write_index(index);
+#else
 	LCD_CS(0);
 	LCD_RS(0);
 	LCD_RD(1);
 	LCD_Send( index ); 
-	wait_delay(22);	
-	LCD_WR(0);  
-	wait_delay(1);
-	LCD_WR(1);
+	LCD_WR_STROBE()
 	LCD_CS(1);
+#endif
 }
 
 /*******************************************************************************
@@ -147,15 +179,17 @@ static __attribute__((always_inline)) void LCD_WriteIndex(uint16_t index)
 * Return         : None
 * Attention		 : None
 *******************************************************************************/
-static __attribute__((always_inline)) void LCD_WriteData(uint16_t data)
+static __inline __attribute__((always_inline)) void LCD_WriteData(uint16_t data)
 {				
+#ifdef LCD_HOST_MODEL
+	host_lcd_write_data(data);
+#else
 	LCD_CS(0);
 	LCD_RS(1);   
 	LCD_Send( data );
-	LCD_WR(0);     
-	wait_delay(1);
-	LCD_WR(1);
+	LCD_WR_STROBE()
 	LCD_CS(1);
+#endif
 }
 
 /*******************************************************************************
@@ -166,10 +200,13 @@ static __attribute__((always_inline)) void LCD_WriteData(uint16_t data)
 * Return         : ضȡ
 * Attention		 : None
 *******************************************************************************/
-static __attribute__((always_inline)) uint16_t LCD_ReadData(void)
+static __inline __attribute__((always_inline)) uint16_t LCD_ReadData(void)
 { 
 	uint16_t value;
 	
+#ifdef LCD_HOST_MODEL
+	value = host_lcd_read_data();
+#else
 	LCD_CS(0);
 	LCD_RS(1);
 	LCD_WR(1);
@@ -178,6 +215,7 @@ static __attribute__((always_inline)) uint16_t LCD_ReadData(void)
 	
 	LCD_RD(1);
 	LCD_CS(1);
+#endif
 	
 	return value;
 }
@@ -191,7 +229,7 @@ static __attribute__((always_inline)) uint16_t LCD_ReadData(void)
 * Return         : None
 * Attention		 : None
 *******************************************************************************/
-static __attribute__((always_inline)) void LCD_WriteReg(uint16_t LCD_Reg,uint16_t LCD_RegValue)
+static __inline __attribute__((always_inline)) void LCD_WriteReg(uint16_t LCD_Reg,uint16_t LCD_RegValue)
 { 
 	/* Write 16-bit Index, then Write Reg */  
 	LCD_WriteIndex(LCD_Reg);         
@@ -207,7 +245,7 @@ static __attribute__((always_inline)) void LCD_WriteReg(uint16_t LCD_Reg,uint16_
 * Return         : LCD Register Value.
 * Attention		 : None
 *******************************************************************************/
-static __attribute__((always_inline)) uint16_t LCD_ReadReg(uint16_t LCD_Reg)
+static __inline __attribute__((always_inline)) uint16_t LCD_ReadReg(uint16_t LCD_Reg)
 {
 	uint16_t LCD_RAM;
 	
@@ -218,54 +256,219 @@ static __attribute__((always_inline)) uint16_t LCD_ReadReg(uint16_t LCD_Reg)
 	return LCD_RAM;
 }
 
+/* Controller primitives ------------------------------------------------------*/
+/* Each controller family has its own register map for the GRAM address and
+   window. The primitives below are chosen once by LCD_Initialization from the
+   detected code, the DISP_ORIENTATION swap is resolved at compile time inside
+   each of them. A new panel only needs a new LCD_Driver entry. */
+typedef struct
+{
+	void (*SetCursor)( uint16_t Xpos, uint16_t Ypos );
+	void (*SetWindow)( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1 );  /* NULL: no window registers */
+	void (*Scroll)( uint16_t line );                                           /* NULL: no hardware scroll */
+	uint16_t GRAM;                                                             /* GRAM data register */
+} LCD_Driver;
+
 /*******************************************************************************
-* Function Name  : LCD_SetCursor
-* Description    : Sets the cursor position.
+* Function Name  : ILI932x_SetCursor
+* Description    : Sets the GRAM address (0x9320 0x9325 0x9328 0x9331 0x5408
+*                  0x1505 0x0505 0x7783 0x4531 0x4535)
 * Input          : - Xpos: specifies the X position.
 *                  - Ypos: specifies the Y position. 
 * Output         : None
 * Return         : None
 * Attention		 : None
 *******************************************************************************/
-static void LCD_SetCursor(uint16_t Xpos,uint16_t Ypos)
+static void ILI932x_SetCursor(uint16_t Xpos,uint16_t Ypos)
 {
     #if  ( DISP_ORIENTATION == 90 ) || ( DISP_ORIENTATION == 270 )
-	
- 	uint16_t temp = Xpos;
+	LCD_WriteReg(0x0020, Ypos );
+	LCD_WriteReg(0x0021, ( MAX_X - 1 ) - Xpos );
+	#else
+	LCD_WriteReg(0x0020, Xpos );
+	LCD_WriteReg(0x0021, Ypos );
+	#endif
+}
+
+/******************************************************************************
+* Function Name  : ILI932x_SetWindow
+* Description    : Restrict the GRAM address counter to a rectangle
+* Input          : - x0, y0: top-left corner
+*                  - x1, y1: bottom-right corner (included)
+* Output         : None
+* Return         : None
+* Attention		 : ILI932x family registers (0x50..0x53)
+*******************************************************************************/
+static void ILI932x_SetWindow( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1 )
+{
+    #if  ( DISP_ORIENTATION == 90 ) || ( DISP_ORIENTATION == 270 )
+	LCD_WriteReg(0x0050, y0 );
+	LCD_WriteReg(0x0051, y1 );
+	LCD_WriteReg(0x0052, ( MAX_X - 1 ) - x1 );
+	LCD_WriteReg(0x0053, ( MAX_X - 1 ) - x0 );
+	#else
+	LCD_WriteReg(0x0050, x0 );
+	LCD_WriteReg(0x0051, x1 );
+	LCD_WriteReg(0x0052, y0 );
+	LCD_WriteReg(0x0053, y1 );
+	#endif
+}
 
-			 Xpos = Ypos;
-			 Ypos = ( MAX_X - 1 ) - temp;  
+/******************************************************************************
+* Function Name  : ILI932x_Scroll
+* Description    : Start the display at another gate line (vertical scroll)
+* Input          : - line: gate line shown first
+* Output         : None
+* Return         : None
+* Attention		 : Scrolls along the 320 gate lines, i.e. horizontally on
+*                  screen at 90 and 270 degrees
+*******************************************************************************/
+static void ILI932x_Scroll( uint16_t line )
+{
+	LCD_WriteReg(0x0061, 0x0003 );   /* REV | VLE: enable the scroll */
+	LCD_WriteReg(0x006a, line );
+}
 
-	#elif  ( DISP_ORIENTATION == 0 ) || ( DISP_ORIENTATION == 180 )
-		
+/*******************************************************************************
+* Function Name  : SSD1289_SetCursor
+* Description    : Sets the GRAM address (0x8999 0x8989 0x9919)
+* Input          : - Xpos: specifies the X position.
+*                  - Ypos: specifies the Y position. 
+* Output         : None
+* Return         : None
+* Attention		 : None
+*******************************************************************************/
+static void SSD1289_SetCursor(uint16_t Xpos,uint16_t Ypos)
+{
+    #if  ( DISP_ORIENTATION == 90 ) || ( DISP_ORIENTATION == 270 )
+	LCD_WriteReg(0x004e, Ypos );
+	LCD_WriteReg(0x004f, ( MAX_X - 1 ) - Xpos );
+	#else
+	LCD_WriteReg(0x004e, Xpos );
+	LCD_WriteReg(0x004f, Ypos );
+	#endif
+}
+
+/******************************************************************************
+* Function Name  : SSD1289_Scroll
+* Description    : Start the display at another gate line (vertical scroll)
+* Input          : - line: gate line shown first
+* Output         : None
+* Return         : None
+* Attention		 : First screen scroll register (0x41)
+*******************************************************************************/
+static void SSD1289_Scroll( uint16_t line )
+{
+	LCD_WriteReg(0x0041, line );
+}
+
+/*******************************************************************************
+* Function Name  : HX834x_SetCursor
+* Description    : Sets the GRAM address (0x0046 0x0047)
+* Input          : - Xpos: specifies the X position.
+*                  - Ypos: specifies the Y position. 
+* Output         : None
+* Return         : None
+* Attention		 : The HX834x cursor is the start of its window
+*******************************************************************************/
+static void HX834x_SetCursor(uint16_t Xpos,uint16_t Ypos)
+{
+    #if  ( DISP_ORIENTATION == 90 ) || ( DISP_ORIENTATION == 270 )
+	uint16_t temp = Xpos;
+
+	Xpos = Ypos;
+	Ypos = ( MAX_X - 1 ) - temp;
+	#endif
+
+	LCD_WriteReg(0x02, Xpos>>8 );
+	LCD_WriteReg(0x03, Xpos );
+	LCD_WriteReg(0x06, Ypos>>8 );
+	LCD_WriteReg(0x07, Ypos );
+}
+
+/******************************************************************************
+* Function Name  : HX8347_SetWindow
+* Description    : Restrict the GRAM address counter to a rectangle
+* Input          : - x0, y0: top-left corner
+*                  - x1, y1: bottom-right corner (included)
+* Output         : None
+* Return         : None
+* Attention		 : HX8347A/D column and row address registers (0x02..0x09)
+*******************************************************************************/
+static void HX8347_SetWindow( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1 )
+{
+    #if  ( DISP_ORIENTATION == 90 ) || ( DISP_ORIENTATION == 270 )
+	uint16_t temp = x0;
+
+	x0 = y0;
+	y0 = ( MAX_X - 1 ) - x1;
+	x1 = y1;
+	y1 = ( MAX_X - 1 ) - temp;
 	#endif
 
-  switch( LCD_Code )
-  {
-     default:		 /* 0x9320 0x9325 0x9328 0x9331 0x5408 0x1505 0x0505 0x7783 0x4531 0x4535 */
-          LCD_WriteReg(0x0020, Xpos );     
-          LCD_WriteReg(0x0021, Ypos );     
-	      break; 
+	LCD_WriteReg(0x02, x0>>8 );
+	LCD_WriteReg(0x03, x0 );
+	LCD_WriteReg(0x04, x1>>8 );
+	LCD_WriteReg(0x05, x1 );
+	LCD_WriteReg(0x06, y0>>8 );
+	LCD_WriteReg(0x07, y0 );
+	LCD_WriteReg(0x08, y1>>8 );
+	LCD_WriteReg(0x09, y1 );
+}
+
+static const LCD_Driver ILI932x_Driver = { ILI932x_SetCursor, ILI932x_SetWindow, ILI932x_Scroll, 0x0022 };
+static const LCD_Driver SSD1289_Driver = { SSD1289_SetCursor, 0,                 SSD1289_Scroll, 0x0022 };
+static const LCD_Driver HX8346A_Driver = { HX834x_SetCursor,  0,                 0,              0x0022 };
+static const LCD_Driver HX8347_Driver  = { HX834x_SetCursor,  HX8347_SetWindow,  0,              0x0022 };
+
+/* Primitives of the detected controller (the ILI932x ones until LCD_Initialization) */
+static const LCD_Driver *LCD_Ops = &ILI932x_Driver;
 
-     case SSD1298: 	 /* 0x8999 */
+/*******************************************************************************
+* Function Name  : LCD_SelectDriver
+* Description    : Pick the primitives of the detected controller
+* Input          : - code: LCD_Code of the controller
+* Output         : None
+* Return         : None
+* Attention		 : None
+*******************************************************************************/
+static void LCD_SelectDriver(uint8_t code)
+{
+	switch( code )
+	{
+     case SSD1298:   /* 0x8999 */
      case SSD1289:   /* 0x8989 */
-	      LCD_WriteReg(0x004e, Xpos );      
-          LCD_WriteReg(0x004f, Ypos );          
-	      break;  
-
-     case HX8346A: 	 /* 0x0046 */
-     case HX8347A: 	 /* 0x0047 */
-     case HX8347D: 	 /* 0x0047 */
-	      LCD_WriteReg(0x02, Xpos>>8 );                                                  
-	      LCD_WriteReg(0x03, Xpos );  
-
-	      LCD_WriteReg(0x06, Ypos>>8 );                           
-	      LCD_WriteReg(0x07, Ypos );    
-	
-	      break;     
-     case SSD2119:	 /* 3.5 LCD 0x9919 */
-	      break; 
-  }
+     case SSD2119:   /* 3.5 LCD 0x9919 */
+	      LCD_Ops = &SSD1289_Driver;
+	      break;
+
+     case HX8346A:   /* 0x0046 */
+	      LCD_Ops = &HX8346A_Driver;
+	      break;
+
+     case HX8347A:   /* 0x0047 */
+     case HX8347D:   /* 0x0047 */
+	      LCD_Ops = &HX8347_Driver;
+	      break;
+
+     default:        /* 0x9320 0x9325 0x9328 0x9331 0x5408 0x1505 0x0505 0x7783 0x4531 0x4535 */
+	      LCD_Ops = &ILI932x_Driver;
+	      break;
+	}
+}
+
+/*******************************************************************************
+* Function Name  : LCD_SetCursor
+* Description    : Sets the cursor position.
+* Input          : - Xpos: specifies the X position.
+*                  - Ypos: specifies the Y position. 
+* Output         : None
+* Return         : None
+* Attention		 : None
+*******************************************************************************/
+static __inline __attribute__((always_inline)) void LCD_SetCursor(uint16_t Xpos,uint16_t Ypos)
+{
+	LCD_Ops->SetCursor(Xpos, Ypos);
 }
 
 /*******************************************************************************
@@ -374,6 +577,8 @@ void LCD_Initialization(void)
 		LCD_WriteReg(0x0021,0x0000);  /* ַ0 */     
 	}
 
+    LCD_SelectDriver(LCD_Code);
+    LCD_FillInit();
     delay_ms(50);   /* delay 50 ms */	
 }
 
@@ -387,32 +592,14 @@ void LCD_Initialization(void)
 *******************************************************************************/
 void LCD_Clear(uint16_t Color)
 {
-	uint32_t index;
-	
-	if( LCD_Code == HX8347D || LCD_Code == HX8347A )
-	{
-		LCD_WriteReg(0x02,0x00);                                                  
-		LCD_WriteReg(0x03,0x00);  
-		                
-		LCD_WriteReg(0x04,0x00);                           
-		LCD_WriteReg(0x05,0xEF);  
-		                 
-		LCD_WriteReg(0x06,0x00);                           
-		LCD_WriteReg(0x07,0x00);    
-		               
-		LCD_WriteReg(0x08,0x01);                           
-		LCD_WriteReg(0x09,0x3F);     
-	}
-	else
-	{	
-		LCD_SetCursor(0,0); 
-	}	
-
-	LCD_WriteIndex(0x0022);
-	for( index = 0; index < MAX_X * MAX_Y; index++ )
+	LCD_FillWait();
+	if( LCD_Ops->SetWindow )
 	{
-		LCD_WriteData(Color);
+		LCD_Ops->SetWindow(0, 0, MAX_X - 1, MAX_Y - 1);
 	}
+	LCD_SetCursor(0,0); 
+	LCD_WriteIndex(LCD_Ops->GRAM);
+	LCD_WriteRepeat(Color, MAX_X * MAX_Y);
 }
 
 /******************************************************************************
@@ -449,8 +636,9 @@ uint16_t LCD_GetPoint(uint16_t Xpos,uint16_t Ypos)
 {
 	uint16_t dummy;
 	
+	LCD_FillWait();
 	LCD_SetCursor(Xpos,Ypos);
-	LCD_WriteIndex(0x0022);  
+	LCD_WriteIndex(LCD_Ops->GRAM);  
 	
 	switch( LCD_Code )
 	{
@@ -498,8 +686,9 @@ void LCD_SetPoint(uint16_t Xpos,uint16_t Ypos,uint16_t point)
 	{
 		return;
 	}
+	LCD_FillWait();
 	LCD_SetCursor(Xpos,Ypos);
-	LCD_WriteReg(0x0022,point);
+	LCD_WriteReg(LCD_Ops->GRAM,point);
 }
 
 /******************************************************************************
@@ -596,6 +785,541 @@ void LCD_DrawLine( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1 , uint16_t
 	}
 } 
 
+/******************************************************************************
+* Function Name  : LCD_BeginWindow
+* Description    : Open a rectangle of GRAM for a stream of LCD_WritePixel
+* Input          : - x0, y0: top-left corner
+*                  - x1, y1: bottom-right corner (included)
+* Output         : None
+* Return         : 1 if the rectangle is open, 0 if it leaves the screen or
+*                  the controller has no window registers (use LCD_SetPoint)
+* Attention		 : Pixels go row by row from the top-left corner; close the
+*                  stream with LCD_EndWindow
+*******************************************************************************/
+uint8_t LCD_BeginWindow( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1 )
+{
+	if( x0 > x1 || y0 > y1 || x1 >= MAX_X || y1 >= MAX_Y )
+	{
+		return 0;
+	}
+
+	if( !LCD_Ops->SetWindow )
+	{
+	      return 0;  /* Use LCD_SetPoint */
+	}
+
+	LCD_FillWait();
+	LCD_Ops->SetWindow(x0, y0, x1, y1);
+    #if  ( DISP_ORIENTATION == 90 ) || ( DISP_ORIENTATION == 270 )
+	LCD_SetCursor(x1, y0);   /* First GRAM address of the window */
+	#else
+	LCD_SetCursor(x0, y0);
+	#endif
+	LCD_WriteIndex(LCD_Ops->GRAM);
+	return 1;
+}
+
+/******************************************************************************
+* Function Name  : LCD_WritePixel
+* Description    : Write the next pixel of the window opened by LCD_BeginWindow
+* Input          : - color: pixel color
+* Output         : None
+* Return         : None
+* Attention		 : None
+*******************************************************************************/
+void LCD_WritePixel( uint16_t color )
+{
+	LCD_WriteData(color);
+}
+
+/******************************************************************************
+* Function Name  : LCD_WritePixels
+* Description    : Write a run of pixels of the window opened by LCD_BeginWindow
+* Input          : - colors: pixel colors, in window order
+*                  - count: pixels of the run
+* Output         : None
+* Return         : None
+* Attention		 : CS and RS stay asserted and the bus driven for the whole
+*                  run: a pixel costs its two data stores, the latch and the
+*                  strobe, against thirteen stores and a delay loop for
+*                  LCD_WritePixel
+*******************************************************************************/
+void LCD_WritePixels( const uint16_t *colors, uint32_t count )
+{
+#ifdef LCD_HOST_MODEL
+	while( count-- )
+	{
+		host_lcd_write_data(*colors++);
+	}
+#else
+	uint16_t color;
+
+	LCD_CS(0);
+	LCD_RS(1);
+	LCD_RD(1);
+	LCD_DATA_OUT()
+	LCD_DIR(1)
+	LCD_EN(0)
+	for( ; count >= 4; count -= 4 )   /* Unrolled: a loop turn every four pixels */
+	{
+		color = colors[0];
+		LCD_STREAM_PIXEL(color)
+		color = colors[1];
+		LCD_STREAM_PIXEL(color)
+		color = colors[2];
+		LCD_STREAM_PIXEL(color)
+		color = colors[3];
+		LCD_STREAM_PIXEL(color)
+		colors += 4;
+	}
+	while( count-- )
+	{
+		color = *colors++;
+		LCD_STREAM_PIXEL(color)
+	}
+	LCD_CS(1);
+#endif
+}
+
+/******************************************************************************
+* Function Name  : LCD_WriteRepeat
+* Description    : Write the same color to the next pixels of a window
+* Input          : - color: pixel color
+*                  - count: pixels
+* Output         : None
+* Return         : None
+* Attention		 : The color stays on the bus, only WR moves (the CPU
+*                  version of the GPDMA fill)
+*******************************************************************************/
+void LCD_WriteRepeat( uint16_t color, uint32_t count )
+{
+#ifdef LCD_HOST_MODEL
+	while( count-- )
+	{
+		host_lcd_write_data(color);
+	}
+#else
+	LCD_CS(0);
+	LCD_RS(1);
+	LCD_RD(1);
+	LCD_Send( color );
+	for( ; count >= 4; count -= 4 )
+	{
+		LCD_WR_STROBE() LCD_NOP() LCD_NOP() LCD_NOP()   /* WR high >= 50 ns */
+		LCD_WR_STROBE() LCD_NOP() LCD_NOP() LCD_NOP()
+		LCD_WR_STROBE() LCD_NOP() LCD_NOP() LCD_NOP()
+		LCD_WR_STROBE() LCD_NOP() LCD_NOP() LCD_NOP()
+	}
+	while( count-- )
+	{
+		LCD_WR_STROBE() LCD_NOP() LCD_NOP() LCD_NOP()
+	}
+	LCD_CS(1);
+#endif
+}
+
+/******************************************************************************
+* Function Name  : LCD_EndWindow
+* Description    : Close the window opened by LCD_BeginWindow
+* Input          : None
+* Output         : None
+* Return         : None
+* Attention		 : The window is set back to the whole screen
+*******************************************************************************/
+void LCD_EndWindow( void )
+{
+	LCD_Ops->SetWindow(0, 0, MAX_X - 1, MAX_Y - 1);
+}
+
+/******************************************************************************
+* Function Name  : LCD_Scroll
+* Description    : Show the GRAM from another line (hardware vertical scroll)
+* Input          : - line: GRAM line shown at the top of the panel
+* Output         : None
+* Return         : 1 if the panel scrolled, 0 if the controller cannot
+* Attention		 : LCD_Scroll(0) puts the display back
+*******************************************************************************/
+uint8_t LCD_Scroll( uint16_t line )
+{
+	if( !LCD_Ops->Scroll )
+	{
+		return 0;
+	}
+	LCD_FillWait();
+	LCD_Ops->Scroll(line);
+	return 1;
+}
+
+/******************************************************************************
+* Function Name  : LCD_ClipRect
+* Description    : Order the corners of a rectangle and clip it to the screen
+* Input          : - x0, y0, x1, y1: corners, updated in place
+* Output         : None
+* Return         : 0 if the rectangle is off-screen
+* Attention		 : None
+*******************************************************************************/
+static uint8_t LCD_ClipRect( uint16_t *x0, uint16_t *y0, uint16_t *x1, uint16_t *y1 )
+{
+	uint16_t temp;
+
+    if( *x0 > *x1 )
+    {
+	    temp = *x1;
+		*x1 = *x0;
+		*x0 = temp;
+    }
+    if( *y0 > *y1 )
+    {
+		temp = *y1;
+		*y1 = *y0;
+		*y0 = temp;
+    }
+	if( *x0 >= MAX_X || *y0 >= MAX_Y )
+	{
+		return 0;
+	}
+	if( *x1 >= MAX_X )
+	{
+		*x1 = MAX_X - 1;
+	}
+	if( *y1 >= MAX_Y )
+	{
+		*y1 = MAX_Y - 1;
+	}
+	return 1;
+}
+
+/******************************************************************************
+* Function Name  : LCD_FillRect
+* Description    : Fill a rectangle with a color in a single GRAM burst
+* Input          : - x0, y0: top-left corner
+*                  - x1, y1: bottom-right corner (included)
+*                  - color: fill color
+* Output         : None
+* Return         : None
+* Attention		 : None
+*******************************************************************************/
+void LCD_FillRect( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color )
+{
+	uint16_t temp;
+
+	if( !LCD_ClipRect(&x0, &y0, &x1, &y1) )
+	{
+		return;
+	}
+
+	if( !LCD_BeginWindow(x0, y0, x1, y1) )
+	{
+	      for( ; y0 <= y1; y0++ )
+	      {
+	          for( temp = x0; temp <= x1; temp++ )
+	          {
+	              LCD_SetPoint(temp, y0, color);
+	          }
+	      }
+	      return;
+	}
+
+	LCD_WriteRepeat(color, (uint32_t)( x1 - x0 + 1 ) * ( y1 - y0 + 1 ));
+	LCD_EndWindow();
+}
+
+/******************************************************************************
+* Function Name  : LCD_WriteRect
+* Description    : Draw an image in a single GRAM burst
+* Input          : - x, y: top-left corner
+*                  - width, height: size of the image
+*                  - pixels: first pixel, lines top to bottom
+*                  - stride: pixels from a line to the next (width if packed)
+* Output         : None
+* Return         : None
+* Attention		 : Falls back to LCD_SetPoint (which drops the pixels off the
+*                  screen) when the window cannot be opened
+*******************************************************************************/
+void LCD_WriteRect( uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint16_t *pixels, uint16_t stride )
+{
+	uint16_t column;
+	uint16_t line;
+
+	if( width == 0 || height == 0 )
+	{
+		return;
+	}
+
+	if( !LCD_BeginWindow(x, y, x + width - 1, y + height - 1) )
+	{
+	      for( line = 0; line < height; line++ )
+	      {
+	          for( column = 0; column < width; column++ )
+	          {
+	              LCD_SetPoint(x + column, y + line, pixels[line * stride + column]);
+	          }
+	      }
+	      return;
+	}
+
+	if( stride == width )
+	{
+		LCD_WritePixels(pixels, (uint32_t)width * height);   /* Packed: one bus run */
+	}
+	else
+	{
+		for( line = 0; line < height; line++ )
+		{
+			LCD_WritePixels(pixels + line * stride, width);
+		}
+	}
+	LCD_EndWindow();
+}
+
+/* GPDMA fills ----------------------------------------------------------------*/
+/* A fill writes the same color to every pixel, so once the window is open and
+   the color is on the bus only WR has to move. GPDMA channel 0 copies a
+   pattern of WR low/high bytes into FIO0PIN3 (FIO0MASK lets only WR through),
+   one byte per TIMER1 match, so the bus runs without the CPU. A LCD call made
+   while the fill runs waits for its end. */
+#ifndef HOST_BUILD
+#define LCD_DMA_CHANNEL      LPC_GPDMACH0
+#define LCD_DMA_TIMER        1                  /* TIMER1, match MR0 */
+#define LCD_DMA_REQUEST      10                 /* MAT1.0 (instead of UART1 Tx) */
+#define LCD_DMA_EDGE_COUNTS  2                  /* Timer counts per WR edge: 80 ns, a 160 ns write cycle */
+#define LCD_DMA_BLOCK        1024               /* Pixels per linked list item */
+#define LCD_DMA_ITEMS        ( ( MAX_X * MAX_Y + LCD_DMA_BLOCK - 1 ) / LCD_DMA_BLOCK )
+
+/* DMACCControl / DMACCConfig fields */
+#define DMA_CONTROL_SI       ( 1UL << 26 )      /* Source increment (bytes, single transfers) */
+#define DMA_CONTROL_I        ( 1UL << 31 )      /* Terminal count interrupt */
+#define DMA_CONFIG_E         ( 1UL << 0 )
+#define DMA_CONFIG_M2P       ( 1UL << 11 )
+#define DMA_CONFIG_IE        ( 1UL << 14 )
+#define DMA_CONFIG_ITC       ( 1UL << 15 )
+
+/* Linked list item, in the layout the GPDMA loads it */
+typedef struct
+{
+	uint32_t SrcAddr;
+	uint32_t DestAddr;
+	uint32_t NextLLI;
+	uint32_t Control;
+} LCD_DMAItem;
+
+/* Everything the channel reads. The GPDMA master only reaches the AHB SRAM
+   (IRAM2, 0x2007C000), not the local SRAM at 0x10000000 where the linker puts
+   plain statics, so the block is pinned to the bottom of IRAM2 (the top holds
+   the retained snapshot, see game_snapshot.h). */
+static struct
+{
+	LCD_DMAItem Items[LCD_DMA_ITEMS];                 /* Linked list, word aligned */
+	uint8_t WRPattern[2 * LCD_DMA_BLOCK];             /* WR low, WR high, once per pixel */
+} LCD_DMARam __attribute__(( section( ".bss.ARM.__at_0x2007C000" ) ));
+static LCD_FillCallback LCD_FillDone;
+#endif
+
+static volatile uint8_t LCD_Filling = 0;
+
+/*******************************************************************************
+* Function Name  : LCD_FillInit
+* Description    : Power the GPDMA and prepare the WR pattern and TIMER1
+* Input          : None
+* Output         : None
+* Return         : None
+* Attention		 : Called by LCD_Initialization
+*******************************************************************************/
+static void LCD_FillInit(void)
+{
+#ifndef HOST_BUILD
+	uint32_t index;
+
+	for( index = 0; index < 2 * LCD_DMA_BLOCK; index += 2 )
+	{
+		LCD_DMARam.WRPattern[index] = 0;                       /* WR low */
+		LCD_DMARam.WRPattern[index + 1] = ( PIN_WR >> 24 );    /* WR high: the pixel is written */
+	}
+
+	LPC_SC->PCONP |= ( 1 << 29 );                      /* Power up the GPDMA */
+	LPC_GPDMA->DMACConfig = 1;
+	LPC_SC->DMAREQSEL |= ( 1 << ( LCD_DMA_REQUEST - 8 ) );
+	LPC_SC->PCONP |= ( 1 << 2 );                       /* Power up TIMER1 */
+	init_timer(LCD_DMA_TIMER, 0, 0, TIMER_MATCH_RESET, LCD_DMA_EDGE_COUNTS - 1);
+
+	NVIC_EnableIRQ(DMA_IRQn);
+	NVIC_SetPriority(DMA_IRQn, 6);
+#endif
+}
+
+/*******************************************************************************
+* Function Name  : LCD_FillFinish
+* Description    : Give the bus back to the CPU after a GPDMA fill
+* Input          : None
+* Output         : None
+* Return         : None
+* Attention		 : Called with the interrupts off or from DMA_IRQHandler
+*******************************************************************************/
+#ifndef HOST_BUILD
+static void LCD_FillFinish(void)
+{
+	LCD_FillCallback done = LCD_FillDone;
+
+	disable_timer(LCD_DMA_TIMER);
+	LCD_DMA_CHANNEL->DMACCConfig = 0;
+	LPC_GPDMA->DMACIntTCClear = 1;
+	LPC_GPDMA->DMACIntErrClr = 1;
+	LPC_GPIO0->FIOMASK = 0;
+	LCD_CS(1);                                         /* The pattern ends with WR high */
+	LCD_EndWindow();
+	LCD_FillDone = 0;
+	LCD_Filling = 0;
+	if( done )
+	{
+		done();
+	}
+}
+
+/*******************************************************************************
+* Function Name  : DMA_IRQHandler
+* Description    : End of a GPDMA fill
+* Input          : None
+* Output         : None
+* Return         : None
+* Attention		 : None
+*******************************************************************************/
+void DMA_IRQHandler(void)
+{
+	PROFILE_IRQ_ENTER(PROFILE_DMA);
+	if( LCD_Filling && ( LPC_GPDMA->DMACIntStat & 1 ) )
+	{
+		LCD_FillFinish();
+	}
+	PROFILE_IRQ_EXIT(PROFILE_DMA);
+}
+#endif
+
+/*******************************************************************************
+* Function Name  : LCD_FillBusy
+* Description    : Tell whether a GPDMA fill owns the bus
+* Input          : None
+* Output         : None
+* Return         : 1 while a fill runs
+* Attention		 : None
+*******************************************************************************/
+uint8_t LCD_FillBusy( void )
+{
+	return LCD_Filling;
+}
+
+/*******************************************************************************
+* Function Name  : LCD_FillWait
+* Description    : Wait for the end of the running GPDMA fill, if any
+* Input          : None
+* Output         : None
+* Return         : None
+* Attention		 : Finishes the fill itself when the DMA interrupt cannot
+*                  run (called from a higher priority handler)
+*******************************************************************************/
+void LCD_FillWait( void )
+{
+#ifndef HOST_BUILD
+	uint32_t primask;
+
+	while( LCD_Filling )
+	{
+		primask = __get_PRIMASK();
+		__disable_irq();
+		if( LCD_Filling && !( LCD_DMA_CHANNEL->DMACCConfig & DMA_CONFIG_E ) )
+		{
+			LCD_FillFinish();                          /* The channel stops itself after the last item */
+		}
+		__set_PRIMASK(primask);
+	}
+#endif
+}
+
+/******************************************************************************
+* Function Name  : LCD_FillRectAsync
+* Description    : Fill a rectangle with a color while the CPU goes on
+* Input          : - x0, y0: top-left corner
+*                  - x1, y1: bottom-right corner (included)
+*                  - color: fill color
+*                  - done: called at the end of the fill (may be 0)
+* Output         : None
+* Return         : None
+* Attention		 : done runs in DMA_IRQHandler, or in the LCD call that had
+*                  to wait for the fill. Small rectangles, controllers
+*                  without window registers and the host build fill at
+*                  once and call done before returning.
+*******************************************************************************/
+void LCD_FillRectAsync( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color, LCD_FillCallback done )
+{
+#ifndef HOST_BUILD
+	uint32_t count;
+	uint32_t block;
+	uint32_t item;
+
+	if( !LCD_ClipRect(&x0, &y0, &x1, &y1) )
+	{
+		if( done )
+		{
+			done();
+		}
+		return;
+	}
+
+	count = (uint32_t)( x1 - x0 + 1 ) * ( y1 - y0 + 1 );
+	if( count >= LCD_DMA_BLOCK && LCD_BeginWindow(x0, y0, x1, y1) )
+	{
+		/* Hold the color on the bus: from now on only WR moves */
+		LCD_CS(0);
+		LCD_RS(1);
+		LCD_RD(1);
+		LCD_Send( color );
+
+		for( item = 0; count; item++ )
+		{
+			block = ( count > LCD_DMA_BLOCK ) ? LCD_DMA_BLOCK : count;
+			count -= block;
+			LCD_DMARam.Items[item].SrcAddr = (uint32_t)LCD_DMARam.WRPattern;
+			LCD_DMARam.Items[item].DestAddr = (uint32_t)&LPC_GPIO0->FIOPIN3;
+			LCD_DMARam.Items[item].NextLLI = count ? (uint32_t)&LCD_DMARam.Items[item + 1] : 0;
+			LCD_DMARam.Items[item].Control = ( 2 * block ) | DMA_CONTROL_SI | ( count ? 0 : DMA_CONTROL_I );
+		}
+
+		LCD_FillDone = done;
+		LCD_Filling = 1;
+		LPC_GPIO0->FIOMASK = ~PIN_WR;
+		LPC_GPDMA->DMACIntTCClear = 1;
+		LPC_GPDMA->DMACIntErrClr = 1;
+		LCD_DMA_CHANNEL->DMACCSrcAddr = LCD_DMARam.Items[0].SrcAddr;
+		LCD_DMA_CHANNEL->DMACCDestAddr = LCD_DMARam.Items[0].DestAddr;
+		LCD_DMA_CHANNEL->DMACCLLI = LCD_DMARam.Items[0].NextLLI;
+		LCD_DMA_CHANNEL->DMACCControl = LCD_DMARam.Items[0].Control;
+		LCD_DMA_CHANNEL->DMACCConfig = DMA_CONFIG_E | ( LCD_DMA_REQUEST << 6 ) | DMA_CONFIG_M2P | DMA_CONFIG_IE | DMA_CONFIG_ITC;
+		reset_timer(LCD_DMA_TIMER);
+		enable_timer(LCD_DMA_TIMER);
+		return;
+	}
+#endif
+
+	LCD_FillRect(x0, y0, x1, y1, color);
+	if( done )
+	{
+		done();
+	}
+}
+
+/******************************************************************************
+* Function Name  : LCD_ClearAsync
+* Description    : Fill the whole screen with a color while the CPU goes on
+* Input          : - Color: Screen Color
+*                  - done: called at the end of the fill (may be 0)
+* Output         : None
+* Return         : None
+* Attention		 : See LCD_FillRectAsync
+*******************************************************************************/
+void LCD_ClearAsync( uint16_t Color, LCD_FillCallback done )
+{
+	LCD_FillRectAsync(0, 0, MAX_X - 1, MAX_Y - 1, Color, done);
+}
+
 /******************************************************************************
 * Function Name  : PutChar
 * Description    : Lcdλʾһַ
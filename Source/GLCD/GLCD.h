@@ -36,6 +36,22 @@
 #define PIN_WR		(1 << 24)
 #define PIN_RD		(1 << 25)   
 
+#ifdef HOST_BUS_DECODER
+/* Host check of the bus code: every pin store goes to the decoder */
+#include "host_bus_decoder.h"
+#define LCD_EN(x)   host_bus_control(PIN_EN, (x));
+#define LCD_LE(x)   host_bus_control(PIN_LE, (x));
+#define LCD_DIR(x)  host_bus_control(PIN_DIR, (x));
+#define LCD_CS(x)   host_bus_control(PIN_CS, (x));
+#define LCD_RS(x)   host_bus_control(PIN_RS, (x));
+#define LCD_WR(x)   host_bus_control(PIN_WR, (x));
+#define LCD_RD(x)   host_bus_control(PIN_RD, (x));
+#define LCD_DATA_OUT()    host_bus_data_direction(1);     /* P2.0...P2.7 Output */
+#define LCD_DATA_IN()     host_bus_data_direction(0);     /* P2.0...P2.7 Input */
+#define LCD_DATA(byte)    host_bus_data(byte);            /* Drive P2.0...P2.7 */
+#define LCD_DATA_READ()   host_bus_data_read()
+#define LCD_NOP()         host_bus_idle(1);
+#else
 #define LCD_EN(x)   ((x) ? (LPC_GPIO0->FIOSET = PIN_EN) : (LPC_GPIO0->FIOCLR = PIN_EN));
 #define LCD_LE(x)   ((x) ? (LPC_GPIO0->FIOSET = PIN_LE) : (LPC_GPIO0->FIOCLR = PIN_LE));
 #define LCD_DIR(x)  ((x) ? (LPC_GPIO0->FIOSET = PIN_DIR) : (LPC_GPIO0->FIOCLR = PIN_DIR));
@@ -43,6 +59,12 @@
 #define LCD_RS(x)   ((x) ? (LPC_GPIO0->FIOSET = PIN_RS) : (LPC_GPIO0->FIOCLR = PIN_RS));
 #define LCD_WR(x)   ((x) ? (LPC_GPIO0->FIOSET = PIN_WR) : (LPC_GPIO0->FIOCLR = PIN_WR));
 #define LCD_RD(x)   ((x) ? (LPC_GPIO0->FIOSET = PIN_RD) : (LPC_GPIO0->FIOCLR = PIN_RD));
+#define LCD_DATA_OUT()    LPC_GPIO2->FIODIR |= 0xFF;      /* P2.0...P2.7 Output */
+#define LCD_DATA_IN()     LPC_GPIO2->FIODIR &= ~(0xFF);   /* P2.0...P2.7 Input */
+#define LCD_DATA(byte)    LPC_GPIO2->FIOPIN0 = (byte);    /* Drive P2.0...P2.7 (byte lane: P2.8... untouched) */
+#define LCD_DATA_READ()   LPC_GPIO2->FIOPIN0
+#define LCD_NOP()         __NOP();
+#endif
 
 /* Private define ------------------------------------------------------------*/
 #define DISP_ORIENTATION  0  /* angle 0 90 */ 
@@ -86,12 +108,27 @@
 (( green >> 2 ) << 5  ) | \
 ( blue  >> 3 ))
 
+/* Called at the end of an asynchronous fill */
+typedef void (*LCD_FillCallback)(void);
+
 /* Private function prototypes -----------------------------------------------*/
 void LCD_Initialization(void);
 void LCD_Clear(uint16_t Color);
 uint16_t LCD_GetPoint(uint16_t Xpos,uint16_t Ypos);
 void LCD_SetPoint(uint16_t Xpos,uint16_t Ypos,uint16_t point);
 void LCD_DrawLine( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1 , uint16_t color );
+void LCD_FillRect( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color );
+void LCD_WriteRect( uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint16_t *pixels, uint16_t stride );
+uint8_t LCD_BeginWindow( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1 );
+void LCD_WritePixel( uint16_t color );
+void LCD_WritePixels( const uint16_t *colors, uint32_t count );
+void LCD_WriteRepeat( uint16_t color, uint32_t count );
+void LCD_EndWindow( void );
+uint8_t LCD_Scroll( uint16_t line );
+void LCD_FillRectAsync( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color, LCD_FillCallback done );
+void LCD_ClearAsync( uint16_t Color, LCD_FillCallback done );
+uint8_t LCD_FillBusy( void );
+void LCD_FillWait( void );
 void PutChar( uint16_t Xpos, uint16_t Ypos, uint8_t ASCI, uint16_t charColor, uint16_t bkColor );
 void GUI_Text(uint16_t Xpos, uint16_t Ypos, uint8_t *str,uint16_t Color, uint16_t bkColor);
 
@@ -26,6 +26,42 @@
 /* Includes ------------------------------------------------------------------*/
 #include <string.h>
 
+/* Private define ------------------------------------------------------------*/
+/*
+ * The firmware only links the glyphs of the GB2312 characters found in its
+ * string literals: HzLib_data.c is generated from the full font in
+ * HzLib_GB2312.txt by host/host_font_pack.c, which scans the sources.
+ *
+ * Any other character is drawn blank, unless the build defines
+ * HZLIB_FULL_STORE and links HzLib_store.c, also written by the tool: the
+ * whole font, every byte XORed with the one a row above and Huffman coded,
+ * unpacked on demand into a small cache of glyphs.
+ */
+#define HZLIB_GLYPH_BYTES     32          /* 16x16 pixels, two bytes a row */
+#define HZLIB_ROW_CHARS       94          /* Characters in a GB2312 row (low byte 0xA1..0xFE) */
+#define HZLIB_FIRST_HIGH      0xB0        /* Rows of the hanzi of levels 1 and 2 */
+#define HZLIB_LAST_HIGH       0xF7
+#define HZLIB_FIRST_LOW       0xA1
+#define HZLIB_LAST_LOW        0xFE
+#define HZLIB_CHARS           ((HZLIB_LAST_HIGH - HZLIB_FIRST_HIGH + 1) * HZLIB_ROW_CHARS)
+
+#define HZLIB_STORED_BYTES    30          /* The bottom row of every glyph is blank and not stored */
+#define HZLIB_BLOCK_GLYPHS    8           /* Glyphs between two entry points of the store */
+#define HZLIB_MAX_CODE_BITS   15          /* Longest Huffman code of the store */
+#define HZLIB_CACHE_GLYPHS    4           /* Glyphs of the store kept unpacked */
+
+/* Private variables ---------------------------------------------------------*/
+extern const unsigned short HzLib_SubsetCount;
+extern const unsigned short HzLib_SubsetCodes[];                        /* Ascending, 0xFFFF after the last */
+extern const unsigned char HzLib_SubsetGlyphs[][HZLIB_GLYPH_BYTES];     /* A blank glyph after the last */
+
+#ifdef HZLIB_FULL_STORE
+extern const unsigned short HzLib_StoreLengthCounts[HZLIB_MAX_CODE_BITS + 1];   /* Huffman codes of each length */
+extern const unsigned char HzLib_StoreSymbols[256];                              /* Bytes in canonical code order */
+extern const unsigned int HzLib_StoreBlocks[];                                   /* Bit offset of every block of glyphs */
+extern const unsigned char HzLib_StoreBits[];
+#endif
+
 /* Private function prototypes -----------------------------------------------*/
 void GetGBKCode(unsigned char* pBuffer,unsigned char * c);
 
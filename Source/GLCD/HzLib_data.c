@@ -0,0 +1,13 @@
+/* Generated by host/host_font_pack.c from HzLib_GB2312.txt: do not edit */
+#include "HzLib.h"
+
+// The 0 GB2312 characters of the firmware strings
+const unsigned short HzLib_SubsetCount = 0;
+
+const unsigned short HzLib_SubsetCodes[1] = {
+    0xFFFF
+};
+
+const unsigned char HzLib_SubsetGlyphs[1][HZLIB_GLYPH_BYTES] = {
+    {0}   // Blank: any other character
+};
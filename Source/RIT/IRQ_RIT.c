@@ -10,6 +10,7 @@
 #include "LPC17xx.h"
 #include "RIT.h"
 #include "../main/rit_handler.h"
+#include "../main/cpu_profiler.h"
 
 /* Variabili Globali Gestione De-Bouncing */
 volatile int down_0 = 0;
@@ -22,6 +23,8 @@ const int SHORT_PRESS_COUNT = 2;
 ** Descriptions:		REPETITIVE INTERRUPT TIMER handler
 ******************************************************************************/
 void RIT_IRQHandler(void) {			
+    PROFILE_IRQ_ENTER(PROFILE_RIT);
+
     /* Gestione INT0 */
     if (down_0 != 0) {
         down_0++;
@@ -84,4 +87,6 @@ void RIT_IRQHandler(void) {
 
     reset_RIT();
     LPC_RIT->RICTRL |= 0x1; /* Clear interrupt flag */
+
+    PROFILE_IRQ_EXIT(PROFILE_RIT);
 }
@@ -0,0 +1,265 @@
+/*
+ * Host replacement of the LPC17xx device header.
+ *
+ * Only used when the sources are compiled on a PC (HOST_BUILD): put this
+ * directory first in the include path so that every "LPC17xx.h" include
+ * resolves here. The peripherals used by the game are plain structures
+ * with the same register layout as the device, allocated in
+ * host_registers.c, and the NVIC is reduced to an enable and a pending
+ * bitmask that the host mocks (see host_timer_mock.h) look at.
+ */
+#ifndef __LPC17xx_H__
+#define __LPC17xx_H__
+
+#include <stdint.h>
+
+#ifndef HOST_BUILD
+#define HOST_BUILD
+#endif
+
+#define __I     volatile const
+#define __O     volatile
+#define __IO    volatile
+
+/* Interrupt numbers (same values as on the device) */
+typedef enum {
+    TIMER0_IRQn     = 1,
+    TIMER1_IRQn     = 2,
+    TIMER2_IRQn     = 3,
+    TIMER3_IRQn     = 4,
+    EINT0_IRQn      = 18,
+    EINT1_IRQn      = 19,
+    EINT2_IRQn      = 20,
+    ADC_IRQn        = 22,
+    CAN_IRQn        = 25,
+    DMA_IRQn        = 26,
+    RIT_IRQn        = 29
+} IRQn_Type;
+
+/* Timer 0..3 */
+typedef struct {
+    __IO uint32_t IR;
+    __IO uint32_t TCR;
+    __IO uint32_t TC;
+    __IO uint32_t PR;
+    __IO uint32_t PC;
+    __IO uint32_t MCR;
+    __IO uint32_t MR0;
+    __IO uint32_t MR1;
+    __IO uint32_t MR2;
+    __IO uint32_t MR3;
+    __IO uint32_t CCR;
+    __I  uint32_t CR0;
+    __I  uint32_t CR1;
+         uint32_t RESERVED0[2];
+    __IO uint32_t EMR;
+         uint32_t RESERVED1[12];
+    __IO uint32_t CTCR;
+} LPC_TIM_TypeDef;
+
+/* System control */
+typedef struct {
+    __IO uint32_t FLASHCFG;
+    __IO uint32_t PLL0CON;
+    __IO uint32_t PLL0CFG;
+    __IO uint32_t PLL0STAT;
+    __IO uint32_t PLL0FEED;
+    __IO uint32_t PLL1CON;
+    __IO uint32_t PLL1CFG;
+    __IO uint32_t PLL1STAT;
+    __IO uint32_t PLL1FEED;
+    __IO uint32_t PCON;
+    __IO uint32_t PCONP;
+    __IO uint32_t CCLKCFG;
+    __IO uint32_t USBCLKCFG;
+    __IO uint32_t CLKSRCSEL;
+    __IO uint32_t EXTINT;
+    __IO uint32_t EXTMODE;
+    __IO uint32_t EXTPOLAR;
+    __IO uint32_t RSID;
+    __IO uint32_t SCS;
+    __IO uint32_t PCLKSEL0;
+    __IO uint32_t PCLKSEL1;
+    __IO uint32_t CLKOUTCFG;
+    __IO uint32_t DMAREQSEL;
+} LPC_SC_TypeDef;
+
+/* Fast GPIO (word and byte-lane access) */
+typedef struct {
+    union {
+        __IO uint32_t FIODIR;
+        struct { __IO uint8_t FIODIR0, FIODIR1, FIODIR2, FIODIR3; };
+    };
+    uint32_t RESERVED0[3];
+    union {
+        __IO uint32_t FIOMASK;
+        struct { __IO uint8_t FIOMASK0, FIOMASK1, FIOMASK2, FIOMASK3; };
+    };
+    union {
+        __IO uint32_t FIOPIN;
+        struct { __IO uint8_t FIOPIN0, FIOPIN1, FIOPIN2, FIOPIN3; };
+    };
+    union {
+        __IO uint32_t FIOSET;
+        struct { __IO uint8_t FIOSET0, FIOSET1, FIOSET2, FIOSET3; };
+    };
+    union {
+        __O uint32_t FIOCLR;
+        struct { __O uint8_t FIOCLR0, FIOCLR1, FIOCLR2, FIOCLR3; };
+    };
+} LPC_GPIO_TypeDef;
+
+/* Repetitive interrupt timer */
+typedef struct {
+    __IO uint32_t RICOMPVAL;
+    __IO uint32_t RIMASK;
+    __IO uint32_t RICTRL;
+    __IO uint32_t RICOUNTER;
+} LPC_RIT_TypeDef;
+
+/* Pin connect block */
+typedef struct {
+    __IO uint32_t PINSEL0;
+    __IO uint32_t PINSEL1;
+    __IO uint32_t PINSEL2;
+    __IO uint32_t PINSEL3;
+    __IO uint32_t PINSEL4;
+    __IO uint32_t PINSEL5;
+    __IO uint32_t PINSEL6;
+    __IO uint32_t PINSEL7;
+    __IO uint32_t PINSEL8;
+    __IO uint32_t PINSEL9;
+    __IO uint32_t PINSEL10;
+} LPC_PINCON_TypeDef;
+
+/* DAC */
+typedef struct {
+    __IO uint32_t DACR;
+    __IO uint32_t DACCTRL;
+    __IO uint16_t DACCNTVAL;
+} LPC_DAC_TypeDef;
+
+/* CAN controllers and acceptance filter */
+typedef struct {
+    __IO uint32_t MOD;
+    __O  uint32_t CMR;
+    __IO uint32_t GSR;
+    __I  uint32_t ICR;
+    __IO uint32_t IER;
+    __IO uint32_t BTR;
+    __IO uint32_t EWL;
+    __I  uint32_t SR;
+    __IO uint32_t RFS;
+    __IO uint32_t RID;
+    __IO uint32_t RDA;
+    __IO uint32_t RDB;
+    __IO uint32_t TFI1;
+    __IO uint32_t TID1;
+    __IO uint32_t TDA1;
+    __IO uint32_t TDB1;
+    __IO uint32_t TFI2;
+    __IO uint32_t TID2;
+    __IO uint32_t TDA2;
+    __IO uint32_t TDB2;
+    __IO uint32_t TFI3;
+    __IO uint32_t TID3;
+    __IO uint32_t TDA3;
+    __IO uint32_t TDB3;
+} LPC_CAN_TypeDef;
+
+typedef struct {
+    __IO uint32_t AFMR;
+    __IO uint32_t SFF_sa;
+    __IO uint32_t SFF_GRP_sa;
+    __IO uint32_t EFF_sa;
+    __IO uint32_t EFF_GRP_sa;
+    __IO uint32_t ENDofTable;
+    __I  uint32_t LUTerrAd;
+    __I  uint32_t LUTerr;
+    __IO uint32_t FCANIE;
+    __IO uint32_t FCANIC0;
+    __IO uint32_t FCANIC1;
+} LPC_CANAF_TypeDef;
+
+typedef struct {
+    __IO uint32_t mask[512];
+} LPC_CANAF_RAM_TypeDef;
+
+/* Core debug and cycle counter */
+typedef struct {
+    __IO uint32_t CTRL;
+    __IO uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct {
+    __IO uint32_t DHCSR;
+    __O  uint32_t DCRSR;
+    __IO uint32_t DCRDR;
+    __IO uint32_t DEMCR;
+} CoreDebug_Type;
+
+#define DWT_CTRL_CYCCNTENA_Msk      (1UL << 0)
+#define CoreDebug_DEMCR_TRCENA_Msk  (1UL << 24)
+#define CoreDebug_DHCSR_C_DEBUGEN_Msk (1UL << 0)
+
+/* Register instances (host_registers.c) */
+extern LPC_TIM_TypeDef       host_tim[4];
+extern LPC_SC_TypeDef        host_sc;
+extern LPC_GPIO_TypeDef      host_gpio[5];
+extern LPC_RIT_TypeDef       host_rit;
+extern LPC_PINCON_TypeDef    host_pincon;
+extern LPC_DAC_TypeDef       host_dac;
+extern LPC_CAN_TypeDef       host_can[2];
+extern LPC_CANAF_TypeDef     host_canaf;
+extern LPC_CANAF_RAM_TypeDef host_canaf_ram;
+extern DWT_Type              host_dwt;
+extern CoreDebug_Type        host_coredebug;
+
+#define LPC_TIM0        (&host_tim[0])
+#define LPC_TIM1        (&host_tim[1])
+#define LPC_TIM2        (&host_tim[2])
+#define LPC_TIM3        (&host_tim[3])
+#define LPC_SC          (&host_sc)
+#define LPC_GPIO0       (&host_gpio[0])
+#define LPC_GPIO1       (&host_gpio[1])
+#define LPC_GPIO2       (&host_gpio[2])
+#define LPC_GPIO3       (&host_gpio[3])
+#define LPC_GPIO4       (&host_gpio[4])
+#define LPC_RIT         (&host_rit)
+#define LPC_PINCON      (&host_pincon)
+#define LPC_DAC         (&host_dac)
+#define LPC_CAN1        (&host_can[0])
+#define LPC_CAN2        (&host_can[1])
+#define LPC_CANAF       (&host_canaf)
+#define LPC_CANAF_RAM   (&host_canaf_ram)
+#define DWT             (&host_dwt)
+#define CoreDebug       (&host_coredebug)
+
+/* NVIC: one bit per interrupt number */
+extern volatile uint32_t host_nvic_enabled;
+extern volatile uint32_t host_nvic_pending;
+extern volatile uint32_t host_primask;
+
+static inline void NVIC_EnableIRQ(IRQn_Type IRQn)       { host_nvic_enabled |= (1UL << IRQn); }
+static inline void NVIC_DisableIRQ(IRQn_Type IRQn)      { host_nvic_enabled &= ~(1UL << IRQn); }
+static inline void NVIC_SetPendingIRQ(IRQn_Type IRQn)   { host_nvic_pending |= (1UL << IRQn); }
+static inline void NVIC_ClearPendingIRQ(IRQn_Type IRQn) { host_nvic_pending &= ~(1UL << IRQn); }
+static inline void NVIC_SetPriority(IRQn_Type IRQn, uint32_t priority) { (void)IRQn; (void)priority; }
+
+/* Core intrinsics */
+static inline void __disable_irq(void)              { host_primask = 1; }
+static inline void __enable_irq(void)               { host_primask = 0; }
+static inline uint32_t __get_PRIMASK(void)          { return host_primask; }
+static inline void __set_PRIMASK(uint32_t priMask)  { host_primask = priMask; }
+static inline void __WFI(void)                      { }
+static inline void __NOP(void)                      { }
+static inline uint32_t __CLZ(uint32_t value)        { return value ? (uint32_t)__builtin_clz(value) : 32; }
+
+#define __ASM(instruction)  ((void)0)
+#define __INLINE            inline
+#define __STATIC_INLINE     static inline
+
+extern uint32_t SystemCoreClock;
+void SystemInit(void);
+
+#endif /* __LPC17xx_H__ */
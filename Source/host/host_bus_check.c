@@ -0,0 +1,135 @@
+/*
+ * Host check of the LCD bus code.
+ *
+ * Runs the GLCD.c primitives through the pin decoder (host_bus_decoder.h)
+ * instead of the controller model: the panel is identified by reading its
+ * device code back through the pins, then a clear, a fill, a stream of
+ * pixels, a strided image, single pixels and a read-back are drawn.
+ * Every frame must land in the ILI9325 model as drawn, every write must
+ * meet the bus limits, and the cycles per pixel of each path are printed.
+ *
+ * Usage: host_bus_check
+ *   exit status 0 if the pixels and the timing are right
+ *
+ * Build (from Source/):
+ *   gcc -std=gnu99 -O2 -DHOST_BUILD -DHOST_BUS_DECODER -Ihost -I. -IGLCD \
+ *       -o host_bus_check host/host_bus_check.c host/host_bus_decoder.c \
+ *       host/host_lcd_model.c host/host_registers.c host/host_cycles.c \
+ *       GLCD/GLCD.c GLCD/AsciiLib.c
+ */
+#include <stdio.h>
+#include "GLCD.h"
+#include "host_lcd_model.h"
+#include "host_bus_decoder.h"
+
+#define AREA_X      17
+#define AREA_Y      40
+#define AREA_WIDTH  64
+#define AREA_HEIGHT 48
+#define AREA_PIXELS (AREA_WIDTH * AREA_HEIGHT)
+
+static uint16_t pattern[AREA_PIXELS];
+static unsigned int errors = 0;
+
+// Pixels of the area that differ from the pattern (or from one color when pattern is 0)
+static unsigned int check_area(uint16_t x0, uint16_t y0, uint16_t width, uint16_t height, const uint16_t* expected, uint16_t color) {
+    unsigned int differing = 0;
+    uint16_t x;
+    uint16_t y;
+
+    for (y = 0; y < height; y++) {
+        for (x = 0; x < width; x++) {
+            if (host_lcd_pixel(x0 + x, y0 + y) != (expected ? expected[y * width + x] : color)) {
+                differing++;
+            }
+        }
+    }
+    return differing;
+}
+
+static void report(const char* step, unsigned int differing) {
+    printf("%-34s %s", step, differing ? "FAILED" : "ok");
+    if (differing) {
+        printf(" (%u pixels)", differing);
+    }
+    printf("\n");
+    errors += differing;
+}
+
+// Bus cycles per pixel of a draw, from the decoder's clock
+static double per_pixel(uint32_t start, uint32_t pixels) {
+    return (double)(host_bus_stats()->cycles - start) / pixels;
+}
+
+int main(void) {
+    const HostBusStats* stats = host_bus_stats();
+    double streamCycles;
+    double singleCycles;
+    double repeatCycles;
+    uint32_t start;
+    unsigned int differing;
+    unsigned int i;
+
+    host_lcd_reset();
+    host_bus_reset();
+    LCD_Initialization();   // The device code is read back through the pins
+    report("device code read, driver set up", stats->reads == 0);
+
+    start = stats->cycles;
+    LCD_Clear(Blue);
+    repeatCycles = per_pixel(start, MAX_X * MAX_Y);
+    report("LCD_Clear", check_area(0, 0, MAX_X, MAX_Y, 0, Blue));
+
+    LCD_FillRect(5, 6, 30, 9, Red);
+    report("LCD_FillRect", check_area(5, 6, 26, 4, 0, Red) + check_area(5, 10, 26, 1, 0, Blue));
+
+    for (i = 0; i < AREA_PIXELS; i++) {
+        pattern[i] = (uint16_t)(i * 40503U + 0x1234);   // Every bit of both bytes moves
+    }
+    LCD_BeginWindow(AREA_X, AREA_Y, AREA_X + AREA_WIDTH - 1, AREA_Y + AREA_HEIGHT - 1);
+    start = stats->cycles;
+    LCD_WritePixels(pattern, AREA_PIXELS);
+    streamCycles = per_pixel(start, AREA_PIXELS);
+    LCD_EndWindow();
+    report("LCD_WritePixels (one run)", check_area(AREA_X, AREA_Y, AREA_WIDTH, AREA_HEIGHT, pattern, 0));
+
+    LCD_BeginWindow(AREA_X, AREA_Y, AREA_X + AREA_WIDTH - 1, AREA_Y + AREA_HEIGHT - 1);
+    for (i = 0; i < AREA_HEIGHT; i++) {
+        LCD_WritePixels(&pattern[(AREA_HEIGHT - 1 - i) * AREA_WIDTH], AREA_WIDTH - (i & 3));   // Odd run lengths
+        LCD_WritePixels(&pattern[(AREA_HEIGHT - 1 - i) * AREA_WIDTH + AREA_WIDTH - (i & 3)], i & 3);
+    }
+    LCD_EndWindow();
+    for (differing = 0, i = 0; i < AREA_HEIGHT; i++) {
+        differing += check_area(AREA_X, AREA_Y + i, AREA_WIDTH, 1, &pattern[(AREA_HEIGHT - 1 - i) * AREA_WIDTH], 0);
+    }
+    report("LCD_WritePixels (runs per line)", differing);
+
+    LCD_WriteRect(AREA_X + 5, AREA_Y + 3, AREA_WIDTH / 2, AREA_HEIGHT / 2, &pattern[AREA_WIDTH + 7], AREA_WIDTH);
+    for (differing = 0, i = 0; i < AREA_HEIGHT / 2; i++) {
+        differing += check_area(AREA_X + 5, AREA_Y + 3 + i, AREA_WIDTH / 2, 1, &pattern[(i + 1) * AREA_WIDTH + 7], 0);
+    }
+    report("LCD_WriteRect (strided)", differing);
+
+    LCD_BeginWindow(AREA_X, AREA_Y, AREA_X + AREA_WIDTH - 1, AREA_Y + AREA_HEIGHT - 1);
+    start = stats->cycles;
+    for (i = 0; i < AREA_PIXELS; i++) {
+        LCD_WritePixel(pattern[AREA_PIXELS - 1 - i]);
+    }
+    singleCycles = per_pixel(start, AREA_PIXELS);
+    LCD_EndWindow();
+    for (differing = 0, i = 0; i < AREA_PIXELS; i++) {
+        differing += host_lcd_pixel(AREA_X + i % AREA_WIDTH, AREA_Y + i / AREA_WIDTH) != pattern[AREA_PIXELS - 1 - i];
+    }
+    report("LCD_WritePixel", differing);
+
+    LCD_SetPoint(200, 300, Yellow);
+    report("LCD_SetPoint, LCD_GetPoint", (LCD_GetPoint(200, 300) != Yellow) + check_area(200, 300, 1, 1, 0, Yellow));
+
+    printf("\nindex writes %u, data writes %u, reads %u\n", stats->indexWrites, stats->dataWrites, stats->reads);
+    printf("bus limits: cycle %u, WR low %u, WR high %u, setup %u, hold %u short; %u writes not driven\n",
+           stats->shortCycles, stats->shortLow, stats->shortHigh, stats->shortSetup, stats->shortHold, stats->floatingWrites);
+    printf("cycles per pixel: LCD_WritePixel %.1f, LCD_WritePixels %.1f (%.1fx), LCD_WriteRepeat %.1f\n",
+           singleCycles, streamCycles, singleCycles / streamCycles, repeatCycles);
+
+    return (errors || host_bus_violations()) ? 1 : 0;
+}
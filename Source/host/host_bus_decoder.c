@@ -0,0 +1,168 @@
+#include <string.h>
+#include "GLCD.h"
+#include "host_lcd_model.h"
+#include "host_bus_decoder.h"
+
+#define NS_TO_CYCLES(ns)  (((ns) * HOST_BUS_CPU_MHZ + 999) / 1000)
+#define CONTROL_PINS      (PIN_EN | PIN_LE | PIN_DIR | PIN_CS | PIN_RS | PIN_WR | PIN_RD)
+
+static uint32_t control;        // Levels of the control lines
+static uint8_t dataOutput;      // P2.0..P2.7 driven by the CPU
+static uint8_t dataLines;       // Byte the CPU drives on P2.0..P2.7
+static uint8_t latched;         // D0..D7, out of the latch
+static uint16_t readWord;       // Word the panel drives during a read
+static uint32_t now;            // Cycles since the reset
+static uint32_t wrFall;         // Last WR edges
+static uint32_t wrRise;
+static uint8_t strobed;         // WR went low once (wrFall, wrRise valid)
+static uint32_t busChange;      // Last change of the word the panel sees
+static HostBusStats stats;
+
+static int high(uint32_t pin) {
+    return (control & pin) != 0;
+}
+
+// The panel sees the CPU's word: transceiver enabled and turned A->B
+static int driving(void) {
+    return high(PIN_DIR) && !high(PIN_EN);
+}
+
+// The word on D0..D15 changes at time t: too soon after the last write?
+static void bus_changed(uint32_t t) {
+    if (strobed && (t - wrRise < NS_TO_CYCLES(HOST_BUS_HOLD_NS))) {
+        stats.shortHold++;
+    }
+    busChange = t;
+}
+
+void host_bus_reset(void) {
+    control = CONTROL_PINS;   // LCD_Configuration sets every control line high
+    dataOutput = 0;
+    dataLines = 0;
+    latched = 0;
+    readWord = 0;
+    now = 0;
+    wrFall = 0;
+    wrRise = 0;
+    strobed = 0;
+    busChange = 0;
+    memset(&stats, 0, sizeof(stats));
+}
+
+// A store to FIOSET or FIOCLR of GPIO0 for one control line
+void host_bus_control(uint32_t pin, int level) {
+    const uint32_t t = now++;
+    const int was = high(pin);
+
+    control = level ? (control | pin) : (control & ~pin);
+    if (was == !!level) {
+        return;
+    }
+
+    switch (pin) {
+        case PIN_LE:
+            if (level && dataOutput) {
+                latched = dataLines;   // Transparent
+                bus_changed(t);
+            }
+            break;
+        case PIN_EN:
+        case PIN_DIR:
+            bus_changed(t);
+            break;
+        case PIN_WR:
+            if (high(PIN_CS)) {
+                break;
+            }
+            if (!level) {
+                if (strobed && (t - wrRise < NS_TO_CYCLES(HOST_BUS_WR_HIGH_NS))) {
+                    stats.shortHigh++;
+                }
+                if (strobed && (t - wrFall < NS_TO_CYCLES(HOST_BUS_CYCLE_NS))) {
+                    stats.shortCycles++;
+                }
+                wrFall = t;
+                strobed = 1;
+                break;
+            }
+            if (t - wrFall < NS_TO_CYCLES(HOST_BUS_WR_LOW_NS)) {
+                stats.shortLow++;
+            }
+            if (t - busChange < NS_TO_CYCLES(HOST_BUS_SETUP_NS + HOST_BUS_GLUE_NS)) {
+                stats.shortSetup++;
+            }
+            wrRise = t;
+            if (!driving() || !dataOutput || !high(PIN_RD)) {
+                stats.floatingWrites++;
+                break;
+            }
+            if (high(PIN_RS)) {
+                host_lcd_write_data((uint16_t)((dataLines << 8) | latched));
+                stats.dataWrites++;
+            } else {
+                host_lcd_write_index((uint16_t)((dataLines << 8) | latched));
+                stats.indexWrites++;
+            }
+            break;
+        case PIN_RD:
+            if (!level && !high(PIN_CS)) {
+                readWord = host_lcd_read_data();
+                stats.reads++;
+            }
+            break;
+        default:
+            break;
+    }
+    stats.cycles = now;
+}
+
+// FIODIR of P2.0..P2.7 (a read-modify-write: two cycles)
+void host_bus_data_direction(int output) {
+    const uint32_t t = now;
+
+    now += 2;
+    stats.cycles = now;
+    if (dataOutput != !!output) {
+        dataOutput = !!output;
+        bus_changed(t);
+    }
+}
+
+// A store to P2.0..P2.7
+void host_bus_data(uint8_t value) {
+    const uint32_t t = now++;
+
+    stats.cycles = now;
+    dataLines = value;
+    if (!dataOutput) {
+        return;
+    }
+    if (high(PIN_LE)) {
+        latched = value;
+    }
+    bus_changed(t);
+}
+
+// A load of P2.0..P2.7: the byte of the panel's word the transceiver passes (B->A)
+uint8_t host_bus_data_read(void) {
+    now++;
+    stats.cycles = now;
+    if (dataOutput || high(PIN_DIR)) {
+        return dataLines;
+    }
+    return high(PIN_EN) ? (uint8_t)(readWord & 0xFF) : (uint8_t)(readWord >> 8);
+}
+
+// NOPs and delay loops
+void host_bus_idle(uint32_t cycles) {
+    now += cycles;
+    stats.cycles = now;
+}
+
+const HostBusStats* host_bus_stats(void) {
+    return &stats;
+}
+
+uint32_t host_bus_violations(void) {
+    return stats.shortCycles + stats.shortLow + stats.shortHigh + stats.shortSetup + stats.shortHold + stats.floatingWrites;
+}
@@ -0,0 +1,56 @@
+#ifndef __HOST_BUS_DECODER_H
+#define __HOST_BUS_DECODER_H
+
+#include "LPC17xx.h"
+
+/*
+ * Host decoder of the LCD bus pins.
+ *
+ * Built with HOST_BUS_DECODER, GLCD.c drives the pins instead of the
+ * controller model: every store to a control line of GPIO0 (EN, LE, DIR,
+ * CS, RS, WR, RD) or to the data lines P2.0..P2.7 comes here, as on the
+ * board. The decoder follows the 74HC573 latch (D0..D7, transparent while
+ * LE is high) and the transceiver (DIR, EN), and on each rising edge of WR
+ * with CS low hands the 16-bit word to the ILI9325 model (host_lcd_model.h)
+ * as an index (RS low) or data write. A falling edge of RD reads the model,
+ * the bytes come back on P2.0..P2.7 as the transceiver selects them.
+ *
+ * Time is counted in CPU cycles, one per store or NOP, which is the
+ * fastest the core can drive the pins: the loop and load cycles a real
+ * build adds in between only lengthen every interval. Each write is
+ * checked against the ILI9325 80-system bus limits below, the delay of the
+ * latch and transceiver (HC logic at 3.3 V) added to the data setup.
+ */
+
+#define HOST_BUS_CPU_MHZ        100   // SystemCoreClock
+#define HOST_BUS_CYCLE_NS       100   // Write cycle, WR falling to WR falling
+#define HOST_BUS_WR_LOW_NS      50
+#define HOST_BUS_WR_HIGH_NS     50
+#define HOST_BUS_SETUP_NS       10    // Data valid before WR rises
+#define HOST_BUS_HOLD_NS        15    // Data kept after WR rises
+#define HOST_BUS_GLUE_NS        25    // 74HC573 / 74HC245 propagation
+
+// Bus accounting
+typedef struct {
+    uint32_t cycles;              // CPU cycles on the bus (stores and NOPs)
+    uint32_t indexWrites;
+    uint32_t dataWrites;
+    uint32_t reads;
+    uint32_t shortCycles;         // Violations of each limit
+    uint32_t shortLow;
+    uint32_t shortHigh;
+    uint32_t shortSetup;
+    uint32_t shortHold;
+    uint32_t floatingWrites;      // WR strobed with the transceiver off or turned B->A
+} HostBusStats;
+
+void host_bus_reset(void);
+void host_bus_control(uint32_t pin, int level);
+void host_bus_data_direction(int output);
+void host_bus_data(uint8_t value);
+uint8_t host_bus_data_read(void);
+void host_bus_idle(uint32_t cycles);
+const HostBusStats* host_bus_stats(void);
+uint32_t host_bus_violations(void);
+
+#endif /* __HOST_BUS_DECODER_H */
@@ -0,0 +1,18 @@
+/*
+ * Host build: emulated DWT cycle counter.
+ *
+ * Counts SystemCoreClock cycles per second of the monotonic clock and wraps
+ * at 32 bits like DWT->CYCCNT, so profiler and task statistics keep their
+ * meaning on Linux.
+ */
+#include <time.h>
+#include "LPC17xx.h"
+
+uint32_t host_cycle_count(void) {
+    struct timespec now;
+    uint64_t cycles;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    cycles = (uint64_t)now.tv_sec * SystemCoreClock + ((uint64_t)now.tv_nsec * (SystemCoreClock / 1000000)) / 1000;
+    return (uint32_t)cycles;
+}
@@ -0,0 +1,420 @@
+/*
+ * GB2312 font subsetter.
+ *
+ * Reads the 16x16 hanzi font of GLCD/HzLib_GB2312.txt and the firmware
+ * sources, and writes GLCD/HzLib_data.c with the glyphs of the GB2312
+ * characters found in the sources' string literals only (comments are
+ * skipped), so the firmware links a few bytes instead of the 216 KB font.
+ *
+ * With -s it also writes the whole font as a compressed store for
+ * GLCD/HzLib.c built with HZLIB_FULL_STORE: the bottom row of every glyph
+ * is dropped (the tool checks it is blank), every byte is XORed with the
+ * byte a row above and the result is Huffman coded, with canonical codes
+ * of at most HZLIB_MAX_CODE_BITS bits. The bit offset of every
+ * HZLIB_BLOCK_GLYPHS-th glyph is kept so that a glyph is unpacked from the
+ * start of its block.
+ *
+ * Font file: lines starting with ';' are comments. Each character is a line
+ *   <GB2312 code in hex> <32 glyph bytes in hex>
+ * covering every hanzi of levels 1 and 2 (0xB0A1..0xF7FE).
+ *
+ * Run it again whenever a string with GB2312 text changes, the generated
+ * file is kept in the project so that the target build needs no host
+ * compiler.
+ *
+ * Usage: host_font_pack [-s <HzLib_store.c>] <HzLib_GB2312.txt> <HzLib_data.c> <source>...
+ * Exit status: 0 on success, 1 if the font is rejected, 2 on I/O errors.
+ *
+ * The sources are every .c file of main, main/game and GLCD.
+ *
+ * Build (from Source/):
+ *   gcc -std=gnu99 -O2 -IGLCD -o host_font_pack host/host_font_pack.c
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "HzLib.h"
+
+#define LINE_SIZE    256
+#define SYMBOLS      256
+#define STORE_BYTES  (HZLIB_CHARS * HZLIB_STORED_BYTES * 2)   // Room for the worst case of the bit stream
+
+static unsigned char glyphs[HZLIB_CHARS][HZLIB_GLYPH_BYTES];
+static unsigned char present[HZLIB_CHARS];
+static unsigned char used[HZLIB_CHARS];
+static const char* fontPath;
+
+// Store under construction
+static unsigned char codeLengths[SYMBOLS];
+static unsigned int codes[SYMBOLS];
+static unsigned char storeBits[STORE_BYTES];
+static unsigned int storeBitCount = 0;
+static unsigned int blocks[(HZLIB_CHARS + HZLIB_BLOCK_GLYPHS - 1) / HZLIB_BLOCK_GLYPHS];
+
+static void fail(unsigned int line, const char* message) {
+    fprintf(stderr, "%s:%u: %s\n", fontPath, line, message);
+    exit(1);
+}
+
+// Font index of a GB2312 code, -1 outside the hanzi of levels 1 and 2
+static int char_index(unsigned int high, unsigned int low) {
+    if ((high < HZLIB_FIRST_HIGH) || (high > HZLIB_LAST_HIGH) || (low < HZLIB_FIRST_LOW) || (low > HZLIB_LAST_LOW)) {
+        return -1;
+    }
+    return (int)((high - HZLIB_FIRST_HIGH) * HZLIB_ROW_CHARS + (low - HZLIB_FIRST_LOW));
+}
+
+static unsigned int char_code(unsigned int index) {
+    return ((HZLIB_FIRST_HIGH + index / HZLIB_ROW_CHARS) << 8) | (HZLIB_FIRST_LOW + index % HZLIB_ROW_CHARS);
+}
+
+static void read_font(FILE* file) {
+    char line[LINE_SIZE];
+    unsigned int lineNumber = 0;
+    unsigned int code;
+    unsigned int byte;
+    unsigned int i;
+    int offset;
+    int index;
+    const char* hex;
+
+    while (fgets(line, sizeof(line), file)) {
+        lineNumber++;
+        line[strcspn(line, "\r\n")] = '\0';
+        if ((line[0] == ';') || (line[0] == '\0')) {
+            continue;
+        }
+        if (sscanf(line, "%4x %n", &code, &offset) != 1) {
+            fail(lineNumber, "expected a GB2312 code");
+        }
+        index = char_index(code >> 8, code & 0xFF);
+        if (index < 0) {
+            fail(lineNumber, "not a hanzi of GB2312 levels 1 and 2");
+        }
+        if (present[index]) {
+            fail(lineNumber, "character defined twice");
+        }
+        hex = line + offset;
+        if (strlen(hex) != HZLIB_GLYPH_BYTES * 2) {
+            fail(lineNumber, "a glyph is 32 bytes");
+        }
+        for (i = 0; i < HZLIB_GLYPH_BYTES; i++) {
+            if (sscanf(hex + 2 * i, "%2x", &byte) != 1) {
+                fail(lineNumber, "bad hex digit");
+            }
+            glyphs[index][i] = (unsigned char)byte;
+        }
+        present[index] = 1;
+    }
+    for (i = 0; i < HZLIB_CHARS; i++) {
+        if (!present[i]) {
+            fprintf(stderr, "%s: character %04X missing\n", fontPath, char_code(i));
+            exit(1);
+        }
+    }
+}
+
+// Mark the GB2312 characters of the string literals of a C source
+static unsigned int scan_source(const char* path) {
+    FILE* file = fopen(path, "rb");
+    enum { CODE, STRING, CHARACTER, LINE_COMMENT, BLOCK_COMMENT } state = CODE;
+    unsigned int found = 0;
+    int previous = 0;
+    int c;
+    int next;
+    int index;
+
+    if (!file) {
+        fprintf(stderr, "cannot open %s\n", path);
+        exit(2);
+    }
+    while ((c = fgetc(file)) != EOF) {
+        switch (state) {
+            case CODE:
+                if (c == '"') {
+                    state = STRING;
+                } else if (c == '\'') {
+                    state = CHARACTER;
+                } else if ((c == '/') && (previous == '/')) {
+                    state = LINE_COMMENT;
+                } else if ((c == '*') && (previous == '/')) {
+                    state = BLOCK_COMMENT;
+                    c = 0;   // The '*' of "/*" does not close the comment
+                }
+                break;
+            case STRING:
+            case CHARACTER:
+                if (c == '\\') {
+                    fgetc(file);
+                } else if (c == ((state == STRING) ? '"' : '\'')) {
+                    state = CODE;
+                } else if (c >= HZLIB_FIRST_LOW) {
+                    next = fgetc(file);
+                    if (next < HZLIB_FIRST_LOW) {
+                        ungetc(next, file);   // A lone high byte (Latin-1 text)
+                        break;
+                    }
+                    index = char_index((unsigned int)c, (unsigned int)next);
+                    if ((index >= 0) && !used[index]) {
+                        used[index] = 1;
+                        found++;
+                    }
+                }
+                break;
+            case LINE_COMMENT:
+                if (c == '\n') {
+                    state = CODE;
+                }
+                break;
+            case BLOCK_COMMENT:
+                if ((c == '/') && (previous == '*')) {
+                    state = CODE;
+                    c = 0;
+                }
+                break;
+        }
+        previous = c;
+    }
+    fclose(file);
+    return found;
+}
+
+static void write_subset(FILE* out) {
+    unsigned int count = 0;
+    unsigned int i;
+    unsigned int j;
+
+    for (i = 0; i < HZLIB_CHARS; i++) {
+        count += used[i];
+    }
+    fprintf(out, "/* Generated by host/host_font_pack.c from HzLib_GB2312.txt: do not edit */\n");
+    fprintf(out, "#include \"HzLib.h\"\n\n");
+    fprintf(out, "// The %u GB2312 characters of the firmware strings\n", count);
+    fprintf(out, "const unsigned short HzLib_SubsetCount = %u;\n\n", count);
+    fprintf(out, "const unsigned short HzLib_SubsetCodes[%u] = {\n", count + 1);
+    for (i = 0; i < HZLIB_CHARS; i++) {
+        if (used[i]) {
+            fprintf(out, "    0x%04X,\n", char_code(i));
+        }
+    }
+    fprintf(out, "    0xFFFF\n};\n\n");
+    fprintf(out, "const unsigned char HzLib_SubsetGlyphs[%u][HZLIB_GLYPH_BYTES] = {\n", count + 1);
+    for (i = 0; i < HZLIB_CHARS; i++) {
+        if (!used[i]) {
+            continue;
+        }
+        fprintf(out, "    {");
+        for (j = 0; j < HZLIB_GLYPH_BYTES; j++) {
+            fprintf(out, "0x%02X%s", glyphs[i][j], (j + 1 < HZLIB_GLYPH_BYTES) ? "," : "");
+        }
+        fprintf(out, "},   // %04X\n", char_code(i));
+    }
+    fprintf(out, "    {0}   // Blank: any other character\n};\n");
+}
+
+// Stored byte i of a glyph: XORed with the byte a row above
+static unsigned char stored_byte(unsigned int glyph, unsigned int i) {
+    return glyphs[glyph][i] ^ ((i >= 2) ? glyphs[glyph][i - 2] : 0);
+}
+
+// Huffman code lengths of the symbol frequencies (0 for an unused symbol)
+static unsigned char huffman_lengths(const unsigned long* frequencies) {
+    unsigned long weight[2 * SYMBOLS];
+    int parent[2 * SYMBOLS];
+    unsigned char alive[2 * SYMBOLS];
+    unsigned char longest = 0;
+    unsigned int nodes = SYMBOLS;
+    unsigned int first;
+    unsigned int second;
+    unsigned int i;
+    unsigned int depth;
+    int node;
+
+    for (i = 0; i < SYMBOLS; i++) {
+        weight[i] = frequencies[i];
+        alive[i] = frequencies[i] != 0;
+        parent[i] = -1;
+    }
+    // Join the two lightest trees until one is left
+    for (;;) {
+        first = second = 2 * SYMBOLS;
+        for (i = 0; i < nodes; i++) {
+            if (!alive[i]) {
+                continue;
+            }
+            if ((first == 2 * SYMBOLS) || (weight[i] < weight[first])) {
+                second = first;
+                first = i;
+            } else if ((second == 2 * SYMBOLS) || (weight[i] < weight[second])) {
+                second = i;
+            }
+        }
+        if (second == 2 * SYMBOLS) {
+            break;
+        }
+        weight[nodes] = weight[first] + weight[second];
+        alive[nodes] = 1;
+        parent[nodes] = -1;
+        alive[first] = alive[second] = 0;
+        parent[first] = parent[second] = (int)nodes;
+        nodes++;
+    }
+    for (i = 0; i < SYMBOLS; i++) {
+        codeLengths[i] = 0;
+        if (!frequencies[i]) {
+            continue;
+        }
+        depth = 0;
+        for (node = parent[i]; node >= 0; node = parent[node]) {
+            depth++;
+        }
+        codeLengths[i] = (unsigned char)(depth ? depth : 1);
+        longest = (codeLengths[i] > longest) ? codeLengths[i] : longest;
+    }
+    return longest;
+}
+
+// Canonical codes: shorter codes first, equal lengths in symbol order (the order HzLib.c decodes in)
+static void canonical_codes(unsigned short* lengthCounts, unsigned char* symbols) {
+    unsigned int code = 0;
+    unsigned int length;
+    unsigned int symbol;
+    unsigned int count = 0;
+
+    memset(lengthCounts, 0, (HZLIB_MAX_CODE_BITS + 1) * sizeof(*lengthCounts));
+    for (length = 1; length <= HZLIB_MAX_CODE_BITS; length++) {
+        for (symbol = 0; symbol < SYMBOLS; symbol++) {
+            if (codeLengths[symbol] == length) {
+                codes[symbol] = code++;
+                symbols[count++] = (unsigned char)symbol;
+                lengthCounts[length]++;
+            }
+        }
+        code <<= 1;
+    }
+}
+
+static void put_code(unsigned char symbol) {
+    unsigned int bit;
+
+    for (bit = codeLengths[symbol]; bit > 0; bit--) {
+        if ((codes[symbol] >> (bit - 1)) & 1) {
+            storeBits[storeBitCount >> 3] |= 0x80 >> (storeBitCount & 7);
+        }
+        storeBitCount++;
+    }
+}
+
+static void write_store(FILE* out) {
+    unsigned long frequencies[SYMBOLS];
+    unsigned short lengthCounts[HZLIB_MAX_CODE_BITS + 1];
+    unsigned char symbols[SYMBOLS];
+    unsigned int i;
+    unsigned int j;
+
+    memset(frequencies, 0, sizeof(frequencies));
+    for (i = 0; i < HZLIB_CHARS; i++) {
+        for (j = HZLIB_STORED_BYTES; j < HZLIB_GLYPH_BYTES; j++) {
+            if (glyphs[i][j] != 0) {
+                fprintf(stderr, "%s: the bottom row of %04X is not blank\n", fontPath, char_code(i));
+                exit(1);
+            }
+        }
+        for (j = 0; j < HZLIB_STORED_BYTES; j++) {
+            frequencies[stored_byte(i, j)]++;
+        }
+    }
+    // Flatten the frequencies until the longest code fits
+    while (huffman_lengths(frequencies) > HZLIB_MAX_CODE_BITS) {
+        for (i = 0; i < SYMBOLS; i++) {
+            frequencies[i] = frequencies[i] ? ((frequencies[i] >> 1) | 1) : 0;
+        }
+    }
+    canonical_codes(lengthCounts, symbols);
+
+    for (i = 0; i < HZLIB_CHARS; i++) {
+        if (i % HZLIB_BLOCK_GLYPHS == 0) {
+            blocks[i / HZLIB_BLOCK_GLYPHS] = storeBitCount;
+        }
+        for (j = 0; j < HZLIB_STORED_BYTES; j++) {
+            put_code(stored_byte(i, j));
+        }
+    }
+
+    fprintf(out, "/* Generated by host/host_font_pack.c from HzLib_GB2312.txt: do not edit */\n");
+    fprintf(out, "#include \"HzLib.h\"\n\n");
+    fprintf(out, "// Whole font: %u glyphs in %u bytes of Huffman codes\n", HZLIB_CHARS, (storeBitCount + 7) / 8);
+    fprintf(out, "const unsigned short HzLib_StoreLengthCounts[HZLIB_MAX_CODE_BITS + 1] = {");
+    for (i = 0; i <= HZLIB_MAX_CODE_BITS; i++) {
+        fprintf(out, "%u%s", lengthCounts[i], (i < HZLIB_MAX_CODE_BITS) ? ", " : "};\n\n");
+    }
+    fprintf(out, "const unsigned char HzLib_StoreSymbols[256] = {");
+    for (i = 0; i < SYMBOLS; i++) {
+        fprintf(out, "%s0x%02X%s", (i % 16) ? "" : "\n    ", symbols[i], (i + 1 < SYMBOLS) ? "," : "\n};\n\n");
+    }
+    fprintf(out, "const unsigned int HzLib_StoreBlocks[%u] = {", (unsigned int)(sizeof(blocks) / sizeof(blocks[0])));
+    for (i = 0; i < sizeof(blocks) / sizeof(blocks[0]); i++) {
+        fprintf(out, "%s%u%s", (i % 12) ? "" : "\n    ", blocks[i], (i + 1 < sizeof(blocks) / sizeof(blocks[0])) ? "," : "\n};\n\n");
+    }
+    fprintf(out, "const unsigned char HzLib_StoreBits[%u] = {", (storeBitCount + 7) / 8);
+    for (i = 0; i < (storeBitCount + 7) / 8; i++) {
+        fprintf(out, "%s0x%02X%s", (i % 16) ? "" : "\n    ", storeBits[i], (i + 1 < (storeBitCount + 7) / 8) ? "," : "\n};\n");
+    }
+}
+
+int main(int argc, char** argv) {
+    const char* storePath = NULL;
+    unsigned int count = 0;
+    unsigned int i;
+    int arg = 1;
+    FILE* file;
+
+    if ((argc > 2) && (strcmp(argv[1], "-s") == 0)) {
+        storePath = argv[2];
+        arg = 3;
+    }
+    if (argc - arg < 3) {
+        fprintf(stderr, "usage: %s [-s <HzLib_store.c>] <HzLib_GB2312.txt> <HzLib_data.c> <source>...\n", argv[0]);
+        return 2;
+    }
+    fontPath = argv[arg];
+    file = fopen(fontPath, "r");
+    if (!file) {
+        fprintf(stderr, "cannot open %s\n", fontPath);
+        return 2;
+    }
+    read_font(file);
+    fclose(file);
+    for (i = arg + 2; i < (unsigned int)argc; i++) {
+        count += scan_source(argv[i]);
+    }
+
+    file = fopen(argv[arg + 1], "w");
+    if (!file) {
+        fprintf(stderr, "cannot write %s\n", argv[arg + 1]);
+        return 2;
+    }
+    write_subset(file);
+    if (fclose(file)) {
+        fprintf(stderr, "cannot write %s\n", argv[arg + 1]);
+        return 2;
+    }
+    printf("%u characters used: %u bytes of glyphs (%u for the whole font)\n", count,
+           (count + 1) * (HZLIB_GLYPH_BYTES + 2), HZLIB_CHARS * HZLIB_GLYPH_BYTES);
+
+    if (storePath) {
+        file = fopen(storePath, "w");
+        if (!file) {
+            fprintf(stderr, "cannot write %s\n", storePath);
+            return 2;
+        }
+        write_store(file);
+        if (fclose(file)) {
+            fprintf(stderr, "cannot write %s\n", storePath);
+            return 2;
+        }
+        printf("store: %u bytes of codes, %u of block offsets\n", (storeBitCount + 7) / 8,
+               (unsigned int)sizeof(blocks));
+    }
+    return 0;
+}
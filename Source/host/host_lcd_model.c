@@ -0,0 +1,183 @@
+#include <stdio.h>
+#include <string.h>
+#include "host_lcd_model.h"
+
+#define REG_DEVICE_CODE   0x00
+#define REG_ENTRY_MODE    0x03
+#define REG_GRAM_X        0x20
+#define REG_GRAM_Y        0x21
+#define REG_GRAM          0x22
+#define REG_WINDOW_X0     0x50
+#define REG_WINDOW_X1     0x51
+#define REG_WINDOW_Y0     0x52
+#define REG_WINDOW_Y1     0x53
+#define REG_BASE_IMAGE    0x61
+#define REG_SCROLL        0x6A
+
+#define BASE_IMAGE_VLE    (1 << 1)   // Vertical scroll enabled
+
+#define ENTRY_AM          (1 << 3)   // Vertical update first
+#define ENTRY_ID0         (1 << 4)   // Horizontal increment
+#define ENTRY_ID1         (1 << 5)   // Vertical increment
+
+static uint16_t registers[256];
+static uint16_t gram[HOST_LCD_HEIGHT][HOST_LCD_WIDTH];
+static uint16_t selected;                // Selected register
+static uint16_t cursorX;                 // Address counter
+static uint16_t cursorY;
+static uint8_t dummyReadPending;         // Next GRAM read is the dummy one
+static uint32_t gramWrites;
+static uint32_t busCycles;               // Index writes, data writes and reads
+
+// Step the address counter after a GRAM access (wraps inside the window)
+static void advance_cursor(void) {
+    const uint16_t entry = registers[REG_ENTRY_MODE];
+    const uint16_t x0 = registers[REG_WINDOW_X0], x1 = registers[REG_WINDOW_X1];
+    const uint16_t y0 = registers[REG_WINDOW_Y0], y1 = registers[REG_WINDOW_Y1];
+    const int dx = (entry & ENTRY_ID0) ? 1 : -1;
+    const int dy = (entry & ENTRY_ID1) ? 1 : -1;
+    int x = cursorX;
+    int y = cursorY;
+
+    if (entry & ENTRY_AM) {
+        y += dy;
+        if ((y < y0) || (y > y1)) {
+            y = (dy > 0) ? y0 : y1;
+            x += dx;
+            if ((x < x0) || (x > x1)) {
+                x = (dx > 0) ? x0 : x1;
+            }
+        }
+    } else {
+        x += dx;
+        if ((x < x0) || (x > x1)) {
+            x = (dx > 0) ? x0 : x1;
+            y += dy;
+            if ((y < y0) || (y > y1)) {
+                y = (dy > 0) ? y0 : y1;
+            }
+        }
+    }
+    cursorX = (uint16_t)x;
+    cursorY = (uint16_t)y;
+}
+
+// Panel read order of a GRAM value
+static uint16_t swap_red_blue(uint16_t color) {
+    return (uint16_t)(((color & 0x1F) << 11) | (color & 0x07E0) | (color >> 11));
+}
+
+/**
+ * @brief Power-on state: black GRAM, full-screen window, increments on both axes.
+ */
+void host_lcd_reset(void) {
+    memset(registers, 0, sizeof(registers));
+    memset(gram, 0, sizeof(gram));
+    registers[REG_ENTRY_MODE] = ENTRY_ID1 | ENTRY_ID0;
+    registers[REG_WINDOW_X1] = HOST_LCD_WIDTH - 1;
+    registers[REG_WINDOW_Y1] = HOST_LCD_HEIGHT - 1;
+    selected = 0;
+    cursorX = 0;
+    cursorY = 0;
+    dummyReadPending = 0;
+    gramWrites = 0;
+    busCycles = 0;
+}
+
+void host_lcd_write_index(uint16_t value) {
+    busCycles++;
+    selected = value & 0xFF;
+    dummyReadPending = (selected == REG_GRAM);
+}
+
+void host_lcd_write_data(uint16_t data) {
+    busCycles++;
+    switch (selected) {
+        case REG_GRAM:
+            if ((cursorX < HOST_LCD_WIDTH) && (cursorY < HOST_LCD_HEIGHT)) {
+                gram[cursorY][cursorX] = data;
+            }
+            gramWrites++;
+            advance_cursor();
+            return;
+        case REG_GRAM_X:
+            cursorX = data & 0xFF;
+            break;
+        case REG_GRAM_Y:
+            cursorY = data & 0x1FF;
+            break;
+        default:
+            break;
+    }
+    registers[selected] = data;
+}
+
+uint16_t host_lcd_read_data(void) {
+    uint16_t value;
+
+    busCycles++;
+    if (selected == REG_DEVICE_CODE) {
+        return HOST_LCD_DEVICE_CODE;
+    }
+    if (selected != REG_GRAM) {
+        return registers[selected];
+    }
+    if (dummyReadPending) {
+        dummyReadPending = 0;
+        return 0;
+    }
+    value = ((cursorX < HOST_LCD_WIDTH) && (cursorY < HOST_LCD_HEIGHT)) ? gram[cursorY][cursorX] : 0;
+    advance_cursor();
+    return swap_red_blue(value);
+}
+
+// Color of a pixel as written by the driver (RGB565)
+uint16_t host_lcd_pixel(uint16_t x, uint16_t y) {
+    return ((x < HOST_LCD_WIDTH) && (y < HOST_LCD_HEIGHT)) ? gram[y][x] : 0;
+}
+
+// Pixels written since the reset
+uint32_t host_lcd_gram_writes(void) {
+    return gramWrites;
+}
+
+// Bus cycles since the reset (every index write, data write and read costs one)
+uint32_t host_lcd_bus_cycles(void) {
+    return busCycles;
+}
+
+// GRAM line shown on a panel line (vertical scroll)
+static int shown_line(int line) {
+    if (!(registers[REG_BASE_IMAGE] & BASE_IMAGE_VLE)) {
+        return line;
+    }
+    return (line + registers[REG_SCROLL]) % HOST_LCD_HEIGHT;
+}
+
+/**
+ * @brief Saves the screen as a binary PPM (P6) image, as the panel shows it (scroll included).
+ *
+ * @return 0 on success, -1 if the file cannot be written.
+ */
+int host_lcd_write_ppm(const char* path) {
+    unsigned char row[HOST_LCD_WIDTH * 3];
+    FILE* file = fopen(path, "wb");
+    uint16_t color;
+    int x;
+    int y;
+
+    if (!file) {
+        return -1;
+    }
+    fprintf(file, "P6\n%d %d\n255\n", HOST_LCD_WIDTH, HOST_LCD_HEIGHT);
+    for (y = 0; y < HOST_LCD_HEIGHT; y++) {
+        for (x = 0; x < HOST_LCD_WIDTH; x++) {
+            color = gram[shown_line(y)][x];
+            row[3 * x]     = (unsigned char)(((color >> 11) & 0x1F) * 255 / 31);
+            row[3 * x + 1] = (unsigned char)(((color >> 5) & 0x3F) * 255 / 63);
+            row[3 * x + 2] = (unsigned char)((color & 0x1F) * 255 / 31);
+        }
+        fwrite(row, 1, sizeof(row), file);
+    }
+    return fclose(file) ? -1 : 0;
+}
@@ -0,0 +1,33 @@
+#ifndef __HOST_LCD_MODEL_H
+#define __HOST_LCD_MODEL_H
+
+#include "LPC17xx.h"
+
+/*
+ * Host model of the ILI9325 LCD controller.
+ *
+ * In the host build GLCD.c hands its bus cycles (index write, data write,
+ * data read) to this model instead of toggling GPIO0/GPIO2. An index write
+ * selects a register, a data write sets it; register 0x22 accesses GRAM at
+ * the address counter (0x20 horizontal, 0x21 vertical), which then moves
+ * as on the device: direction from the entry mode register 0x03 (AM, I/D)
+ * and wrap-around inside the window 0x50..0x53. As on the panel, the
+ * first GRAM read after selecting 0x22 is a dummy and GRAM reads come back
+ * in BGR order. The saved frames follow the vertical scroll (0x6A, enabled
+ * by VLE in 0x61); host_lcd_pixel reads GRAM as written.
+ */
+
+#define HOST_LCD_WIDTH       240
+#define HOST_LCD_HEIGHT      320
+#define HOST_LCD_DEVICE_CODE 0x9325   // Returned by register 0x00
+
+void host_lcd_reset(void);
+void host_lcd_write_index(uint16_t index);
+void host_lcd_write_data(uint16_t data);
+uint16_t host_lcd_read_data(void);
+uint16_t host_lcd_pixel(uint16_t x, uint16_t y);
+uint32_t host_lcd_gram_writes(void);
+uint32_t host_lcd_bus_cycles(void);
+int host_lcd_write_ppm(const char* path);
+
+#endif /* __HOST_LCD_MODEL_H */
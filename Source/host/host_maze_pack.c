@@ -0,0 +1,818 @@
+/*
+ * Level pack builder.
+ *
+ * Reads the ASCII mazes of main/game/game_levels.txt, checks that each one
+ * can be played and writes the const tables of main/game/game_levels.h as
+ * a C file: the row dictionary and level descriptors, and everything the
+ * renderer and the ghosts would otherwise work out from the maze at run
+ * time (wall outline, pill columns, move masks, tunnel bounds, junctions
+ * and the distances between them).
+ *
+ * Level file: lines starting with ';' are comments. Each level is a line
+ *   level <number> time <seconds> specials <count>
+ * followed by the 31 rows of its maze, 28 characters each:
+ *   '#' wall   '.' pill   'o' special pill   ' ' free   '-' ghost house door
+ *   '<' '>'    teleport ends (first and last column of the same row)
+ *   'P'        Pac-Man's start (a free cell)
+ *
+ * A maze is rejected unless:
+ *   - the border is wall, except for one pair of teleport ends;
+ *   - the door is two cells side by side with a free cell above each, and
+ *     the house behind it holds the ghost start cells (door row + 2:
+ *     door column, two cells left of it, three cells right of it);
+ *   - the house is sealed: it opens on the maze through the door only;
+ *   - Pac-Man reaches every cell of the maze outside the house;
+ *   - no corridor is a dead end (the ghosts never turn back).
+ *
+ * Run it again whenever game_levels.txt or the table layout changes, the
+ * generated file is kept in the project so that the target build needs no
+ * host compiler.
+ *
+ * Usage: host_maze_pack <game_levels.txt> <game_levels_data.c>
+ * Exit status: 0 on success, 1 if a maze is rejected, 2 on I/O errors.
+ *
+ * Build (from Source/):
+ *   gcc -std=gnu99 -O2 -Ihost -Imain/game -o host_maze_pack host/host_maze_pack.c
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "game_levels.h"
+
+#define PACK_MAX_LEVELS   64
+#define PACK_MAX_ROWS     256      // Dictionary entries (one byte per row reference)
+#define PACK_MAX_NODES    LEVEL_NO_NODE
+#define PACK_MAX_PIECES   (GAME_MAP_HEIGHT * GAME_MAP_WIDTH * 4)   // Outline pieces of a maze before merging
+#define LINE_SIZE         256
+
+typedef struct {
+    char maze[GAME_MAP_HEIGHT][GAME_MAP_WIDTH + 1];
+    unsigned int number;
+    unsigned int time;
+    unsigned int specials;
+    unsigned int firstLine;        // Line of the first maze row in the level file
+    Position pacman;
+    Position door;
+    unsigned int pills;
+    unsigned char rows[GAME_MAP_HEIGHT];
+    unsigned char reached[GAME_MAP_HEIGHT][GAME_MAP_WIDTH];   // Cells Pac-Man can reach
+    unsigned char moveRows[GAME_MAP_HEIGHT];
+    TunnelBounds tunnel;
+    unsigned int nodeCount;
+    unsigned int homeNode;
+    MazeNode nodes[PACK_MAX_NODES];
+    unsigned char distances[PACK_MAX_NODES * (PACK_MAX_NODES - 1) / 2];
+    unsigned int outlineCount;
+    OutlineSegment outline[PACK_MAX_PIECES];
+} PackLevel;
+
+// Outline piece before merging: a line at a fixed row (or column) between two pixels
+typedef struct {
+    int fixed;
+    int from;
+    int to;
+} OutlinePiece;
+
+static PackLevel levels[PACK_MAX_LEVELS];
+static unsigned int levelCount = 0;
+static char dictionary[PACK_MAX_ROWS][GAME_MAP_WIDTH + 1];
+static unsigned int dictionaryCount = 0;
+static unsigned char moveDictionary[PACK_MAX_ROWS][GAME_MAP_WIDTH];
+static unsigned int moveDictionaryCount = 0;
+static unsigned int outlineTotal = 0;
+static unsigned int pillColumnTotal = 0;
+static const char* sourcePath;
+
+static void fail(const PackLevel* level, int row, const char* message) {
+    if (row >= 0) {
+        fprintf(stderr, "%s:%u: level %u: %s\n", sourcePath, level->firstLine + row, level->number, message);
+    } else {
+        fprintf(stderr, "%s: level %u: %s\n", sourcePath, level->number, message);
+    }
+    exit(1);
+}
+
+static int cell_code(char cell) {
+    switch (cell) {
+        case ' ': case 'P': return CELL_FREE;
+        case '#': return CELL_WALL;
+        case '<': return CELL_TELEPORT_LEFT;
+        case '>': return CELL_TELEPORT_RIGHT;
+        case '.': return CELL_STANDARD_PILL;
+        case 'o': return CELL_SPECIAL_PILL;
+        case '-': return CELL_GHOST_DOOR;
+        default:  return -1;
+    }
+}
+
+// Cells actors can stand on (the door only lets the ghosts through)
+static int is_open(const PackLevel* level, int x, int y) {
+    const char cell = level->maze[y][x];
+    return (cell != '#') && (cell != '-');
+}
+
+// Neighbour of a cell in a direction (0 right, 1 left, 2 up, 3 down), 0 if it is closed
+static int step(const PackLevel* level, int x, int y, int direction, int* nx, int* ny) {
+    static const int STEPS[4][2] = {{1, 0}, {-1, 0}, {0, -1}, {0, 1}};
+
+    *nx = x + STEPS[direction][0];
+    *ny = y + STEPS[direction][1];
+    if ((*ny < 0) || (*ny >= GAME_MAP_HEIGHT)) {
+        return 0;
+    }
+    if (*nx < 0) {
+        if (level->maze[y][x] != '<') {
+            return 0;   // Only the teleport ends wrap around
+        }
+        *nx = GAME_MAP_WIDTH - 1;
+    } else if (*nx >= GAME_MAP_WIDTH) {
+        if (level->maze[y][x] != '>') {
+            return 0;
+        }
+        *nx = 0;
+    }
+    return is_open(level, *nx, *ny);
+}
+
+// Open neighbours of a cell, the teleport ends lead to each other
+static int neighbours(const PackLevel* level, int x, int y, int out[4][2]) {
+    int count = 0;
+    int direction;
+
+    for (direction = 0; direction < 4; direction++) {
+        if (step(level, x, y, direction, &out[count][0], &out[count][1])) {
+            count++;
+        }
+    }
+    return count;
+}
+
+// Flood fill over the open cells from (x, y)
+static void flood(const PackLevel* level, int x, int y, unsigned char reached[GAME_MAP_HEIGHT][GAME_MAP_WIDTH]) {
+    static int queue[GAME_MAP_HEIGHT * GAME_MAP_WIDTH][2];
+    int next[4][2];
+    int head = 0;
+    int tail = 0;
+    int count;
+    int i;
+
+    reached[y][x] = 1;
+    queue[tail][0] = x;
+    queue[tail][1] = y;
+    tail++;
+    while (head < tail) {
+        count = neighbours(level, queue[head][0], queue[head][1], next);
+        head++;
+        for (i = 0; i < count; i++) {
+            if (!reached[next[i][1]][next[i][0]]) {
+                reached[next[i][1]][next[i][0]] = 1;
+                queue[tail][0] = next[i][0];
+                queue[tail][1] = next[i][1];
+                tail++;
+            }
+        }
+    }
+}
+
+static void check_level(PackLevel* level) {
+    static const int GHOST_START[3][2] = {{0, 2}, {-2, 2}, {3, 2}};  // Pinky, Inky, Clyde from the door
+    unsigned char (*maze)[GAME_MAP_WIDTH] = level->reached;
+    unsigned char house[GAME_MAP_HEIGHT][GAME_MAP_WIDTH];
+    int next[4][2];
+    int pacmanCount = 0;
+    int doorCount = 0;
+    int tunnelCount = 0;
+    int x;
+    int y;
+    int i;
+    char message[96];
+
+    level->pills = 0;
+    for (y = 0; y < GAME_MAP_HEIGHT; y++) {
+        for (x = 0; x < GAME_MAP_WIDTH; x++) {
+            const char cell = level->maze[y][x];
+
+            if (cell_code(cell) < 0) {
+                snprintf(message, sizeof(message), "unknown cell '%c' in column %d", cell, x);
+                fail(level, y, message);
+            }
+            if (cell == 'P') {
+                level->pacman = (Position){.x = x, .y = y};
+                pacmanCount++;
+            } else if (cell == '-') {
+                if (doorCount++ == 0) {
+                    level->door = (Position){.x = x, .y = y};
+                }
+            } else if ((cell == '.') || (cell == 'o')) {
+                level->pills++;
+            }
+
+            // Border: walls, or teleport ends facing each other
+            if ((y == 0) || (y == GAME_MAP_HEIGHT - 1) || (x == 0) || (x == GAME_MAP_WIDTH - 1)) {
+                if ((cell == '<') && (x == 0) && (level->maze[y][GAME_MAP_WIDTH - 1] == '>') && (y > 0) && (y < GAME_MAP_HEIGHT - 1)) {
+                    tunnelCount++;
+                    continue;
+                }
+                if ((cell == '>') && (x == GAME_MAP_WIDTH - 1) && (level->maze[y][0] == '<') && (y > 0) && (y < GAME_MAP_HEIGHT - 1)) {
+                    continue;
+                }
+                if (cell != '#') {
+                    snprintf(message, sizeof(message), "open border in column %d", x);
+                    fail(level, y, message);
+                }
+            } else if ((cell == '<') || (cell == '>')) {
+                fail(level, y, "teleport end away from the border");
+            }
+        }
+    }
+    if (tunnelCount > 1) {
+        fail(level, -1, "at most one teleport pair per maze");
+    }
+    if (pacmanCount != 1) {
+        fail(level, -1, "exactly one 'P' expected");
+    }
+    if ((doorCount != 2) || (level->maze[level->door.y][level->door.x + 1] != '-')) {
+        fail(level, -1, "the door must be two '-' side by side");
+    }
+    if ((level->pills == 0) || (level->pills > 255)) {
+        fail(level, -1, "between 1 and 255 pills expected");
+    }
+    if ((level->time == 0) || (level->time > 255) || (level->specials > level->pills)) {
+        fail(level, -1, "time must be 1..255 s and specials at most the pill count");
+    }
+
+    // House: free cells above the door, ghost start cells behind it
+    x = level->door.x;
+    y = level->door.y;
+    if ((y < 1) || (y + 2 >= GAME_MAP_HEIGHT) || (x < 2) || (x + 3 >= GAME_MAP_WIDTH) ||
+        !is_open(level, x, y - 1) || !is_open(level, x + 1, y - 1)) {
+        fail(level, y, "the door needs free cells right above it");
+    }
+    memset(house, 0, sizeof(house));
+    for (i = 0; i < 3; i++) {
+        if (!is_open(level, x + GHOST_START[i][0], y + GHOST_START[i][1])) {
+            fail(level, y + GHOST_START[i][1], "a ghost start cell is not free");
+        }
+        if (!house[y + GHOST_START[i][1]][x + GHOST_START[i][0]]) {
+            flood(level, x + GHOST_START[i][0], y + GHOST_START[i][1], house);
+        }
+    }
+
+    // Connectivity: Pac-Man reaches the whole maze, never the inside of the house
+    memset(maze, 0, sizeof(level->reached));
+    flood(level, level->pacman.x, level->pacman.y, maze);
+    for (y = 0; y < GAME_MAP_HEIGHT; y++) {
+        for (x = 0; x < GAME_MAP_WIDTH; x++) {
+            if (house[y][x] && maze[y][x]) {
+                fail(level, y, "the ghost house opens on the maze outside its door");
+            }
+            if (is_open(level, x, y) && !house[y][x] && !maze[y][x]) {
+                snprintf(message, sizeof(message), "cell in column %d cannot be reached", x);
+                fail(level, y, message);
+            }
+            if (maze[y][x] && (neighbours(level, x, y, next) < 2)) {
+                snprintf(message, sizeof(message), "dead end in column %d", x);
+                fail(level, y, message);
+            }
+        }
+    }
+}
+
+// Dictionary entry of a row, added when it is new
+static unsigned char row_index(const PackLevel* level, int y) {
+    char row[GAME_MAP_WIDTH + 1];
+    unsigned int i;
+
+    memcpy(row, level->maze[y], sizeof(row));
+    for (i = 0; i < GAME_MAP_WIDTH; i++) {
+        if (row[i] == 'P') {
+            row[i] = ' ';   // Spawn points are not part of the packed maze
+        }
+    }
+    for (i = 0; i < dictionaryCount; i++) {
+        if (!memcmp(dictionary[i], row, GAME_MAP_WIDTH)) {
+            return (unsigned char)i;
+        }
+    }
+    if (dictionaryCount == PACK_MAX_ROWS) {
+        fail(level, y, "too many distinct rows in the pack");
+    }
+    memcpy(dictionary[dictionaryCount], row, sizeof(row));
+    return (unsigned char)dictionaryCount++;
+}
+
+// Dictionary entry of a move mask row, added when it is new
+static unsigned char move_row_index(const PackLevel* level, int y, const unsigned char masks[GAME_MAP_WIDTH]) {
+    unsigned int i;
+
+    for (i = 0; i < moveDictionaryCount; i++) {
+        if (!memcmp(moveDictionary[i], masks, GAME_MAP_WIDTH)) {
+            return (unsigned char)i;
+        }
+    }
+    if (moveDictionaryCount == PACK_MAX_ROWS) {
+        fail(level, y, "too many distinct move mask rows in the pack");
+    }
+    memcpy(moveDictionary[moveDictionaryCount], masks, GAME_MAP_WIDTH);
+    return (unsigned char)moveDictionaryCount++;
+}
+
+static int node_at(const PackLevel* level, int x, int y) {
+    unsigned int i;
+
+    for (i = 0; i < level->nodeCount; i++) {
+        if ((level->nodes[i].position.x == x) && (level->nodes[i].position.y == y)) {
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
+// Follow the corridor leaving a junction in a direction up to the next junction
+static void link_node(PackLevel* level, MazeNode* node, int direction) {
+    int next[4][2];
+    int previousX = node->position.x;
+    int previousY = node->position.y;
+    int x;
+    int y;
+    int target;
+    int count;
+    int i;
+    unsigned int length = 1;
+
+    if (!step(level, previousX, previousY, direction, &x, &y)) {
+        node->next[direction] = LEVEL_NO_NODE;
+        node->length[direction] = 0;
+        return;
+    }
+    while ((target = node_at(level, x, y)) < 0) {
+        // Off the junctions every cell has exactly two ways: go on through the one not taken to get here
+        count = neighbours(level, x, y, next);
+        for (i = 0; i < count; i++) {
+            if ((next[i][0] != previousX) || (next[i][1] != previousY)) {
+                break;
+            }
+        }
+        previousX = x;
+        previousY = y;
+        x = next[i][0];
+        y = next[i][1];
+        if (++length > 0xFF) {
+            fail(level, node->position.y, "corridor longer than 255 tiles");
+        }
+    }
+    node->next[direction] = (unsigned char)target;
+    node->length[direction] = (unsigned char)length;
+}
+
+// Shortest distance from a junction to every junction after it (breadth-first over the maze)
+static void measure_node(PackLevel* level, unsigned int from, unsigned char* out) {
+    static int queue[GAME_MAP_HEIGHT * GAME_MAP_WIDTH][2];
+    static int distance[GAME_MAP_HEIGHT][GAME_MAP_WIDTH];
+    int next[4][2];
+    int head = 0;
+    int tail = 0;
+    int count;
+    int i;
+    unsigned int to;
+
+    memset(distance, 0xFF, sizeof(distance));
+    distance[level->nodes[from].position.y][level->nodes[from].position.x] = 0;
+    queue[tail][0] = level->nodes[from].position.x;
+    queue[tail][1] = level->nodes[from].position.y;
+    tail++;
+    while (head < tail) {
+        count = neighbours(level, queue[head][0], queue[head][1], next);
+        for (i = 0; i < count; i++) {
+            if (distance[next[i][1]][next[i][0]] < 0) {
+                distance[next[i][1]][next[i][0]] = distance[queue[head][1]][queue[head][0]] + 1;
+                queue[tail][0] = next[i][0];
+                queue[tail][1] = next[i][1];
+                tail++;
+            }
+        }
+        head++;
+    }
+    for (to = from + 1; to < level->nodeCount; to++) {
+        const int length = distance[level->nodes[to].position.y][level->nodes[to].position.x];
+
+        if ((length < 0) || (length > 0xFF)) {
+            fail(level, level->nodes[to].position.y, "junction farther than 255 tiles");
+        }
+        *out++ = (unsigned char)length;
+    }
+}
+
+// Move masks, tunnel bounds, junctions and the distances between them
+static void compile_level(PackLevel* level) {
+    unsigned char masks[GAME_MAP_WIDTH];
+    unsigned char* distances = level->distances;
+    int nextX;
+    int nextY;
+    int direction;
+    int x;
+    int y;
+    unsigned int i;
+
+    for (y = 0; y < GAME_MAP_HEIGHT; y++) {
+        for (x = 0; x < GAME_MAP_WIDTH; x++) {
+            masks[x] = 0;
+            for (direction = 0; is_open(level, x, y) && (direction < 4); direction++) {
+                if (step(level, x, y, direction, &nextX, &nextY)) {
+                    masks[x] |= 1 << direction;
+                }
+            }
+        }
+        level->moveRows[y] = move_row_index(level, y, masks);
+    }
+
+    // Tunnel: the free corridor from each teleport end to the first junction or pill
+    level->tunnel = (TunnelBounds){.row = LEVEL_NO_TUNNEL, .leftEnd = 0, .rightStart = 0};
+    for (y = 0; y < GAME_MAP_HEIGHT; y++) {
+        if (level->maze[y][0] != '<') {
+            continue;
+        }
+        for (x = 1; (x < GAME_MAP_WIDTH - 1) && (cell_code(level->maze[y][x]) == CELL_FREE); x++);
+        level->tunnel.row = y;
+        level->tunnel.leftEnd = x - 1;
+        for (x = GAME_MAP_WIDTH - 2; (x > level->tunnel.leftEnd) && (cell_code(level->maze[y][x]) == CELL_FREE); x--);
+        level->tunnel.rightStart = x + 1;
+    }
+
+    // Junctions: the cells with three ways or more, and the tile the eaten ghosts head for
+    level->nodeCount = 0;
+    for (y = 0; y < GAME_MAP_HEIGHT; y++) {
+        for (x = 0; x < GAME_MAP_WIDTH; x++) {
+            int next[4][2];
+            const int isHome = (x == level->door.x) && (y == level->door.y - 1);
+
+            if (!level->reached[y][x] || ((neighbours(level, x, y, next) < 3) && !isHome)) {
+                continue;
+            }
+            if (level->nodeCount == PACK_MAX_NODES) {
+                fail(level, y, "too many junctions");
+            }
+            if (isHome) {
+                level->homeNode = level->nodeCount;
+            }
+            level->nodes[level->nodeCount++].position = (Position){.x = x, .y = y};
+        }
+    }
+    for (i = 0; i < level->nodeCount; i++) {
+        for (direction = 0; direction < 4; direction++) {
+            link_node(level, &level->nodes[i], direction);
+        }
+        measure_node(level, i, distances);
+        distances += level->nodeCount - 1 - i;
+    }
+}
+
+// Cells the outline goes around: walls, the door and everything outside the maze
+static int is_solid(const PackLevel* level, int x, int y) {
+    if ((x < 0) || (y < 0) || (x >= GAME_MAP_WIDTH) || (y >= GAME_MAP_HEIGHT)) {
+        return 1;
+    }
+    return (level->maze[y][x] == '#') || (level->maze[y][x] == '-');
+}
+
+static int compare_pieces(const void* first, const void* second) {
+    const OutlinePiece* a = first;
+    const OutlinePiece* b = second;
+
+    return (a->fixed != b->fixed) ? (a->fixed - b->fixed) : (a->from - b->from);
+}
+
+// Sort the pieces of one direction and append them to the outline, joining the ones that touch
+static void merge_pieces(PackLevel* level, OutlinePiece* pieces, unsigned int count, unsigned char vertical) {
+    OutlineSegment* segment;
+    unsigned int i;
+    unsigned int j;
+    int to;
+
+    qsort(pieces, count, sizeof(OutlinePiece), compare_pieces);
+    for (i = 0; i < count; i = j) {
+        to = pieces[i].to;
+        for (j = i + 1; (j < count) && (pieces[j].fixed == pieces[i].fixed) && (pieces[j].from <= to + 1); j++) {
+            if (pieces[j].to > to) {
+                to = pieces[j].to;
+            }
+        }
+        segment = &level->outline[level->outlineCount++];
+        segment->x = (unsigned char)(vertical ? pieces[i].fixed : pieces[i].from);
+        segment->y = (unsigned char)(vertical ? pieces[i].from : pieces[i].fixed);
+        segment->length = (unsigned char)(to - pieces[i].from + 1);
+        segment->vertical = vertical;
+    }
+}
+
+/*
+ * Wall outline: a line LEVEL_OUTLINE_INSET pixels inside every wall edge
+ * that faces a corridor, cut short at the outer corners and bent around
+ * the inner ones, so that each wall block is drawn as one closed shape.
+ */
+static void outline_level(PackLevel* level) {
+    static OutlinePiece horizontal[PACK_MAX_PIECES];
+    static OutlinePiece vertical[PACK_MAX_PIECES];
+    const int near = LEVEL_OUTLINE_INSET;
+    const int far = TILE_SCALE - 1 - LEVEL_OUTLINE_INSET;
+    unsigned int horizontalCount = 0;
+    unsigned int verticalCount = 0;
+    int up, down, left, right;
+    int sx, sy;
+    int px, py;
+    int x, y;
+
+#define ADD_PIECE(list, count, line, start, end) \
+    do { list[count].fixed = (line); list[count].from = (start); list[count].to = (end); count++; } while (0)
+
+    for (y = 0; y < GAME_MAP_HEIGHT; y++) {
+        for (x = 0; x < GAME_MAP_WIDTH; x++) {
+            if (level->maze[y][x] != '#') {
+                continue;
+            }
+            px = x * TILE_SCALE;
+            py = y * TILE_SCALE;
+            up = !is_solid(level, x, y - 1);
+            down = !is_solid(level, x, y + 1);
+            left = !is_solid(level, x - 1, y);
+            right = !is_solid(level, x + 1, y);
+
+            if (up) {
+                ADD_PIECE(horizontal, horizontalCount, py + near, left ? px + near : px, right ? px + far : px + TILE_SCALE - 1);
+            }
+            if (down) {
+                ADD_PIECE(horizontal, horizontalCount, py + far, left ? px + near : px, right ? px + far : px + TILE_SCALE - 1);
+            }
+            if (left) {
+                ADD_PIECE(vertical, verticalCount, px + near, up ? py + near : py, down ? py + far : py + TILE_SCALE - 1);
+            }
+            if (right) {
+                ADD_PIECE(vertical, verticalCount, px + far, up ? py + near : py, down ? py + far : py + TILE_SCALE - 1);
+            }
+
+            // Inner corners: both sides are wall, the diagonal is open
+            for (sy = -1; sy <= 1; sy += 2) {
+                for (sx = -1; sx <= 1; sx += 2) {
+                    if (!is_solid(level, x + sx, y) || !is_solid(level, x, y + sy) || is_solid(level, x + sx, y + sy)) {
+                        continue;
+                    }
+                    ADD_PIECE(horizontal, horizontalCount, (sy < 0) ? py + near : py + far,
+                              (sx < 0) ? px : px + far, (sx < 0) ? px + near : px + TILE_SCALE - 1);
+                    ADD_PIECE(vertical, verticalCount, (sx < 0) ? px + near : px + far,
+                              (sy < 0) ? py : py + far, (sy < 0) ? py + near : py + TILE_SCALE - 1);
+                }
+            }
+        }
+    }
+#undef ADD_PIECE
+
+    level->outlineCount = 0;
+    merge_pieces(level, horizontal, horizontalCount, 0);
+    merge_pieces(level, vertical, verticalCount, 1);
+    if (level->outlineCount > 0xFFFF) {
+        fail(level, -1, "wall outline too long");
+    }
+}
+
+static void read_levels(FILE* file) {
+    char line[LINE_SIZE];
+    unsigned int lineNumber = 0;
+    PackLevel* level = 0;
+    unsigned int row = GAME_MAP_HEIGHT;
+    size_t length;
+
+    while (fgets(line, sizeof(line), file)) {
+        lineNumber++;
+        length = strcspn(line, "\r\n");
+        line[length] = '\0';
+
+        if (row < GAME_MAP_HEIGHT) {
+            if (length != GAME_MAP_WIDTH) {
+                fprintf(stderr, "%s:%u: maze rows are %d characters long\n", sourcePath, lineNumber, GAME_MAP_WIDTH);
+                exit(1);
+            }
+            memcpy(level->maze[row++], line, GAME_MAP_WIDTH + 1);
+            continue;
+        }
+        if ((length == 0) || (line[0] == ';')) {
+            continue;
+        }
+        if (levelCount == PACK_MAX_LEVELS) {
+            fprintf(stderr, "%s:%u: more than %d levels\n", sourcePath, lineNumber, PACK_MAX_LEVELS);
+            exit(1);
+        }
+        level = &levels[levelCount];
+        if ((sscanf(line, "level %u time %u specials %u", &level->number, &level->time, &level->specials) != 3) ||
+            (level->number != levelCount + 1)) {
+            fprintf(stderr, "%s:%u: 'level %u time <s> specials <n>' expected\n", sourcePath, lineNumber, levelCount + 1);
+            exit(1);
+        }
+        level->firstLine = lineNumber + 1;
+        levelCount++;
+        row = 0;
+    }
+    if (row < GAME_MAP_HEIGHT) {
+        fprintf(stderr, "%s: level %u: the maze is cut short\n", sourcePath, levelCount);
+        exit(1);
+    }
+    if (levelCount == 0) {
+        fprintf(stderr, "%s: no level\n", sourcePath);
+        exit(1);
+    }
+}
+
+// Pill columns of every dictionary row
+static void write_row_tables(FILE* out) {
+    unsigned int pills = 0;
+    unsigned int pillCount;
+    unsigned int i;
+    unsigned int x;
+
+    fprintf(out, "// Pill columns of the dictionary rows\n");
+    fprintf(out, "const unsigned char LEVEL_PILL_COLUMNS[] = {\n");
+    for (i = 0; i < dictionaryCount; i++) {
+        fprintf(out, "   ");
+        for (x = 0; x < GAME_MAP_WIDTH; x++) {
+            if ((dictionary[i][x] == '.') || (dictionary[i][x] == 'o')) {
+                fprintf(out, " %u,", x);
+            }
+        }
+        fprintf(out, "   // %u\n", i);
+    }
+    fprintf(out, "};\n\n");
+
+    fprintf(out, "const LevelRowTables LEVEL_ROW_TABLES[] = {\n");
+    for (i = 0; i < dictionaryCount; i++) {
+        pillCount = 0;
+        for (x = 0; x < GAME_MAP_WIDTH; x++) {
+            pillCount += (dictionary[i][x] == '.') || (dictionary[i][x] == 'o');
+        }
+        fprintf(out, "    {%u, %u}%s   // %u\n", pills, pillCount, (i + 1 < dictionaryCount) ? "," : " ", i);
+        pills += pillCount;
+    }
+    fprintf(out, "};\n\n");
+    pillColumnTotal = pills;
+}
+
+// Distinct move mask rows
+static void write_move_rows(FILE* out) {
+    unsigned int i;
+    unsigned int x;
+
+    fprintf(out, "// Distinct move mask rows, two cells per byte (bits: right, left, up, down)\n");
+    fprintf(out, "const unsigned char LEVEL_MOVE_ROWS[][LEVEL_ROW_BYTES] = {\n");
+    for (i = 0; i < moveDictionaryCount; i++) {
+        fprintf(out, "    {");
+        for (x = 0; x < GAME_MAP_WIDTH; x += 2) {
+            fprintf(out, "0x%X%X%s", moveDictionary[i][x], moveDictionary[i][x + 1], (x + 2 < GAME_MAP_WIDTH) ? ", " : "");
+        }
+        fprintf(out, "}%s   // %3u\n", (i + 1 < moveDictionaryCount) ? "," : " ", i);
+    }
+    fprintf(out, "};\n\n");
+}
+
+// Junctions of a level, the distances between them and the wall outline
+static void write_nodes(FILE* out, const PackLevel* level) {
+    const unsigned int distanceCount = level->nodeCount * (level->nodeCount - 1) / 2;
+    const MazeNode* node;
+    unsigned int i;
+
+    fprintf(out, "// Level %u: junctions (position, next junction and corridor length right, left, up, down)\n", level->number);
+    fprintf(out, "static const MazeNode LEVEL_%u_NODES[] = {\n", level->number);
+    for (i = 0; i < level->nodeCount; i++) {
+        node = &level->nodes[i];
+        fprintf(out, "    {{.x = %2u, .y = %2u}, {%3u, %3u, %3u, %3u}, {%2u, %2u, %2u, %2u}}%s   // %u%s\n",
+                node->position.x, node->position.y, node->next[0], node->next[1], node->next[2], node->next[3],
+                node->length[0], node->length[1], node->length[2], node->length[3],
+                (i + 1 < level->nodeCount) ? "," : " ", i, (i == level->homeNode) ? " (home)" : "");
+    }
+    fprintf(out, "};\n\n");
+
+    fprintf(out, "// Level %u: wall outline (x, y, length, vertical) in pixels\n", level->number);
+    fprintf(out, "static const OutlineSegment LEVEL_%u_OUTLINE[] = {", level->number);
+    for (i = 0; i < level->outlineCount; i++) {
+        const OutlineSegment* segment = &level->outline[i];
+
+        fprintf(out, "%s{%u, %u, %u, %u}%s", (i % 6) ? " " : "\n    ", segment->x, segment->y, segment->length, segment->vertical,
+                (i + 1 < level->outlineCount) ? "," : "");
+    }
+    fprintf(out, "\n};\n\n");
+
+    fprintf(out, "// Level %u: junction distances, upper triangle row by row\n", level->number);
+    fprintf(out, "static const unsigned char LEVEL_%u_DISTANCES[] = {", level->number);
+    for (i = 0; i < distanceCount; i++) {
+        fprintf(out, "%s%u%s", (i % 24) ? " " : "\n    ", level->distances[i], (i + 1 < distanceCount) ? "," : "");
+    }
+    fprintf(out, "\n};\n\n");
+}
+
+static void write_pack(FILE* out) {
+    const PackLevel* level;
+    unsigned int i;
+    unsigned int x;
+    unsigned int y;
+
+    fprintf(out, "/* Generated by host/host_maze_pack.c from game_levels.txt: do not edit */\n");
+    fprintf(out, "#include \"game_levels.h\"\n\n");
+    fprintf(out, "const unsigned char LEVEL_PACK_COUNT = %u;\n\n", levelCount);
+
+    fprintf(out, "// Distinct maze rows, two cells per byte\n");
+    fprintf(out, "const unsigned char LEVEL_ROWS[][LEVEL_ROW_BYTES] = {\n");
+    for (i = 0; i < dictionaryCount; i++) {
+        fprintf(out, "    {");
+        for (x = 0; x < GAME_MAP_WIDTH; x += 2) {
+            fprintf(out, "0x%X%X%s", cell_code(dictionary[i][x]), cell_code(dictionary[i][x + 1]),
+                    (x + 2 < GAME_MAP_WIDTH) ? ", " : "");
+        }
+        fprintf(out, "}%s   // %3u %s\n", (i + 1 < dictionaryCount) ? "," : " ", i, dictionary[i]);
+    }
+    fprintf(out, "};\n\n");
+
+    write_row_tables(out);
+    write_move_rows(out);
+    for (i = 0; i < levelCount; i++) {
+        write_nodes(out, &levels[i]);
+    }
+
+    fprintf(out, "const LevelDescriptor LEVEL_PACK[] = {\n");
+    for (i = 0; i < levelCount; i++) {
+        level = &levels[i];
+        fprintf(out, "    {   // Level %u\n        {", level->number);
+        for (y = 0; y < GAME_MAP_HEIGHT; y++) {
+            fprintf(out, "%u%s", level->rows[y], (y + 1 < GAME_MAP_HEIGHT) ? ", " : "");
+        }
+        fprintf(out, "},\n");
+        fprintf(out, "        {.x = %u, .y = %u},   // Pac-Man spawn\n", level->pacman.x, level->pacman.y);
+        fprintf(out, "        {.x = %u, .y = %u},   // Ghost house door\n", level->door.x, level->door.y);
+        fprintf(out, "        %u, %u, %u,          // Pills, special pills, time (s)\n", level->pills, level->specials, level->time);
+        fprintf(out, "        {");
+        for (y = 0; y < GAME_MAP_HEIGHT; y++) {
+            fprintf(out, "%u%s", level->moveRows[y], (y + 1 < GAME_MAP_HEIGHT) ? ", " : "");
+        }
+        fprintf(out, "},\n");
+        fprintf(out, "        {%u, %u, %u},         // Tunnel row, left end, right start\n",
+                level->tunnel.row, level->tunnel.leftEnd, level->tunnel.rightStart);
+        fprintf(out, "        %u, %u,              // Junctions, home junction\n", level->nodeCount, level->homeNode);
+        fprintf(out, "        LEVEL_%u_NODES,\n", level->number);
+        fprintf(out, "        LEVEL_%u_DISTANCES,\n", level->number);
+        fprintf(out, "        %u,\n", level->outlineCount);
+        fprintf(out, "        LEVEL_%u_OUTLINE\n", level->number);
+        fprintf(out, "    }%s\n", (i + 1 < levelCount) ? "," : "");
+    }
+    fprintf(out, "};\n");
+}
+
+int main(int argc, char** argv) {
+    FILE* file;
+    unsigned int i;
+    unsigned int y;
+    unsigned int packedSize;
+    unsigned int tableSize;
+
+    if (argc != 3) {
+        fprintf(stderr, "usage: %s <game_levels.txt> <game_levels_data.c>\n", argv[0]);
+        return 2;
+    }
+    sourcePath = argv[1];
+    file = fopen(sourcePath, "r");
+    if (!file) {
+        fprintf(stderr, "cannot open %s\n", sourcePath);
+        return 2;
+    }
+    read_levels(file);
+    fclose(file);
+
+    for (i = 0; i < levelCount; i++) {
+        check_level(&levels[i]);
+        for (y = 0; y < GAME_MAP_HEIGHT; y++) {
+            levels[i].rows[y] = row_index(&levels[i], y);
+        }
+        compile_level(&levels[i]);
+        outline_level(&levels[i]);
+        outlineTotal += levels[i].outlineCount;
+    }
+
+    file = fopen(argv[2], "w");
+    if (!file) {
+        fprintf(stderr, "cannot write %s\n", argv[2]);
+        return 2;
+    }
+    write_pack(file);
+    if (fclose(file)) {
+        fprintf(stderr, "cannot write %s\n", argv[2]);
+        return 2;
+    }
+
+    packedSize = dictionaryCount * LEVEL_ROW_BYTES + levelCount * sizeof(LevelDescriptor);
+    printf("%u levels, %u distinct rows: %u bytes (%u as raw maps)\n", levelCount, dictionaryCount,
+           packedSize, levelCount * GAME_MAP_HEIGHT * GAME_MAP_WIDTH);
+
+    tableSize = dictionaryCount * sizeof(LevelRowTables) + outlineTotal * sizeof(OutlineSegment) + pillColumnTotal +
+                moveDictionaryCount * LEVEL_ROW_BYTES;
+    for (i = 0; i < levelCount; i++) {
+        tableSize += levels[i].nodeCount * sizeof(MazeNode) + levels[i].nodeCount * (levels[i].nodeCount - 1) / 2;
+    }
+    printf("render and AI tables: %u outline segments, %u pill columns, %u move mask rows, %u bytes\n",
+           outlineTotal, pillColumnTotal, moveDictionaryCount, tableSize);
+    return 0;
+}
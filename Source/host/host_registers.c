@@ -0,0 +1,26 @@
+/*
+ * Host build: peripheral register instances and core state used by the
+ * host LPC17xx.h.
+ */
+#include "LPC17xx.h"
+
+LPC_TIM_TypeDef       host_tim[4];
+LPC_SC_TypeDef        host_sc;
+LPC_GPIO_TypeDef      host_gpio[5];
+LPC_RIT_TypeDef       host_rit;
+LPC_PINCON_TypeDef    host_pincon;
+LPC_DAC_TypeDef       host_dac;
+LPC_CAN_TypeDef       host_can[2];
+LPC_CANAF_TypeDef     host_canaf;
+LPC_CANAF_RAM_TypeDef host_canaf_ram;
+DWT_Type              host_dwt;
+CoreDebug_Type        host_coredebug;
+
+volatile uint32_t host_nvic_enabled = 0;
+volatile uint32_t host_nvic_pending = 0;
+volatile uint32_t host_primask = 0;
+
+uint32_t SystemCoreClock = 100000000;
+
+void SystemInit(void) {
+}
@@ -0,0 +1,264 @@
+/*
+ * Host replay player.
+ *
+ * Plays a stream recorded by main/game/game_replay.c (a RAM dump of the
+ * ring, or the payloads of the REPLAY_CAN_ID frames concatenated) through
+ * the unmodified game core: TIMER0 is the host timer model, the tasks run
+ * from task_run_next() and the LCD is the ILI9325 model. Every input goes
+ * through the entry point its interrupt uses, at the recorded movement
+ * tick, so the game evolves exactly as it did on the board. The core
+ * records the stream again while playing; getting the same bytes back
+ * proves that every input was taken at its original tick.
+ *
+ * Usage: host_replay_player <replay.bin> [-o dir] [-e ticks] [-s] [-t ticks]
+ *                            [-l state.bin] [-w state.bin]
+ *   -o dir    write a PPM frame into dir every -e movement ticks
+ *   -e ticks  frame interval (default 1, every movement tick)
+ *   -s        frame by frame: wait for Enter after every frame
+ *   -t ticks  stop at this movement tick
+ *   -l file   start from a save-state snapshot (main/game/game_snapshot.h),
+ *             the stream is the one recorded after that snapshot
+ *   -w file   save a snapshot of the game where the playback stops
+ *
+ * Build (from Source/, SIMULATOR keeps the HUD on the LCD and CAN silent):
+ *   gcc -std=gnu99 -O2 -DHOST_BUILD -DSIMULATOR -Ihost -I. -Imain -Imain/game \
+ *       -IGLCD -Itimer -o host_replay_player host/host_replay_player.c \
+ *       host/host_registers.c host/host_cycles.c host/host_timer_mock.c \
+ *       host/host_lcd_model.c main/game/game_[a-z]*.c main/event_scheduler.c \
+ *       main/task_scheduler.c main/timer_service.c main/cpu_profiler.c \
+ *       main/game_canComuntication.c main/game_melodies.c main/game_sound.c \
+ *       timer/lib_timer.c timer/IRQ_timer.c CAN/lib_CAN.c GLCD/GLCD.c \
+ *       GLCD/AsciiLib.c
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "host_timer_mock.h"
+#include "host_lcd_model.h"
+#include "GLCD.h"
+#include "timer.h"
+#include "game/game_initializer.h"
+#include "game/game_replay.h"
+#include "game/game_snapshot.h"
+
+#define PLAYER_MAX_STREAM   (1024 * 1024)
+
+void TIMER0_IRQHandler(void);
+
+typedef struct {
+    const char* framesDir;
+    unsigned int frameInterval;
+    unsigned char stepMode;
+    unsigned int maxTicks;
+    const char* loadSnapshot;
+    const char* saveSnapshot;
+} PlayerOptions;
+
+static unsigned char stream[PLAYER_MAX_STREAM];
+static unsigned char rerecorded[PLAYER_MAX_STREAM];
+static unsigned int rerecordedLength = 0;
+
+// Collect what the core recorded again (the ring is never drained in the simulator build)
+static void drain_rerecorded(void) {
+    rerecordedLength += replay_read(&rerecorded[rerecordedLength], PLAYER_MAX_STREAM - rerecordedLength);
+}
+
+static void run_tasks(void) {
+    while (task_run_next());
+    drain_rerecorded();
+}
+
+// Boot the game like main() does, with the recorded seed instead of the hardware one
+static void boot(unsigned short seed) {
+    host_lcd_reset();
+    host_timer_reset();
+    host_timer_attach_handler(SCHEDULER_TIMER_ID, TIMER0_IRQHandler);
+
+    initialize_game_tasks();
+    task_register(TASK_PROFILER_REPORT, 0, TASK_PRIORITY_LOW);   // Keep stdout for the player
+    LCD_Initialization();
+    LCD_Clear(Black);
+    initialize_game_timers();
+    initialize_pacman_game_seeded(seed);
+    run_tasks();
+}
+
+// Resume the game saved in a snapshot file (paused, as after a restore on the board)
+static int load_snapshot(const char* path) {
+    unsigned char blob[SNAPSHOT_MAX_SIZE];
+    unsigned int length;
+    FILE* file = fopen(path, "rb");
+
+    if (!file) {
+        fprintf(stderr, "cannot open %s\n", path);
+        return 0;
+    }
+    length = (unsigned int)fread(blob, 1, sizeof(blob), file);
+    fclose(file);
+    if (!game_restore_snapshot(blob, length)) {
+        fprintf(stderr, "%s is not a valid snapshot (format %u expected)\n", path, SNAPSHOT_FORMAT_VERSION);
+        return 0;
+    }
+    rerecordedLength = 0;   // The restore restarts the recording
+    run_tasks();
+    return 1;
+}
+
+static int save_snapshot(const char* path) {
+    unsigned char blob[SNAPSHOT_MAX_SIZE];
+    const unsigned int length = game_take_snapshot(blob, sizeof(blob));
+    FILE* file;
+
+    if (length == 0) {
+        fprintf(stderr, "no snapshot of an ended game\n");
+        return 0;
+    }
+    file = fopen(path, "wb");
+    if (!file || (fwrite(blob, 1, length, file) != length) || fclose(file)) {
+        fprintf(stderr, "cannot write %s\n", path);
+        return 0;
+    }
+    printf("snapshot of %u bytes written to %s\n", length, path);
+    return 1;
+}
+
+static void write_frame(const PlayerOptions* options, unsigned int tick) {
+    char path[512];
+
+    if (options->framesDir) {
+        snprintf(path, sizeof(path), "%s/frame_%06u.ppm", options->framesDir, tick);
+        if (host_lcd_write_ppm(path) != 0) {
+            fprintf(stderr, "cannot write %s\n", path);
+            exit(2);
+        }
+    }
+    if (options->stepMode) {
+        printf("tick %u  score %u  lives %u  time %u  (Enter: next frame)", tick,
+               gameRunning.score, gameRunning.remainingLives, gameRunning.remainingTime);
+        fflush(stdout);
+        if (getchar() == EOF) {
+            exit(0);
+        }
+    }
+}
+
+static int play(unsigned int length, const PlayerOptions* options) {
+    ReplayReader reader;
+    unsigned short seed;
+    unsigned int tick = 0;
+    ReplayInput input = REPLAY_INPUT_NONE;
+    unsigned char hasRecord;
+    unsigned int lastFrameTick = 0;
+
+    if (!replay_reader_open(&reader, stream, length, &seed)) {
+        fprintf(stderr, "not a replay stream (format %u expected)\n", REPLAY_FORMAT_VERSION);
+        return 2;
+    }
+    boot(seed);
+    if (options->loadSnapshot && !load_snapshot(options->loadSnapshot)) {
+        return 2;
+    }
+    lastFrameTick = game_movement_ticks();
+    write_frame(options, lastFrameTick);
+    hasRecord = replay_reader_next(&reader, &tick, &input);
+
+    while (!gameStatus.isEnded && (game_movement_ticks() < options->maxTicks)) {
+        // Inputs of the coming movement tick: pauses act at once, directions are latched for the tick
+        while (hasRecord && (tick == game_movement_ticks())) {
+            if (input == REPLAY_INPUT_PAUSE) {
+                task_post(TASK_PAUSE_TOGGLE);
+                run_tasks();
+            } else {
+                game_pacman_handle_direction_change((Direction)input);
+            }
+            hasRecord = replay_reader_next(&reader, &tick, &input);
+        }
+
+        if (gameStatus.isPaused || gameStatus.isFailed) {
+            if (hasRecord && (tick < game_movement_ticks())) {
+                fprintf(stderr, "stream out of order at tick %u\n", tick);
+                return 2;
+            }
+            if (!hasRecord || (tick > game_movement_ticks())) {
+                break;   // Waiting for a button press that was never recorded
+            }
+        }
+
+        host_timer_advance_us(SCHEDULER_TICK_MS * 1000);
+        run_tasks();
+
+        if (game_movement_ticks() - lastFrameTick >= options->frameInterval) {
+            lastFrameTick = game_movement_ticks();
+            frame_run();   // Draw what the next frame would, so the dump shows this tick
+            write_frame(options, lastFrameTick);
+        }
+    }
+
+    // Let a scroll wipe still running (GAME OVER, next maze) reach its last band, and the last frame be drawn
+    if (wipe_active() || frame_pending()) {
+        while (wipe_active() || frame_pending()) {
+            host_timer_advance_us(SCHEDULER_TICK_MS * 1000);
+            run_tasks();
+        }
+        write_frame(options, game_movement_ticks());
+    }
+
+    printf("ticks %u  level %u  score %u  lives %u  time %u  pills %u  %s\n",
+           game_movement_ticks(), gameRunning.level, gameRunning.score, gameRunning.remainingLives,
+           gameRunning.remainingTime, gameRunning.remainingPills,
+           gameStatus.isEnded ? "ended" : (gameStatus.isFailed ? "failed" : (gameStatus.isPaused ? "paused" : "running")));
+
+    if (options->saveSnapshot && !save_snapshot(options->saveSnapshot)) {
+        return 2;
+    }
+
+    if ((rerecordedLength > length) || (memcmp(rerecorded, stream, rerecordedLength) != 0)) {
+        printf("input stream NOT reproduced (%u of %u bytes)\n", rerecordedLength, length);
+        return 1;
+    }
+    printf("input stream reproduced (%u of %u bytes)\n", rerecordedLength, length);
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    PlayerOptions options = {0, 1, 0, 0xFFFFFFFF, 0, 0};
+    const char* path = 0;
+    FILE* file;
+    unsigned int length;
+    int i;
+
+    for (i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-o") && (i + 1 < argc)) {
+            options.framesDir = argv[++i];
+        } else if (!strcmp(argv[i], "-e") && (i + 1 < argc)) {
+            options.frameInterval = (unsigned int)atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "-s")) {
+            options.stepMode = 1;
+        } else if (!strcmp(argv[i], "-t") && (i + 1 < argc)) {
+            options.maxTicks = (unsigned int)atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "-l") && (i + 1 < argc)) {
+            options.loadSnapshot = argv[++i];
+        } else if (!strcmp(argv[i], "-w") && (i + 1 < argc)) {
+            options.saveSnapshot = argv[++i];
+        } else if (!path && (argv[i][0] != '-')) {
+            path = argv[i];
+        } else {
+            path = 0;
+            break;
+        }
+    }
+    if (!path || (options.frameInterval == 0)) {
+        fprintf(stderr, "usage: %s <replay.bin> [-o dir] [-e ticks] [-s] [-t ticks] [-l state.bin] [-w state.bin]\n", argv[0]);
+        return 2;
+    }
+
+    file = fopen(path, "rb");
+    if (!file) {
+        fprintf(stderr, "cannot open %s\n", path);
+        return 2;
+    }
+    length = (unsigned int)fread(stream, 1, sizeof(stream), file);
+    fclose(file);
+
+    return play(length, &options);
+}
@@ -0,0 +1,224 @@
+/*
+ * Tile atlas builder.
+ *
+ * Reads the ASCII sprites of main/game/game_tiles.txt and writes the 2 bpp
+ * atlas of main/game/game_tiles.h as a C file, with the rectangle around
+ * the ink of every tile.
+ *
+ * Tile file: lines starting with ';' are comments. Each tile is a line
+ *   tile <name>
+ * followed by 8 rows of 8 pixels:
+ *   '.' background   '#' ink   'o' eye white
+ * The tiles come in TileID order and their names are checked against it
+ * (pill, special_pill, pacman_<direction>_<frame>, ghost_<direction>_<frame>,
+ * eyes_<direction>, directions right, left, up, down).
+ *
+ * Run it again whenever game_tiles.txt changes, the generated file is kept
+ * in the project so that the target build needs no host compiler.
+ *
+ * Usage: host_tile_pack <game_tiles.txt> <game_tiles_data.c>
+ * Exit status: 0 on success, 1 if a tile is rejected, 2 on I/O errors.
+ *
+ * Build (from Source/):
+ *   gcc -std=gnu99 -O2 -Ihost -Imain/game -o host_tile_pack host/host_tile_pack.c
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "game_tiles.h"
+
+#define LINE_SIZE 256
+#define NAME_SIZE 32
+
+typedef struct {
+    char name[NAME_SIZE];
+    unsigned char shades[TILE_SIZE][TILE_SIZE];
+    TileTrim trim;
+} PackTile;
+
+static PackTile tiles[TILE_COUNT];
+static unsigned int tileCount = 0;
+static const char* sourcePath;
+
+static void fail(unsigned int line, const char* message) {
+    fprintf(stderr, "%s:%u: %s\n", sourcePath, line, message);
+    exit(1);
+}
+
+// Name of a tile in TileID order
+static void expected_name(unsigned int index, char* name) {
+    static const char* const DIRECTIONS[4] = { "right", "left", "up", "down" };
+
+    if (index == TILE_PILL) {
+        strcpy(name, "pill");
+    } else if (index == TILE_SPECIAL_PILL) {
+        strcpy(name, "special_pill");
+    } else if (index < TILE_GHOST) {
+        sprintf(name, "pacman_%s_%u", DIRECTIONS[(index - TILE_PACMAN) / 2], (index - TILE_PACMAN) % 2);
+    } else if (index < TILE_EYES) {
+        sprintf(name, "ghost_%s_%u", DIRECTIONS[(index - TILE_GHOST) / 2], (index - TILE_GHOST) % 2);
+    } else {
+        sprintf(name, "eyes_%s", DIRECTIONS[index - TILE_EYES]);
+    }
+}
+
+static int shade_code(char pixel) {
+    switch (pixel) {
+        case '.': return TILE_SHADE_BACKGROUND;
+        case '#': return TILE_SHADE_INK;
+        case 'o': return TILE_SHADE_EYES;
+        default:  return -1;
+    }
+}
+
+static void read_tiles(FILE* file) {
+    char line[LINE_SIZE];
+    char expected[NAME_SIZE];
+    unsigned int lineNumber = 0;
+    unsigned int row = TILE_SIZE;
+    unsigned int x;
+    PackTile* tile = NULL;
+    int shade;
+
+    while (fgets(line, sizeof(line), file)) {
+        lineNumber++;
+        line[strcspn(line, "\r\n")] = '\0';
+        if (line[0] == ';') {
+            continue;
+        }
+        if (row < TILE_SIZE) {
+            if (strlen(line) != TILE_SIZE) {
+                fail(lineNumber, "a tile row is 8 pixels");
+            }
+            for (x = 0; x < TILE_SIZE; x++) {
+                shade = shade_code(line[x]);
+                if (shade < 0) {
+                    fail(lineNumber, "unknown pixel");
+                }
+                tile->shades[row][x] = (unsigned char)shade;
+            }
+            row++;
+            continue;
+        }
+        if (line[0] == '\0') {
+            continue;
+        }
+        if (tileCount == TILE_COUNT) {
+            fail(lineNumber, "more tiles than TileID holds");
+        }
+        tile = &tiles[tileCount];
+        if (sscanf(line, "tile %31s", tile->name) != 1) {
+            fail(lineNumber, "expected a tile header");
+        }
+        expected_name(tileCount, expected);
+        if (strcmp(tile->name, expected) != 0) {
+            fprintf(stderr, "%s:%u: tile %s where TileID expects %s\n", sourcePath, lineNumber, tile->name, expected);
+            exit(1);
+        }
+        tileCount++;
+        row = 0;
+    }
+    if (row < TILE_SIZE) {
+        fail(lineNumber, "incomplete tile");
+    }
+    if (tileCount != TILE_COUNT) {
+        fail(lineNumber, "fewer tiles than TileID holds");
+    }
+}
+
+// Rectangle around the non-background pixels of a tile
+static void trim_tile(PackTile* tile, unsigned int index) {
+    unsigned int x;
+    unsigned int y;
+    int found = 0;
+
+    tile->trim.left = TILE_SIZE - 1;
+    tile->trim.top = TILE_SIZE - 1;
+    tile->trim.right = 0;
+    tile->trim.bottom = 0;
+    for (y = 0; y < TILE_SIZE; y++) {
+        for (x = 0; x < TILE_SIZE; x++) {
+            if (tile->shades[y][x] == TILE_SHADE_BACKGROUND) {
+                continue;
+            }
+            found = 1;
+            tile->trim.left = (x < tile->trim.left) ? x : tile->trim.left;
+            tile->trim.top = (y < tile->trim.top) ? y : tile->trim.top;
+            tile->trim.right = (x > tile->trim.right) ? x : tile->trim.right;
+            tile->trim.bottom = (y > tile->trim.bottom) ? y : tile->trim.bottom;
+        }
+    }
+    if (!found) {
+        fprintf(stderr, "%s: tile %u (%s) is empty\n", sourcePath, index, tile->name);
+        exit(1);
+    }
+}
+
+static void write_atlas(FILE* out) {
+    unsigned int i;
+    unsigned int y;
+    unsigned int x;
+    unsigned int byte;
+
+    fprintf(out, "/* Generated by host/host_tile_pack.c from game_tiles.txt: do not edit */\n");
+    fprintf(out, "#include \"game_tiles.h\"\n\n");
+    fprintf(out, "// %u tiles, %u bits per pixel, rows of %u bytes (leftmost pixel in the high bits)\n",
+            TILE_COUNT, TILE_BITS, TILE_ROW_BYTES);
+    fprintf(out, "const unsigned char TILE_ATLAS[TILE_COUNT][TILE_BYTES] = {\n");
+    for (i = 0; i < tileCount; i++) {
+        fprintf(out, "    {");
+        for (y = 0; y < TILE_SIZE; y++) {
+            for (x = 0; x < TILE_SIZE; x += 8 / TILE_BITS) {
+                byte = (tiles[i].shades[y][x] << 6) | (tiles[i].shades[y][x + 1] << 4) |
+                       (tiles[i].shades[y][x + 2] << 2) | tiles[i].shades[y][x + 3];
+                fprintf(out, "0x%02X%s", byte, ((y + 1 == TILE_SIZE) && (x + 4 == TILE_SIZE)) ? "" : ", ");
+            }
+        }
+        fprintf(out, "}%s   // %2u %s\n", (i + 1 < tileCount) ? "," : " ", i, tiles[i].name);
+    }
+    fprintf(out, "};\n\n");
+
+    fprintf(out, "// Rectangle around the ink of every tile (left, top, right, bottom)\n");
+    fprintf(out, "const TileTrim TILE_TRIMS[TILE_COUNT] = {\n");
+    for (i = 0; i < tileCount; i++) {
+        fprintf(out, "    {%u, %u, %u, %u}%s   // %2u %s\n", tiles[i].trim.left, tiles[i].trim.top, tiles[i].trim.right,
+                tiles[i].trim.bottom, (i + 1 < tileCount) ? "," : " ", i, tiles[i].name);
+    }
+    fprintf(out, "};\n");
+}
+
+int main(int argc, char** argv) {
+    FILE* file;
+    unsigned int i;
+
+    if (argc != 3) {
+        fprintf(stderr, "usage: %s <game_tiles.txt> <game_tiles_data.c>\n", argv[0]);
+        return 2;
+    }
+    sourcePath = argv[1];
+    file = fopen(sourcePath, "r");
+    if (!file) {
+        fprintf(stderr, "cannot open %s\n", sourcePath);
+        return 2;
+    }
+    read_tiles(file);
+    fclose(file);
+    for (i = 0; i < tileCount; i++) {
+        trim_tile(&tiles[i], i);
+    }
+
+    file = fopen(argv[2], "w");
+    if (!file) {
+        fprintf(stderr, "cannot write %s\n", argv[2]);
+        return 2;
+    }
+    write_atlas(file);
+    if (fclose(file)) {
+        fprintf(stderr, "cannot write %s\n", argv[2]);
+        return 2;
+    }
+
+    printf("%u tiles: %u bytes (%u as RGB565)\n", tileCount, tileCount * (TILE_BYTES + (unsigned int)sizeof(TileTrim)),
+           tileCount * TILE_SIZE * TILE_SIZE * 2);
+    return 0;
+}
@@ -0,0 +1,105 @@
+/*
+ * Host check of the timer library.
+ *
+ * Runs lib_timer.c against the timer model (host_timer_mock.h): a period
+ * set in microseconds must come out as the prescaler and match value that
+ * give it, and update_timer_interval must change the period of a running
+ * timer only after its next match (neither the current period nor the
+ * next one is cut short or skipped), while a stopped timer, or a match
+ * without interrupt, takes the new value at once. The handler does what
+ * TIMERn_IRQHandler does on the board: the latched values are applied,
+ * then the flags cleared.
+ *
+ * Usage: host_timer_check
+ *   exit status 0 if every check passes
+ *
+ * Build (from Source/):
+ *   gcc -std=gnu99 -O2 -DHOST_BUILD -Ihost -Itimer -o host_timer_check \
+ *       host/host_timer_check.c host/host_timer_mock.c host/host_registers.c timer/lib_timer.c
+ */
+#include <stdio.h>
+#include "host_timer_mock.h"
+#include "timer.h"
+
+#define CHECK_TIMER   1
+#define MAX_MATCHES   16
+
+static uint64_t matchTimes[MAX_MATCHES];   // Time of each MR0 interrupt, in microseconds
+static unsigned int matches = 0;
+static unsigned int failures = 0;
+
+static void timer_handler(void) {
+    timer_apply_pending_intervals(CHECK_TIMER);   // Before the flags are cleared, as on the board
+    if ((LPC_TIM1->IR & 1) && (matches < MAX_MATCHES)) {
+        matchTimes[matches++] = host_timer_elapsed_cycles() / (HOST_TIMER_PCLK_HZ / 1000000);
+    }
+    LPC_TIM1->IR = LPC_TIM1->IR & 0x0F;
+}
+
+static void check(const char* step, int passed) {
+    printf("%-52s %s\n", step, passed ? "ok" : "FAILED");
+    failures += !passed;
+}
+
+// Interval between two recorded matches, within the model's 1 us step
+static int interval_is(unsigned int index, uint64_t us) {
+    const uint64_t interval = matchTimes[index] - matchTimes[index - 1];
+
+    return (index < matches) && (interval + 1 >= us) && (interval <= us + 1);
+}
+
+// Fresh model and a running timer interrupting and resetting on MR0
+static void start(uint32_t periodUs) {
+    host_timer_reset();
+    host_timer_attach_handler(CHECK_TIMER, timer_handler);
+    matches = 0;
+    init_timer_us(CHECK_TIMER, 0, TIMER_MATCH_INTERRUPT | TIMER_MATCH_RESET, periodUs);
+    reset_timer(CHECK_TIMER);
+    enable_timer(CHECK_TIMER);
+}
+
+int main(void) {
+    uint32_t prescaler;
+    uint32_t interval;
+
+    timer_period_from_us(1000, &prescaler, &interval);
+    check("1 ms: prescaler 0, MR 24999", (prescaler == 0) && (interval == 24999));
+    timer_period_from_us(200000000, &prescaler, &interval);
+    check("200 s: prescaler 1, 200 s of counts", (prescaler == 1) && ((uint64_t)(interval + 1) * 2 == 5000000000ULL));
+
+    start(1000);
+    host_timer_advance_us(10500);
+    check("init_timer_us 1 ms: 10 matches in 10.5 ms", (matches == 10) && interval_is(9, 1000));
+
+    // Longer period asked for half-way through a period: the running one ends on time
+    start(1000);
+    host_timer_advance_us(1500);
+    update_timer_interval(CHECK_TIMER, 0, 2000 * 25 - 1);
+    check("running timer: MR0 unchanged until the match", LPC_TIM1->MR0 == 24999);
+    host_timer_advance_us(5600);
+    check("running timer, 1 ms -> 2 ms: 1, 1, 2, 2 ms", (matches == 4) && interval_is(1, 1000) && interval_is(2, 2000) && interval_is(3, 2000));
+
+    // Shorter period asked when TC is already past it: no period runs to the counter wrap
+    start(2000);
+    host_timer_advance_us(3500);
+    update_timer_interval(CHECK_TIMER, 0, 1000 * 25 - 1);
+    host_timer_advance_us(3600);
+    check("running timer, 2 ms -> 1 ms: 2, 2, 1, 1 ms", (matches == 5) && interval_is(1, 2000) && interval_is(2, 1000) && interval_is(4, 1000));
+
+    start(1000);
+    disable_timer(CHECK_TIMER);
+    update_timer_interval(CHECK_TIMER, 0, 4999);
+    check("stopped timer: MR0 written at once", LPC_TIM1->MR0 == 4999);
+    update_timer_interval(CHECK_TIMER, 1, 777);
+    check("match without interrupt: MR1 written at once", LPC_TIM1->MR1 == 777);
+
+    // A full configuration drops a value still waiting for its match
+    start(1000);
+    host_timer_advance_us(500);
+    update_timer_interval(CHECK_TIMER, 0, 9999);
+    init_timer(CHECK_TIMER, 0, 0, TIMER_MATCH_INTERRUPT | TIMER_MATCH_RESET, 24999);
+    host_timer_advance_us(3000);
+    check("init_timer after an update: the update is dropped", (matches == 3) && interval_is(2, 1000) && (LPC_TIM1->MR0 == 24999));
+
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,198 @@
+#include <string.h>
+#include "host_timer_mock.h"
+
+#define HOST_TIMER_NUM      4
+#define HOST_MATCH_NUM      4
+#define HOST_MAX_NESTED_IRQ 8   // A handler that never clears its flag would spin forever
+#define IR_WRITE_MARKER     0x80000000UL  // Reserved IR bit, set while a handler runs
+
+static const IRQn_Type TIMER_IRQS[HOST_TIMER_NUM] = {TIMER0_IRQn, TIMER1_IRQn, TIMER2_IRQn, TIMER3_IRQn};
+
+static HostTimerHandler handlers[HOST_TIMER_NUM];
+static uint8_t resetPending[HOST_TIMER_NUM];     // TC goes back to 0 on the next count
+static uint32_t interruptCount[HOST_TIMER_NUM];
+static uint64_t elapsedCycles;
+
+// Match register MRn of a timer
+static uint32_t match_value(const LPC_TIM_TypeDef* timer, uint8_t matchReg) {
+    return (&timer->MR0)[matchReg];
+}
+
+// Action bits (interrupt, reset, stop) of a match register
+static uint32_t match_actions(const LPC_TIM_TypeDef* timer, uint8_t matchReg) {
+    return (timer->MCR >> (3 * matchReg)) & 0x07;
+}
+
+// Counts left before TC reaches a match with at least one action
+static uint32_t counts_to_next_event(uint8_t timer_id) {
+    const LPC_TIM_TypeDef* timer = &host_tim[timer_id];
+    uint32_t best = 0xFFFFFFFF;
+    uint32_t distance;
+    uint8_t matchReg;
+
+    if (resetPending[timer_id]) {
+        return 1;
+    }
+
+    for (matchReg = 0; matchReg < HOST_MATCH_NUM; matchReg++) {
+        if (match_actions(timer, matchReg) == 0) {
+            continue;
+        }
+        distance = match_value(timer, matchReg) - timer->TC;
+        if ((distance != 0) && (distance < best)) {
+            best = distance;
+        }
+    }
+    return best;
+}
+
+// Run the handler while the timer keeps an enabled interrupt pending
+static void dispatch_interrupt(uint8_t timer_id) {
+    LPC_TIM_TypeDef* timer = &host_tim[timer_id];
+    unsigned char nested = 0;
+    uint32_t raised;
+
+    while ((timer->IR & 0x0F) && (nested++ < HOST_MAX_NESTED_IRQ)) {
+        if (!(host_nvic_enabled & (1UL << TIMER_IRQS[timer_id])) || host_primask || (handlers[timer_id] == NULL)) {
+            host_nvic_pending |= (1UL << TIMER_IRQS[timer_id]);
+            return;
+        }
+        host_nvic_pending &= ~(1UL << TIMER_IRQS[timer_id]);
+        interruptCount[timer_id]++;
+
+        // IR is write-one-to-clear on the device: the marker bit tells whether the handler wrote it
+        raised = timer->IR & 0x3F;
+        timer->IR = raised | IR_WRITE_MARKER;
+        handlers[timer_id]();
+        if (timer->IR & IR_WRITE_MARKER) {
+            timer->IR = raised;
+        } else {
+            timer->IR = raised & ~timer->IR;
+        }
+    }
+}
+
+// One TC count: reset or increment, then evaluate the match registers
+static void count_once(uint8_t timer_id) {
+    LPC_TIM_TypeDef* timer = &host_tim[timer_id];
+    uint32_t actions;
+    uint8_t matchReg;
+
+    if (resetPending[timer_id]) {
+        resetPending[timer_id] = 0;
+        timer->TC = 0;
+    } else {
+        timer->TC++;
+    }
+
+    for (matchReg = 0; matchReg < HOST_MATCH_NUM; matchReg++) {
+        if (timer->TC != match_value(timer, matchReg)) {
+            continue;
+        }
+        actions = match_actions(timer, matchReg);
+        if (actions & 0x01) {
+            timer->IR |= (1UL << matchReg);
+        }
+        if (actions & 0x04) {
+            timer->TCR &= ~1UL;
+            if (actions & 0x02) {
+                timer->TC = 0;
+            }
+        } else if (actions & 0x02) {
+            resetPending[timer_id] = 1;
+        }
+    }
+
+    dispatch_interrupt(timer_id);
+}
+
+// Advance a single timer by a number of peripheral clocks
+static void advance_timer(uint8_t timer_id, uint64_t cycles) {
+    LPC_TIM_TypeDef* timer = &host_tim[timer_id];
+    uint64_t prescale;
+    uint64_t toNextCount;
+    uint64_t counts;
+    uint32_t distance;
+
+    while (cycles > 0) {
+        // Disabled or held in reset: nothing counts
+        if ((timer->TCR & 0x03) != 0x01) {
+            if (timer->TCR & 0x02) {
+                timer->TC = 0;
+                timer->PC = 0;
+                resetPending[timer_id] = 0;
+            }
+            return;
+        }
+
+        prescale = (uint64_t)timer->PR + 1;
+        toNextCount = prescale - timer->PC;
+        if (cycles < toNextCount) {
+            timer->PC += (uint32_t)cycles;
+            return;
+        }
+        cycles -= toNextCount;
+        timer->PC = 0;
+
+        // Counts available in this slice (the first one is already paid for)
+        counts = 1 + cycles / prescale;
+        distance = counts_to_next_event(timer_id);
+
+        if (counts < distance) {
+            // No match reached: apply every count in one go
+            timer->TC += (uint32_t)counts;
+            cycles -= (counts - 1) * prescale;
+            timer->PC = (uint32_t)cycles;
+            return;
+        }
+
+        // Skip the quiet counts, then evaluate the matching one
+        timer->TC += distance - 1;
+        cycles -= (uint64_t)(distance - 1) * prescale;
+        count_once(timer_id);
+    }
+}
+
+// Back to power-on state: registers cleared, no handler, time zero
+void host_timer_reset(void) {
+    memset((void*)host_tim, 0, sizeof(host_tim));
+    memset(handlers, 0, sizeof(handlers));
+    memset(resetPending, 0, sizeof(resetPending));
+    memset(interruptCount, 0, sizeof(interruptCount));
+    elapsedCycles = 0;
+}
+
+// Install the function called for the interrupts of a timer (usually TIMERn_IRQHandler)
+void host_timer_attach_handler(uint8_t timer_id, HostTimerHandler handler) {
+    if (timer_id < HOST_TIMER_NUM) {
+        handlers[timer_id] = handler;
+    }
+}
+
+// Advance every timer by a number of peripheral clocks, one clock slice at a time
+void host_timer_advance(uint64_t pclkCycles) {
+    uint8_t timer_id;
+
+    // Handlers may reprogram any timer, so all timers move in short lock-step slices
+    while (pclkCycles > 0) {
+        const uint64_t slice = (pclkCycles > 25) ? 25 : pclkCycles;   // 1 us
+
+        for (timer_id = 0; timer_id < HOST_TIMER_NUM; timer_id++) {
+            advance_timer(timer_id, slice);
+        }
+        pclkCycles -= slice;
+        elapsedCycles += slice;
+    }
+}
+
+void host_timer_advance_us(uint64_t microseconds) {
+    host_timer_advance(microseconds * (HOST_TIMER_PCLK_HZ / 1000000));
+}
+
+uint64_t host_timer_elapsed_cycles(void) {
+    return elapsedCycles;
+}
+
+uint32_t host_timer_interrupt_count(uint8_t timer_id) {
+    return (timer_id < HOST_TIMER_NUM) ? interruptCount[timer_id] : 0;
+}
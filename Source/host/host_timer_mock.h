@@ -0,0 +1,33 @@
+#ifndef __HOST_TIMER_MOCK_H
+#define __HOST_TIMER_MOCK_H
+
+#include "LPC17xx.h"
+
+/*
+ * Host model of TIMER0..TIMER3.
+ *
+ * Time only moves when host_timer_advance() is called. The model follows
+ * the device: PC counts peripheral clocks up to PR, TC counts prescaler
+ * periods, a match sets IR (interrupt bit), resets TC on the next count
+ * (reset bit) or clears TCR (stop bit). After every count with a pending
+ * flag, the attached handler runs if the interrupt is enabled in the NVIC
+ * and PRIMASK is clear, exactly like TIMERn_IRQHandler on the board.
+ * Writing IR from the handler clears the written flags, as on the device.
+ *
+ * Build example (from Source/):
+ *   gcc -DHOST_BUILD -Ihost -Itimer my_test.c host/host_registers.c \
+ *       host/host_timer_mock.c timer/lib_timer.c
+ */
+
+#define HOST_TIMER_PCLK_HZ  25000000ULL   // Must match TIMER_PCLK_HZ
+
+typedef void (*HostTimerHandler)(void);
+
+void host_timer_reset(void);
+void host_timer_attach_handler(uint8_t timer_id, HostTimerHandler handler);
+void host_timer_advance(uint64_t pclkCycles);
+void host_timer_advance_us(uint64_t microseconds);
+uint64_t host_timer_elapsed_cycles(void);
+uint32_t host_timer_interrupt_count(uint8_t timer_id);
+
+#endif /* __HOST_TIMER_MOCK_H */
@@ -13,11 +13,14 @@ int main(void)
     // Initialize system clock and other low-level settings
     SystemInit();
 	
+    // Register the game tasks before any interrupt can post them
+    initialize_game_tasks();
+	
 		CAN_Init();
     
     // Initialize and configure the LCD display
     LCD_Initialization();
-    LCD_Clear(Black); // Clear the screen and set background color to black
+    LCD_ClearAsync(Black, 0); // Clear the screen to black by GPDMA while the peripherals are set up
     
     // Initialize joystick inputs for user controls
     joystick_init();
@@ -47,11 +50,8 @@ int main(void)
     LPC_SC->PCON |= 0x1;  // Set the PCON register to enable power-down
     LPC_SC->PCON &= ~(0x2); // Clear the deep-sleep bit
     
-    // Main loop
-    while (1)    
-    {
-        __ASM("wfi"); // Wait for interrupt instruction to reduce power consumption
-    }
+    // Main loop: interrupts post tasks, the scheduler runs them and sleeps (wfi) when idle
+    task_scheduler_run();
 }
 
 /*********************************************************************************************************
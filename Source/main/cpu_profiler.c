@@ -0,0 +1,211 @@
+#include <stdio.h>
+#include "cpu_profiler.h"
+#include "critical_section.h"
+#include "event_scheduler.h"
+#include "../CAN/CAN.h"
+
+static IrqProfile profiles[PROFILE_COUNT];
+static volatile uint32_t preemptedCycles = 0;   // Inclusive cycles of every completed handler
+static uint32_t windowStart = 0;                // Start of the measurement window (scheduler_clock)
+
+static const char* const PROFILE_NAMES[PROFILE_COUNT] = {
+    "TIMER0", "TIMER1", "TIMER2", "TIMER3", "RIT", "CAN", "EINT0", "DMA"
+};
+
+static void write_text(const char* text);
+
+/**
+ * @brief Starts the DWT cycle counter and clears every profile.
+ */
+void profiler_init(void) {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk; // Enable the trace block (DWT)
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    profiler_reset();
+}
+
+/**
+ * @brief Clears the statistics and opens a new measurement window.
+ */
+void profiler_reset(void) {
+    unsigned char id;
+    unsigned char bin;
+
+    ENTER_CRITICAL();
+    for (id = 0; id < PROFILE_COUNT; id++) {
+        profiles[id].count = 0;
+        profiles[id].total = 0;
+        profiles[id].max = 0;
+        for (bin = 0; bin < PROFILER_HISTOGRAM_BINS; bin++) {
+            profiles[id].histogram[bin] = 0;
+        }
+    }
+    windowStart = scheduler_clock();
+    EXIT_CRITICAL();
+}
+
+/**
+ * @brief Entry stamp of an interrupt handler (use PROFILE_IRQ_ENTER).
+ */
+void profiler_enter(ProfileStamp* stamp) {
+    stamp->preempted = preemptedCycles;
+    stamp->start = CPU_CYCLE_COUNT();
+}
+
+/**
+ * @brief Exit stamp of an interrupt handler (use PROFILE_IRQ_EXIT).
+ *
+ * The handler is charged with its elapsed time minus the time of the
+ * handlers that preempted it; its whole elapsed time is then added to
+ * the preemption count seen by the handler it interrupted, if any.
+ */
+void profiler_exit(ProfileID id, const ProfileStamp* stamp) {
+    IrqProfile* profile = &profiles[id];
+    uint32_t elapsed;
+    uint32_t self;
+    uint32_t bin;
+
+    ENTER_CRITICAL();
+    elapsed = CPU_CYCLE_COUNT() - stamp->start;
+    self = elapsed - (preemptedCycles - stamp->preempted);
+    preemptedCycles = stamp->preempted + elapsed;
+
+    profile->count++;
+    profile->total += self;
+    if (self > profile->max) {
+        profile->max = self;
+    }
+
+    bin = self ? (31 - __CLZ(self)) : 0;
+    if (bin >= PROFILER_HISTOGRAM_BINS) {
+        bin = PROFILER_HISTOGRAM_BINS - 1;
+    }
+    if (profile->histogram[bin] != 0xFFFF) {
+        profile->histogram[bin]++;
+    }
+    EXIT_CRITICAL();
+}
+
+/**
+ * @brief Cycles spent in interrupt handlers so far (wraps around).
+ *
+ * Thread-mode code takes the difference around a block of work to remove
+ * the interrupt time from its own measurement.
+ */
+uint32_t profiler_preempted_cycles(void) {
+    return preemptedCycles;
+}
+
+const IrqProfile* profiler_get(ProfileID id) {
+    return &profiles[id];
+}
+
+const char* profiler_name(ProfileID id) {
+    return PROFILE_NAMES[id];
+}
+
+/**
+ * @brief CPU load of a handler in the current window, in per mille of the wall time.
+ *
+ * The window is timed on the scheduler's timer, which keeps counting while
+ * the core sleeps (DWT does not), and must stay shorter than its
+ * revolution (~171 s): it restarts with every report and every pause.
+ */
+unsigned int profiler_load_permille(ProfileID id) {
+    const uint64_t window = SCHEDULER_COUNTS_TO_CYCLES((uint64_t)(scheduler_clock() - windowStart));
+
+    return window ? (unsigned int)((profiles[id].total * 1000) / window) : 0;
+}
+
+/**
+ * @brief Sends one CAN frame per handler that ran in the current window.
+ *
+ * Frame ID PROFILER_CAN_ID_BASE + ProfileID, data (big-endian):
+ * [0..3] worst case cycles, [4..5] calls (saturated), [6..7] load in per mille.
+ */
+void profiler_report_can(uint32_t ctrl) {
+    CAN_msg msg;
+    unsigned char id;
+    uint32_t count;
+    unsigned int load;
+
+    msg.len = 8;
+    msg.format = STANDARD_FORMAT;
+    msg.type = DATA_FRAME;
+
+    for (id = 0; id < PROFILE_COUNT; id++) {
+        if (profiles[id].count == 0) {
+            continue;
+        }
+        count = (profiles[id].count > 0xFFFF) ? 0xFFFF : profiles[id].count;
+        load = profiler_load_permille((ProfileID)id);
+
+        msg.id = PROFILER_CAN_ID_BASE + id;
+        msg.data[0] = (profiles[id].max >> 24) & 0xFF;
+        msg.data[1] = (profiles[id].max >> 16) & 0xFF;
+        msg.data[2] = (profiles[id].max >> 8) & 0xFF;
+        msg.data[3] = profiles[id].max & 0xFF;
+        msg.data[4] = (count >> 8) & 0xFF;
+        msg.data[5] = count & 0xFF;
+        msg.data[6] = (load >> 8) & 0xFF;
+        msg.data[7] = load & 0xFF;
+
+        CAN_waitReady(ctrl);   // CAN_wrMsg drops the frame while the buffer is busy
+        CAN_wrMsg(ctrl, &msg);
+    }
+}
+
+/**
+ * @brief Prints a table of every handler and its non-empty histogram bins.
+ *
+ * On the board the text goes to the debugger through semihosting, on the
+ * host build to stdout.
+ */
+void profiler_report_text(void) {
+    char line[96];
+    unsigned char id;
+    unsigned char bin;
+    int length;
+    uint32_t average;
+
+    write_text("IRQ      calls      avg      max  load(o/oo)\n");
+    for (id = 0; id < PROFILE_COUNT; id++) {
+        const IrqProfile* profile = &profiles[id];
+
+        average = profile->count ? (uint32_t)(profile->total / profile->count) : 0;
+        snprintf(line, sizeof(line), "%-6s %7lu %8lu %8lu %5u\n", PROFILE_NAMES[id],
+                 (unsigned long)profile->count, (unsigned long)average, (unsigned long)profile->max,
+                 profiler_load_permille((ProfileID)id));
+        write_text(line);
+
+        if (profile->count == 0) {
+            continue;
+        }
+        length = snprintf(line, sizeof(line), "       log2:");
+        for (bin = 0; bin < PROFILER_HISTOGRAM_BINS; bin++) {
+            if (profile->histogram[bin] == 0) {
+                continue;
+            }
+            if (length > (int)sizeof(line) - 16) {
+                write_text(line);
+                write_text("\n");
+                length = snprintf(line, sizeof(line), "            ");
+            }
+            length += snprintf(line + length, sizeof(line) - length, " %u:%u", bin, profile->histogram[bin]);
+        }
+        write_text(line);
+        write_text("\n");
+    }
+}
+
+// Semihosting SYS_WRITE0 on the board, stdout on the host
+static void write_text(const char* text) {
+#ifdef HOST_BUILD
+    fputs(text, stdout);
+#else
+    // BKPT without a debugger attached would end in a HardFault
+    if (!(CoreDebug->DHCSR & CoreDebug_DHCSR_C_DEBUGEN_Msk)) {
+        return;
+    }
+    __ASM volatile ("mov r0, #4 \n mov r1, %0 \n bkpt 0xAB" : : "r" (text) : "r0", "r1", "memory");
+#endif
+}
@@ -0,0 +1,79 @@
+#ifndef __CPU_PROFILER_H
+#define __CPU_PROFILER_H
+
+#include "LPC17xx.h"
+
+/*
+ * Interrupt handler profiler.
+ *
+ * Every IRQ handler is wrapped by PROFILE_IRQ_ENTER / PROFILE_IRQ_EXIT, which
+ * stamp the DWT cycle counter. The time spent in handlers that preempted
+ * the current one is subtracted, so each handler is charged only for its
+ * own cycles. Per handler the profiler keeps the number of calls, the
+ * total and worst case cycles and a log2 histogram (bin n counts the calls
+ * that took [2^n, 2^(n+1)) cycles). The load of a handler is its share of
+ * the wall time since the last reset, read on the scheduler's timer.
+ *
+ * In the host build the cycle counter is emulated from the monotonic clock
+ * (see host/host_cycles.c) and the text report goes to stdout instead of
+ * semihosting, so the same reports are produced on Linux.
+ */
+
+#define PROFILER_ENABLED         1     // 0 compiles the IRQ stamps out
+#define PROFILER_HISTOGRAM_BINS  24    // Last bin collects every call >= 2^23 cycles (~84 ms)
+#define PROFILER_CAN_ID_BASE     0x100 // CAN report: one frame per handler, ID = base + ProfileID
+
+/* Cycle counter shared by the profiler and the task scheduler */
+#ifdef HOST_BUILD
+uint32_t host_cycle_count(void);
+#define CPU_CYCLE_COUNT()  host_cycle_count()
+#else
+#define CPU_CYCLE_COUNT()  (DWT->CYCCNT)
+#endif
+
+// Profiled interrupt handlers
+typedef enum {
+    PROFILE_TIMER0  = 0,
+    PROFILE_TIMER1  = 1,
+    PROFILE_TIMER2  = 2,
+    PROFILE_TIMER3  = 3,
+    PROFILE_RIT     = 4,
+    PROFILE_CAN     = 5,
+    PROFILE_EINT0   = 6,
+    PROFILE_DMA     = 7,
+    PROFILE_COUNT
+} ProfileID;
+
+typedef struct {
+    uint32_t count;                                // Calls
+    uint64_t total;                                // Cycles spent in the handler itself
+    uint32_t max;                                  // Worst single call
+    uint16_t histogram[PROFILER_HISTOGRAM_BINS];   // log2 distribution (saturating)
+} IrqProfile;
+
+// Stamp taken when a handler starts
+typedef struct {
+    uint32_t start;       // Cycle counter on entry
+    uint32_t preempted;   // Nested handler cycles already accounted on entry
+} ProfileStamp;
+
+void profiler_init(void);
+void profiler_reset(void);
+void profiler_enter(ProfileStamp* stamp);
+void profiler_exit(ProfileID id, const ProfileStamp* stamp);
+uint32_t profiler_preempted_cycles(void);
+const IrqProfile* profiler_get(ProfileID id);
+const char* profiler_name(ProfileID id);
+unsigned int profiler_load_permille(ProfileID id);
+void profiler_report_can(uint32_t ctrl);
+void profiler_report_text(void);
+
+#if PROFILER_ENABLED
+#define PROFILE_IRQ_ENTER(id)   ProfileStamp profileStamp; profiler_enter(&profileStamp)
+#define PROFILE_IRQ_EXIT(id)    profiler_exit((id), &profileStamp)
+#else
+#define PROFILE_IRQ_ENTER(id)
+#define PROFILE_IRQ_EXIT(id)
+#endif
+
+#endif /* __CPU_PROFILER_H */
@@ -0,0 +1,18 @@
+#ifndef __CRITICAL_SECTION_H
+#define __CRITICAL_SECTION_H
+
+#include "LPC17xx.h"
+
+/*
+ * Critical section shared by the schedulers, the profiler and the game.
+ *
+ * The caller's PRIMASK is saved and restored rather than the interrupts
+ * re-enabled, so a section opened from a handler or inside another section
+ * leaves them as it found them. ENTER_CRITICAL declares the saved mask: one
+ * section per block.
+ */
+
+#define ENTER_CRITICAL() uint32_t primask = __get_PRIMASK(); __disable_irq()
+#define EXIT_CRITICAL()  __set_PRIMASK(primask)
+
+#endif /* __CRITICAL_SECTION_H */
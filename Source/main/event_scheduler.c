@@ -0,0 +1,431 @@
+#include "event_scheduler.h"
+#include "critical_section.h"
+#include "../timer/timer.h"
+
+#define EVENT_NONE 0xFF // Terminates a slot list
+#define SCHEDULER_TIMER TIMER_PERIPHERAL(SCHEDULER_TIMER_ID)
+
+// Lifecycle of a scheduled event
+typedef enum {
+    EVENT_STATE_IDLE   = 0, // Not scheduled
+    EVENT_STATE_ARMED  = 1, // Linked in the wheel, waiting for its deadline
+    EVENT_STATE_FROZEN = 2  // Suspended, keeps the ticks it still had to wait
+} EventState;
+
+typedef struct {
+    EventCallback callback;     // Function invoked when the deadline is reached
+    unsigned int deadline;      // Absolute tick of the next expiry
+    unsigned int period;        // Reload value in ticks (0 for one-shot events)
+    unsigned int remaining;     // Ticks left when the event was frozen
+    unsigned char next;         // Next event hashed in the same slot
+    unsigned char state;        // EventState
+} ScheduledEvent;
+
+static ScheduledEvent events[EVENT_COUNT];
+static unsigned char wheel[SCHEDULER_WHEEL_SLOTS];  // Head of each slot list
+static unsigned int slotBitmap = 0;                 // Bit n set when slot n is not empty
+static unsigned int frozenMask = 0;                 // Events that must not run
+static volatile unsigned int pendingFireMask = 0;   // Expired events still to be dispatched
+static unsigned int thawFireMask = 0;               // Expiries collected before a freeze, dispatched on thaw
+static unsigned int lastProcessedTick = 0;          // Every tick up to this one has been handled
+static unsigned int nextDeadline = 0;               // Value currently loaded in MR0
+static unsigned char nextDeadlineValid = 0;         // MR0 holds a real deadline
+
+static void wheel_insert(unsigned char id);
+static void wheel_remove(unsigned char id);
+static void arm_if_sooner(unsigned int deadline);
+static void program_next_deadline(void);
+static unsigned int next_due_tick(unsigned int now);
+static void collect_due_events(unsigned int tick);
+static void dispatch_pending_events(void);
+
+/**
+ * @brief Resets the wheel and starts TIMER0 as a free running tick counter.
+ *
+ * The match register only raises an interrupt (no reset, no stop), so the
+ * counter keeps absolute time and MR0 can be moved to any future deadline.
+ */
+void scheduler_init(void) {
+    unsigned char i;
+
+    for (i = 0; i < SCHEDULER_WHEEL_SLOTS; i++) {
+        wheel[i] = EVENT_NONE;
+    }
+    for (i = 0; i < EVENT_COUNT; i++) {
+        events[i].callback = 0;
+        events[i].state = EVENT_STATE_IDLE;
+        events[i].next = EVENT_NONE;
+    }
+    slotBitmap = 0;
+    frozenMask = 0;
+    pendingFireMask = 0;
+    thawFireMask = 0;
+    lastProcessedTick = 0;
+    nextDeadlineValid = 0;
+
+    init_timer(SCHEDULER_TIMER_ID, SCHEDULER_TICK_PRESCALER, 0, 1, 0xFFFFFFFF); // Interrupt on MR0 only
+    reset_timer(SCHEDULER_TIMER_ID);
+    enable_timer(SCHEDULER_TIMER_ID);
+}
+
+/**
+ * @brief Current scheduler time in ticks.
+ */
+unsigned int scheduler_now(void) {
+    return SCHEDULER_TIMER->TC;
+}
+
+/**
+ * @brief Wall clock in timer counts (1 / SCHEDULER_TIMER_CLOCK_HZ s), wraps every ~171 s.
+ *
+ * The prescale counter gives the position inside the current tick. Unlike
+ * the DWT cycle counter the timer keeps counting while the core sleeps.
+ */
+unsigned int scheduler_clock(void) {
+    unsigned int ticks;
+    unsigned int counts;
+
+    do {
+        ticks = SCHEDULER_TIMER->TC;
+        counts = SCHEDULER_TIMER->PC;
+    } while (ticks != SCHEDULER_TIMER->TC);   // PC wrapped between the two reads
+    return ticks * (SCHEDULER_TICK_PRESCALER + 1) + counts;
+}
+
+/**
+ * @brief Schedules (or reschedules) an event.
+ *
+ * @param id The event to arm. A pending instance of the same event is replaced.
+ * @param callback Function to invoke on expiry.
+ * @param delayTicks Ticks before the first expiry (at least one).
+ * @param periodTicks Reload value for periodic events, 0 for a one-shot event.
+ */
+void scheduler_start_event(EventID id, EventCallback callback, unsigned int delayTicks, unsigned int periodTicks) {
+    ENTER_CRITICAL();
+
+    if (events[id].state == EVENT_STATE_ARMED) {
+        wheel_remove(id);
+    }
+    pendingFireMask &= ~EVENT_MASK(id);
+    thawFireMask &= ~EVENT_MASK(id);
+
+    events[id].callback = callback;
+    events[id].period = periodTicks;
+    if (delayTicks == 0) {
+        delayTicks = 1;
+    }
+
+    if (frozenMask & EVENT_MASK(id)) {
+        // Started while suspended: it will begin counting on thaw
+        events[id].remaining = delayTicks;
+        events[id].state = EVENT_STATE_FROZEN;
+    } else {
+        events[id].deadline = scheduler_now() + delayTicks;
+        events[id].state = EVENT_STATE_ARMED;
+        wheel_insert(id);
+        arm_if_sooner(events[id].deadline);
+    }
+
+    EXIT_CRITICAL();
+}
+
+/**
+ * @brief Removes an event from the wheel, including an expiry not yet dispatched.
+ */
+void scheduler_cancel_event(EventID id) {
+    ENTER_CRITICAL();
+
+    if (events[id].state == EVENT_STATE_ARMED) {
+        wheel_remove(id);
+    }
+    events[id].state = EVENT_STATE_IDLE;
+    pendingFireMask &= ~EVENT_MASK(id);
+    thawFireMask &= ~EVENT_MASK(id);
+
+    EXIT_CRITICAL();
+}
+
+/**
+ * @brief Changes the reload value of a periodic event.
+ *
+ * The current deadline is kept, the new period applies from the next expiry,
+ * so the event never stalls or fires twice because of the change.
+ */
+void scheduler_set_event_period(EventID id, unsigned int periodTicks) {
+    events[id].period = periodTicks ? periodTicks : 1;
+}
+
+/**
+ * @brief Tells if an event is waiting for its deadline (frozen events included).
+ */
+unsigned char scheduler_event_is_active(EventID id) {
+    return (events[id].state != EVENT_STATE_IDLE) || ((pendingFireMask | thawFireMask) & EVENT_MASK(id));
+}
+
+/**
+ * @brief Ticks an event still has to wait before its next expiry.
+ *
+ * Frozen events report the time they will wait once thawed. An expiry
+ * already collected but not dispatched yet counts as one tick.
+ *
+ * @return Ticks left (at least one), 0 if the event is not scheduled.
+ */
+unsigned int scheduler_event_remaining(EventID id) {
+    unsigned int remaining = 0;
+    const unsigned int now = scheduler_now();
+    ENTER_CRITICAL();
+
+    if ((pendingFireMask | thawFireMask) & EVENT_MASK(id)) {
+        remaining = 1;
+    } else if (events[id].state == EVENT_STATE_ARMED) {
+        remaining = ((int)(events[id].deadline - now) > 0) ? (events[id].deadline - now) : 1;
+    } else if (events[id].state == EVENT_STATE_FROZEN) {
+        remaining = events[id].remaining;
+    }
+
+    EXIT_CRITICAL();
+    return remaining;
+}
+
+/**
+ * @brief Suspends a group of events, remembering how long each one still had to wait.
+ *
+ * An expiry already collected but not dispatched yet is kept as well (a
+ * periodic event has been re-armed for its next deadline by then): it
+ * fires right after the thaw, so no second or movement step is lost.
+ */
+void scheduler_freeze_events(unsigned int eventMask) {
+    unsigned char id;
+    const unsigned int now = scheduler_now();
+    ENTER_CRITICAL();
+
+    for (id = 0; id < EVENT_COUNT; id++) {
+        if (!(eventMask & EVENT_MASK(id))) {
+            continue;
+        }
+        if (events[id].state == EVENT_STATE_ARMED) {
+            wheel_remove(id);
+            events[id].remaining = ((int)(events[id].deadline - now) > 0) ? (events[id].deadline - now) : 1;
+            events[id].state = EVENT_STATE_FROZEN;
+        }
+    }
+    thawFireMask |= pendingFireMask & eventMask;
+    pendingFireMask &= ~eventMask;
+    frozenMask |= eventMask;
+
+    EXIT_CRITICAL();
+}
+
+/**
+ * @brief Resumes a group of frozen events with the time they had left.
+ */
+void scheduler_thaw_events(unsigned int eventMask) {
+    unsigned char id;
+    const unsigned int now = scheduler_now();
+    ENTER_CRITICAL();
+
+    frozenMask &= ~eventMask;
+    for (id = 0; id < EVENT_COUNT; id++) {
+        if ((eventMask & EVENT_MASK(id)) && events[id].state == EVENT_STATE_FROZEN) {
+            events[id].deadline = now + events[id].remaining;
+            events[id].state = EVENT_STATE_ARMED;
+            wheel_insert(id);
+            arm_if_sooner(events[id].deadline);
+        }
+    }
+    if (thawFireMask & eventMask) {
+        // The expiries kept by the freeze go out with the next tick
+        pendingFireMask |= thawFireMask & eventMask;
+        thawFireMask &= ~eventMask;
+        arm_if_sooner(now + 1);
+    }
+
+    EXIT_CRITICAL();
+}
+
+/**
+ * @brief Runs every event whose deadline has been reached, then reloads MR0.
+ *
+ * Runs in thread mode as TASK_GAME_TICK: the TIMER0 match interrupt only
+ * posts the task, so the callbacks can be preempted by any interrupt, and
+ * an interrupt may start or cancel events meanwhile (hence the critical
+ * sections around the wheel). Every tick holding a deadline is visited in
+ * order, so a late run (the task waited behind a long redraw) still fires
+ * every periodic event the right number of times and keeps their phase;
+ * the ticks with nothing due are skipped, so waking up after a long idle
+ * stretch (a pause, the game over screen) costs a single visit.
+ */
+void scheduler_process_expired(void) {
+    unsigned char isLate;
+
+    do {
+        while ((int)(scheduler_now() - lastProcessedTick) > 0) {
+            lastProcessedTick = next_due_tick(scheduler_now());
+            collect_due_events(lastProcessedTick);
+            dispatch_pending_events();
+        }
+
+        {
+            ENTER_CRITICAL();
+            program_next_deadline();
+            // The counter may have reached the new deadline while it was being written
+            isLate = nextDeadlineValid && ((int)(scheduler_now() - nextDeadline) >= 0);
+            EXIT_CRITICAL();
+        }
+    } while (isLate);
+}
+
+// Links an armed event in the slot of its deadline
+static void wheel_insert(unsigned char id) {
+    const unsigned char slot = events[id].deadline & SCHEDULER_WHEEL_MASK;
+
+    events[id].next = wheel[slot];
+    wheel[slot] = id;
+    slotBitmap |= (1UL << slot);
+}
+
+// Unlinks an armed event from its slot
+static void wheel_remove(unsigned char id) {
+    const unsigned char slot = events[id].deadline & SCHEDULER_WHEEL_MASK;
+    unsigned char* link = &wheel[slot];
+
+    while (*link != EVENT_NONE) {
+        if (*link == id) {
+            *link = events[id].next;
+            break;
+        }
+        link = &events[*link].next;
+    }
+    events[id].next = EVENT_NONE;
+
+    if (wheel[slot] == EVENT_NONE) {
+        slotBitmap &= ~(1UL << slot);
+    }
+}
+
+// Moves MR0 earlier when a new deadline comes before the programmed one
+static void arm_if_sooner(unsigned int deadline) {
+    if (nextDeadlineValid && (int)(deadline - nextDeadline) >= 0) {
+        return;
+    }
+    nextDeadline = deadline;
+    nextDeadlineValid = 1;
+    SCHEDULER_TIMER->MR0 = deadline;
+
+    if ((int)(scheduler_now() - deadline) >= 0) {
+        // Too late for this match: take the very next tick instead
+        nextDeadline = scheduler_now() + 1;
+        SCHEDULER_TIMER->MR0 = nextDeadline;
+    }
+}
+
+// Finds the closest deadline and loads it in MR0 (the timer sleeps if nothing is armed)
+static void program_next_deadline(void) {
+    const unsigned int now = lastProcessedTick;
+    unsigned int pendingSlots;
+    unsigned int distance;
+    unsigned char id;
+    unsigned char found = 0;
+
+    // Rotate the bitmap so that bit 0 is the slot of the next tick
+    const unsigned char firstSlot = (now + 1) & SCHEDULER_WHEEL_MASK;
+    pendingSlots = firstSlot ? ((slotBitmap >> firstSlot) | (slotBitmap << (SCHEDULER_WHEEL_SLOTS - firstSlot))) : slotBitmap;
+
+    if (pendingFireMask) {
+        // Expiries released by a thaw: dispatched with the next tick
+        nextDeadline = now + 1;
+        found = 1;
+    }
+
+    for (distance = 1; pendingSlots && !found; distance++, pendingSlots >>= 1) {
+        if (!(pendingSlots & 1)) {
+            continue;
+        }
+        for (id = wheel[(now + distance) & SCHEDULER_WHEEL_MASK]; id != EVENT_NONE; id = events[id].next) {
+            if (events[id].deadline == now + distance) {
+                nextDeadline = now + distance;
+                found = 1;
+                break;
+            }
+        }
+    }
+
+    if (!found) {
+        // Only deadlines beyond one revolution are left (or none at all)
+        for (id = 0; id < EVENT_COUNT; id++) {
+            if (events[id].state != EVENT_STATE_ARMED) {
+                continue;
+            }
+            if (!found || (int)(events[id].deadline - nextDeadline) < 0) {
+                nextDeadline = events[id].deadline;
+                found = 1;
+            }
+        }
+    }
+
+    nextDeadlineValid = found;
+    SCHEDULER_TIMER->MR0 = found ? nextDeadline : (now - 1); // Idle: the match is a full counter wrap away
+}
+
+// First tick after lastProcessedTick holding a deadline, or now if none is due by then
+static unsigned int next_due_tick(unsigned int now) {
+    unsigned int tick = now;
+    unsigned char id;
+    ENTER_CRITICAL();
+
+    for (id = 0; id < EVENT_COUNT; id++) {
+        if ((events[id].state == EVENT_STATE_ARMED) && ((int)(events[id].deadline - tick) < 0)
+            && ((int)(events[id].deadline - lastProcessedTick) > 0)) {
+            tick = events[id].deadline;
+        }
+    }
+
+    EXIT_CRITICAL();
+    return tick;
+}
+
+// Detaches the events expiring on the given tick and re-arms the periodic ones
+static void collect_due_events(unsigned int tick) {
+    const unsigned char slot = tick & SCHEDULER_WHEEL_MASK;
+    unsigned char id;
+    unsigned char next;
+    ENTER_CRITICAL();
+
+    for (id = wheel[slot]; id != EVENT_NONE; id = next) {
+        next = events[id].next;
+        if (events[id].deadline != tick) {
+            continue; // Belongs to a later revolution
+        }
+
+        wheel_remove(id);
+        if (events[id].period) {
+            events[id].deadline += events[id].period;
+            wheel_insert(id);
+        } else {
+            events[id].state = EVENT_STATE_IDLE;
+        }
+        pendingFireMask |= EVENT_MASK(id);
+    }
+
+    EXIT_CRITICAL();
+}
+
+// Invokes the callbacks of the collected events in EventID order
+static void dispatch_pending_events(void) {
+    unsigned char id;
+    EventCallback callback;
+
+    for (id = 0; id < EVENT_COUNT; id++) {
+        {
+            ENTER_CRITICAL();
+            // A previous callback may have cancelled or frozen this event
+            callback = (pendingFireMask & EVENT_MASK(id)) ? events[id].callback : 0;
+            pendingFireMask &= ~EVENT_MASK(id);
+            EXIT_CRITICAL();
+        }
+
+        if (callback) {
+            callback();
+        }
+    }
+}
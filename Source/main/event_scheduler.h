@@ -0,0 +1,61 @@
+#ifndef __EVENT_SCHEDULER_H
+#define __EVENT_SCHEDULER_H
+
+#include "LPC17xx.h"
+
+/*
+ * Tickless timing-wheel scheduler.
+ *
+ * A single hardware timer (TIMER0) runs free at SCHEDULER_TICK_MS per count
+ * and its MR0 is always programmed to the next pending deadline, so the core
+ * only wakes up when an event is actually due. Events are hashed into
+ * SCHEDULER_WHEEL_SLOTS slots by deadline; deadlines further away than one
+ * revolution simply stay in their slot until the wheel comes around to them.
+ */
+
+/* Scheduler time base */
+#define SCHEDULER_TIMER_ID          0                     // Hardware timer driving the wheel
+#define SCHEDULER_TIMER_CLOCK_HZ    25000000              // Timer peripheral clock (CCLK / 4)
+#define SCHEDULER_TICK_MS           10                    // Duration of a single wheel tick
+#define SCHEDULER_TICK_PRESCALER    ((SCHEDULER_TIMER_CLOCK_HZ / 1000) * SCHEDULER_TICK_MS - 1)
+#define SCHEDULER_WHEEL_SLOTS       32                    // Must be a power of two (one bit per slot)
+#define SCHEDULER_WHEEL_MASK        (SCHEDULER_WHEEL_SLOTS - 1)
+
+/* Conversion helpers (results are never shorter than a single tick) */
+#define SCHEDULER_MS_TO_TICKS(ms) \
+    ((((ms) + (SCHEDULER_TICK_MS / 2)) / SCHEDULER_TICK_MS) ? (((ms) + (SCHEDULER_TICK_MS / 2)) / SCHEDULER_TICK_MS) : 1)
+#define SCHEDULER_SECONDS_TO_TICKS(s) SCHEDULER_MS_TO_TICKS((s) * 1000)
+#define SCHEDULER_COUNTS_TO_TICKS(counts) SCHEDULER_MS_TO_TICKS((counts) / (SCHEDULER_TIMER_CLOCK_HZ / 1000))
+#define SCHEDULER_COUNTS_TO_CYCLES(counts) ((counts) * (SystemCoreClock / SCHEDULER_TIMER_CLOCK_HZ))
+
+// Scheduled events (the ID is also the firing order inside a single tick)
+typedef enum {
+    EVENT_MOVEMENT_TICK           = 0, // Every actor progresses towards its next tile
+    EVENT_GAME_CLOCK              = 1, // One second of game time elapsed
+    EVENT_SPECIAL_PILL            = 2, // Attempt to generate a special pill
+    EVENT_GHOST_ACCELERATION      = 3, // The ghosts become faster
+    EVENT_NOTE_END                = 4, // The note being played is over
+    EVENT_SCREEN_WIPE             = 5, // Next band of a scroll wipe (see game_wipe.h)
+    EVENT_FRAME                   = 6, // Draw the pending frame (see game_frame.h)
+    EVENT_HUD                     = 7, // Next HUD update (see game_hud.h)
+    EVENT_SCORE_POPUP             = 8, // Take the score pop-up off the maze
+    EVENT_COUNT
+} EventID;
+
+#define EVENT_MASK(id) (1UL << (id))
+
+typedef void (*EventCallback)(void);
+
+void scheduler_init(void);
+void scheduler_start_event(EventID id, EventCallback callback, unsigned int delayTicks, unsigned int periodTicks);
+void scheduler_cancel_event(EventID id);
+void scheduler_set_event_period(EventID id, unsigned int periodTicks);
+unsigned char scheduler_event_is_active(EventID id);
+unsigned int scheduler_event_remaining(EventID id);
+void scheduler_freeze_events(unsigned int eventMask);
+void scheduler_thaw_events(unsigned int eventMask);
+unsigned int scheduler_now(void);
+unsigned int scheduler_clock(void);
+void scheduler_process_expired(void);
+
+#endif /* __EVENT_SCHEDULER_H */
@@ -0,0 +1,685 @@
+#include "game_band.h"
+#include "game_frame.h"
+#include "game_levels.h"
+#include "game_renderer.h"
+#include "../cpu_profiler.h"
+
+#define BAND_STRIP_WIDTH (BAND_STRIP_CELLS * TILE_SIZE)   // Pixels per strip line
+#define LABEL_GLYPH_WIDTH  3                                 // Pop-up digits: 3 x 5 pixels, one column apart
+#define LABEL_GLYPH_HEIGHT 5
+#define LABEL_ADVANCE      (LABEL_GLYPH_WIDTH + 1)
+
+// A sprite as it is to be shown, or as it is on the screen
+typedef struct {
+    Position position;      // Cell of the actor
+    signed char offsetX;    // Pixels from the cell (an actor still sliding in from its previous cell)
+    signed char offsetY;
+    TileID tile;
+    PaletteEntry ink;
+    unsigned char visible;
+} BandSprite;
+
+// A label over the maze (a score pop-up), centred on a cell
+typedef struct {
+    Position position;
+    unsigned char digits[BAND_LABEL_DIGITS];   // Most significant first
+    unsigned char length;
+    PaletteEntry ink;
+    unsigned char visible;
+} BandLabel;
+
+// Maze pixels of an area to redraw (bounds included)
+typedef struct {
+    short left;
+    short top;
+    short right;
+    short bottom;
+} BandArea;
+
+// Cycles a flush may take (unlimited for a flush before a direct draw)
+typedef struct {
+    unsigned char limited;
+    unsigned char sent;     // A burst went out (the first one always does)
+    uint32_t start;
+    uint32_t cycles;
+} BandBudget;
+
+static BandSprite sprites[ACTOR_COUNT];             // As they are to be shown
+static BandSprite shown[ACTOR_COUNT];               // As they were sent
+static unsigned char changedSprites = 0;            // One bit per actor to be shown differently
+static unsigned char redrawnSprites = 0;            // One bit per actor shown again (the screen under it may have been drawn over)
+static unsigned char drawOrder[ACTOR_COUNT] = { ACTOR_PACMAN, ACTOR_BLINKY, ACTOR_PINKY, ACTOR_INKY, ACTOR_CLYDE, ACTOR_FRUIT };   // Bottom to top
+static unsigned int dirtyRows[GAME_MAP_HEIGHT];     // One bit per cell of a maze row
+static unsigned int sentRows[GAME_MAP_HEIGHT];      // Cells sent by the flush running (the sprites are already on them)
+static unsigned int shadowRows[GAME_MAP_HEIGHT];    // Cells whose screen pixels are known (one bit per cell)
+static uint32_t shadow[GAME_MAP_HEIGHT][GAME_MAP_WIDTH];   // Signature of the pixels on each known cell
+static unsigned short dirtyCells = 0;
+static unsigned char nextRow = 0;                   // Where the next flush starts (after a spill)
+static BandLabel label;                             // As it is to be shown
+static BandLabel shownLabel;                        // As it was sent
+static unsigned char changedLabel = 0;
+static unsigned short strip[BAND_LINES][BAND_STRIP_WIDTH];
+
+// Pop-up digits, one row of three pixels per byte (bit 2: left)
+static const unsigned char LABEL_GLYPHS[10][LABEL_GLYPH_HEIGHT] = {
+    { 7, 5, 5, 5, 7 }, { 2, 6, 2, 2, 7 }, { 7, 1, 7, 4, 7 }, { 7, 1, 7, 1, 7 }, { 5, 5, 7, 1, 1 },
+    { 7, 4, 7, 1, 7 }, { 7, 4, 7, 5, 7 }, { 7, 1, 1, 1, 1 }, { 7, 5, 7, 5, 7 }, { 7, 5, 7, 1, 7 }
+};
+
+static unsigned char same_position(Position first, Position second) {
+    return (first.x == second.x) && (first.y == second.y);
+}
+
+static unsigned char same_sprite(const BandSprite* first, const BandSprite* second) {
+    if (!first->visible || !second->visible) {
+        return first->visible == second->visible;
+    }
+    return same_position(first->position, second->position) && (first->offsetX == second->offsetX) &&
+           (first->offsetY == second->offsetY) && (first->tile == second->tile) && (first->ink == second->ink);
+}
+
+// Nothing was waiting for the frame: ask for one
+static void band_request(void) {
+    if ((dirtyCells == 0) && (changedSprites == 0) && !changedLabel) {
+        frame_request(FRAME_CELLS);
+    }
+}
+
+// The first change asks for a frame, a cell already dirty is merged
+static void band_mark(Position position) {
+    const unsigned int cell = 1U << position.x;
+
+    if (dirtyRows[position.y] & cell) {
+        frame_count_merged();
+        return;
+    }
+    band_request();
+    dirtyRows[position.y] |= cell;
+    dirtyCells++;
+}
+
+// A sprite is to be shown differently: its old and new places are redrawn at the next flush
+static void band_touch(ActorID actor) {
+    if (changedSprites & ACTOR_MASK(actor)) {
+        frame_count_merged();
+        return;
+    }
+    band_request();
+    changedSprites |= ACTOR_MASK(actor);
+}
+
+// Move an actor to the top of the draw order
+static void band_raise(ActorID actor) {
+    unsigned char i;
+
+    for (i = 0; drawOrder[i] != actor; i++) {
+    }
+    for (; i + 1 < ACTOR_COUNT; i++) {
+        drawOrder[i] = drawOrder[i + 1];
+    }
+    drawOrder[ACTOR_COUNT - 1] = actor;
+}
+
+/**
+ * @brief Redraws a maze cell from the map at the next flush, covering the sprites of the actors on it.
+ *
+ * @param position Cell of the maze.
+ */
+void band_draw_cell(Position position) {
+    unsigned char actor;
+
+    for (actor = 0; actor < ACTOR_COUNT; actor++) {
+        if (sprites[actor].visible && same_position(sprites[actor].position, position)) {
+            sprites[actor].visible = 0;
+            band_touch((ActorID)actor);
+        }
+    }
+    band_mark(position);
+}
+
+/**
+ * @brief Shows an actor's sprite on a maze cell at the next flush, over the sprites already there.
+ *
+ * The place it was shown at before is redrawn without it. The sprite keeps
+ * its offset while it stays on the same cell, a new cell starts it at 0.
+ *
+ * @param actor Actor of the sprite.
+ * @param position Cell of the maze.
+ * @param tile Tile of the atlas.
+ * @param ink Palette entry of the tile's ink.
+ */
+void band_show_sprite(ActorID actor, Position position, TileID tile, PaletteEntry ink) {
+    BandSprite* sprite = &sprites[actor];
+
+    if (!same_position(sprite->position, position)) {
+        sprite->offsetX = 0;
+        sprite->offsetY = 0;
+    }
+    sprite->position = position;
+    sprite->tile = tile;
+    sprite->ink = ink;
+    sprite->visible = 1;
+    band_raise(actor);
+    band_touch(actor);
+    redrawnSprites |= ACTOR_MASK(actor);
+}
+
+/**
+ * @brief Shifts an actor's sprite from its cell by a few pixels (smooth motion).
+ *
+ * @param actor Actor of the sprite.
+ * @param offsetX Pixels to the right of the cell (negative: to the left).
+ * @param offsetY Pixels below the cell (negative: above).
+ */
+void band_offset_sprite(ActorID actor, signed char offsetX, signed char offsetY) {
+    BandSprite* sprite = &sprites[actor];
+
+    if ((sprite->offsetX == offsetX) && (sprite->offsetY == offsetY)) {
+        return;
+    }
+    sprite->offsetX = offsetX;
+    sprite->offsetY = offsetY;
+    if (sprite->visible) {
+        band_touch(actor);
+    }
+}
+
+/**
+ * @brief Shows a number over the maze at the next flush, above every sprite (a score pop-up).
+ *
+ * Only one label is shown at a time: a new one replaces the last.
+ *
+ * @param position Cell the label is centred on.
+ * @param value Number shown.
+ * @param ink Palette entry of the digits.
+ */
+void band_show_label(Position position, unsigned short value, PaletteEntry ink) {
+    unsigned char digits[BAND_LABEL_DIGITS];
+    unsigned char i;
+
+    label.length = 0;
+    do {
+        digits[label.length++] = value % 10;
+        value /= 10;
+    } while (value && (label.length < BAND_LABEL_DIGITS));
+    for (i = 0; i < label.length; i++) {
+        label.digits[i] = digits[label.length - 1 - i];
+    }
+    label.position = position;
+    label.ink = ink;
+    label.visible = 1;
+    band_request();
+    changedLabel = 1;
+}
+
+// Take the label off at the next flush
+void band_hide_label(void) {
+    if (!label.visible) {
+        return;
+    }
+    label.visible = 0;
+    band_request();
+    changedLabel = 1;
+}
+
+// Maze pixels of a label
+static BandArea band_label_area(const BandLabel* shownAs) {
+    const short width = shownAs->length * LABEL_ADVANCE - 1;
+    BandArea area;
+
+    area.left = shownAs->position.x * TILE_SIZE + (TILE_SIZE - width) / 2;
+    area.top = shownAs->position.y * TILE_SIZE + (TILE_SIZE - LABEL_GLYPH_HEIGHT) / 2;
+    area.right = area.left + width - 1;
+    area.bottom = area.top + LABEL_GLYPH_HEIGHT - 1;
+    return area;
+}
+
+// Draw the part of the label that crosses the strip (maze pixels left, top; width pixels wide)
+static void band_compose_label(unsigned short left, unsigned short top, unsigned short width) {
+    const BandArea area = band_label_area(&label);
+    const unsigned short ink = palette_color(label.ink);
+    const unsigned char* glyph;
+    short x;
+    short y;
+    unsigned char i;
+    unsigned char row;
+    unsigned char column;
+
+    if ((area.right < (short)left) || (area.left >= (short)(left + width)) ||
+        (area.bottom < (short)top) || (area.top >= (short)(top + BAND_LINES))) {
+        return;
+    }
+    for (i = 0; i < label.length; i++) {
+        glyph = LABEL_GLYPHS[label.digits[i]];
+        for (row = 0; row < LABEL_GLYPH_HEIGHT; row++) {
+            y = area.top + row - top;
+            if ((y < 0) || (y >= BAND_LINES)) {
+                continue;
+            }
+            for (column = 0; column < LABEL_GLYPH_WIDTH; column++) {
+                x = area.left + i * LABEL_ADVANCE + column - left;
+                if ((x >= 0) && (x < (short)width) && (glyph[row] & (4 >> column))) {
+                    strip[y][x] = ink;
+                }
+            }
+        }
+    }
+}
+
+// Draw the part of the wall outline that crosses the strip (maze pixels left, top; width pixels wide)
+static void band_compose_outline(unsigned short left, unsigned short top, unsigned short width) {
+    const LevelDescriptor* level = level_get(gameRunning.level);
+    const unsigned short right = left + width - 1;
+    const unsigned short bottom = top + BAND_LINES - 1;
+    const unsigned short wall = palette_color(PALETTE_WALL);
+    const OutlineSegment* segment;
+    unsigned short xStart, yStart, xEnd, yEnd;
+    unsigned short x, y;
+    unsigned short i;
+
+    for (i = 0; i < level->outlineCount; i++) {
+        segment = &level->outline[i];
+        xStart = segment->x;
+        yStart = segment->y;
+        xEnd = segment->vertical ? xStart : (xStart + segment->length - 1);
+        yEnd = segment->vertical ? (yStart + segment->length - 1) : yStart;
+        if (xStart > right || xEnd < left || yStart > bottom || yEnd < top) {
+            continue;
+        }
+        xStart = (xStart < left) ? left : xStart;
+        yStart = (yStart < top) ? top : yStart;
+        xEnd = (xEnd > right) ? right : xEnd;
+        yEnd = (yEnd > bottom) ? bottom : yEnd;
+        for (y = yStart; y <= yEnd; y++) {
+            for (x = xStart; x <= xEnd; x++) {
+                strip[y - top][x - left] = wall;
+            }
+        }
+    }
+}
+
+// The ghost door: a cleared cell crossed by a bar between the two outline lines of the house wall
+static void band_compose_door(unsigned short column) {
+    const unsigned short background = palette_color(PALETTE_BACKGROUND);
+    const unsigned short door = palette_color(PALETTE_DOOR);
+    unsigned char x, y;
+
+    for (y = 0; y < BAND_LINES; y++) {
+        for (x = 0; x < TILE_SIZE; x++) {
+            strip[y][column + x] = ((y > LEVEL_OUTLINE_INSET) && (y < TILE_SIZE - 1 - LEVEL_OUTLINE_INSET)) ? door : background;
+        }
+    }
+}
+
+// Compose count cells of a maze row from column first on: the map content, the sprites bottom to top, the label
+static void band_compose(unsigned char row, unsigned char first, unsigned char count) {
+    const unsigned short width = count * TILE_SIZE;
+    const unsigned short background = palette_color(PALETTE_BACKGROUND);
+    const TileSurface surface = { &strip[0][0], BAND_STRIP_WIDTH, width, BAND_LINES };
+    const BandSprite* sprite;
+    short x;
+    short y;
+    unsigned char i;
+
+    for (y = 0; y < BAND_LINES; y++) {
+        for (x = 0; x < (short)width; x++) {
+            strip[y][x] = background;
+        }
+    }
+    band_compose_outline(first * TILE_SIZE, row * TILE_SIZE, width);
+
+    for (i = 0; i < count; i++) {
+        switch (gameRunning.gameMap[row][first + i]) {
+            case CELL_GHOST_DOOR:
+                band_compose_door(i * TILE_SIZE);
+                break;
+            case CELL_STANDARD_PILL:
+                tile_compose(TILE_PILL, &surface, i * TILE_SIZE, 0, PALETTE_PILL);
+                break;
+            case CELL_SPECIAL_PILL:
+                tile_compose(TILE_SPECIAL_PILL, &surface, i * TILE_SIZE, 0, PALETTE_PILL);
+                break;
+            default:
+                break;
+        }
+    }
+
+    // A sprite sliding between two cells shows in both
+    for (i = 0; i < ACTOR_COUNT; i++) {
+        sprite = &sprites[drawOrder[i]];
+        if (!sprite->visible) {
+            continue;
+        }
+        x = (sprite->position.x - first) * TILE_SIZE + sprite->offsetX;
+        y = (sprite->position.y - row) * TILE_SIZE + sprite->offsetY;
+        if ((x > -TILE_SIZE) && (x < (short)width) && (y > -TILE_SIZE) && (y < BAND_LINES)) {
+            tile_compose(sprite->tile, &surface, x, y, sprite->ink);
+        }
+    }
+    if (label.visible) {
+        band_compose_label(first * TILE_SIZE, row * TILE_SIZE, width);
+    }
+}
+
+// Send part of the composed strip to its place in one GRAM window burst (strip pixels left, top; width x height)
+static void band_push(unsigned char row, unsigned char first, unsigned short left, unsigned char top, unsigned short width, unsigned char height) {
+    LCD_WriteRect(GAME_MAP_START_X + first * TILE_SIZE + left, GAME_MAP_START_Y + row * TILE_SIZE + top,
+                  width, height, &strip[top][left], BAND_STRIP_WIDTH);
+}
+
+// FNV-1a signature of a composed cell (strip column of its left edge)
+static uint32_t band_signature(unsigned short left) {
+    uint32_t signature = 2166136261UL;
+    unsigned char x;
+    unsigned char y;
+
+    for (y = 0; y < BAND_LINES; y++) {
+        for (x = 0; x < TILE_SIZE; x++) {
+            signature = (signature ^ strip[y][left + x]) * 16777619UL;
+        }
+    }
+    return signature;
+}
+
+/**
+ * @brief Sends the parts of composed cells that the screen does not show yet.
+ *
+ * A cell whose pixels are known and sign the same as the composed ones is
+ * skipped; the others go out in one burst per run. A cell sent whole
+ * becomes known, a cell sent in part is no longer known (the rest of it
+ * may still be waiting for another change).
+ *
+ * @param row Maze row of the strip.
+ * @param first Maze column of the strip's first cell.
+ * @param count Cells composed.
+ * @param left Strip column of the area to send.
+ * @param top Strip line of the area to send.
+ * @param width Columns of the area.
+ * @param height Lines of the area.
+ */
+static void band_push_changed(unsigned char row, unsigned char first, unsigned char count,
+                              unsigned short left, unsigned char top, unsigned short width, unsigned char height) {
+    const unsigned short right = left + width - 1;
+    const unsigned char whole = (top == 0) && (height == BAND_LINES);
+    unsigned short runLeft = 0;
+    unsigned short runRight = 0;
+    unsigned short cellLeft;
+    unsigned short cellRight;
+    unsigned char running = 0;
+    unsigned char column;
+    unsigned char i;
+    uint32_t signature;
+
+    for (i = 0; i < count; i++) {
+        column = first + i;
+        cellLeft = i * TILE_SIZE;
+        cellRight = cellLeft + TILE_SIZE - 1;
+        if ((cellRight < left) || (cellLeft > right)) {
+            continue;
+        }
+        signature = band_signature(cellLeft);
+        if ((shadowRows[row] & (1U << column)) && (shadow[row][column] == signature)) {
+            if (running) {
+                band_push(row, first, runLeft, top, runRight - runLeft + 1, height);
+                running = 0;
+            }
+            continue;
+        }
+        if (whole && (cellLeft >= left) && (cellRight <= right)) {
+            shadow[row][column] = signature;
+            shadowRows[row] |= 1U << column;
+        } else {
+            shadowRows[row] &= ~(1U << column);
+        }
+        runLeft = running ? runLeft : ((cellLeft < left) ? left : cellLeft);
+        runRight = (cellRight > right) ? right : cellRight;
+        running = 1;
+    }
+    if (running) {
+        band_push(row, first, runLeft, top, runRight - runLeft + 1, height);
+    }
+}
+
+/**
+ * @brief Forgets the maze cells a direct draw covers (a banner, a map band).
+ *
+ * @param xStart Left screen column.
+ * @param yStart Top screen row.
+ * @param xEnd Right screen column (included).
+ * @param yEnd Bottom screen row (included).
+ */
+void band_forget(unsigned short xStart, unsigned short yStart, unsigned short xEnd, unsigned short yEnd) {
+    short first;
+    short last;
+    short top;
+    short bottom;
+    short row;
+
+    if ((xEnd < GAME_MAP_START_X) || (yEnd < GAME_MAP_START_Y) ||
+        (xStart >= GAME_MAP_START_X + GAME_MAP_PIXEL_WIDTH) || (yStart >= GAME_MAP_START_Y + GAME_MAP_PIXEL_HEIGHT)) {
+        return;
+    }
+    first = (xStart < GAME_MAP_START_X) ? 0 : ((xStart - GAME_MAP_START_X) / TILE_SIZE);
+    last = (xEnd >= GAME_MAP_START_X + GAME_MAP_PIXEL_WIDTH) ? (GAME_MAP_WIDTH - 1) : ((xEnd - GAME_MAP_START_X) / TILE_SIZE);
+    top = (yStart < GAME_MAP_START_Y) ? 0 : ((yStart - GAME_MAP_START_Y) / TILE_SIZE);
+    bottom = (yEnd >= GAME_MAP_START_Y + GAME_MAP_PIXEL_HEIGHT) ? (GAME_MAP_HEIGHT - 1) : ((yEnd - GAME_MAP_START_Y) / TILE_SIZE);
+    for (row = top; row <= bottom; row++) {
+        shadowRows[row] &= ~(((1U << (last - first + 1)) - 1) << first);
+    }
+}
+
+// No burst starts once a limited flush has used its cycles
+static unsigned char band_budget_spent(const BandBudget* budget) {
+    return budget->limited && budget->sent && (CPU_CYCLE_COUNT() - budget->start >= budget->cycles);
+}
+
+/**
+ * @brief Composes and sends dirty cells, one burst per run of dirty cells of a row.
+ *
+ * Rows are taken round from where the last spill stopped, so a row is not
+ * left behind by the ones above it.
+ *
+ * @param budget Cycles the flush may take.
+ * @return 0 if the budget ran out first.
+ */
+static unsigned char band_flush_cells(BandBudget* budget) {
+    unsigned int dirty;
+    unsigned char rows;
+    unsigned char row;
+    unsigned char first;
+    unsigned char count;
+
+    for (rows = 0; (rows < GAME_MAP_HEIGHT) && dirtyCells; rows++) {
+        row = nextRow;
+        nextRow = (nextRow + 1 == GAME_MAP_HEIGHT) ? 0 : (nextRow + 1);
+        dirty = dirtyRows[row];
+        first = 0;
+        while (dirty) {
+            while (!(dirty & 1)) {
+                dirty >>= 1;
+                first++;
+            }
+            if (band_budget_spent(budget)) {
+                dirtyRows[row] = dirty << first;   // The rest of the row goes first next time
+                nextRow = row;
+                return 0;
+            }
+            for (count = 0; (dirty & 1) && (count < BAND_STRIP_CELLS); count++) {
+                dirty >>= 1;
+            }
+            band_compose(row, first, count);
+            band_push_changed(row, first, count, 0, 0, count * TILE_SIZE, BAND_LINES);
+            sentRows[row] |= ((1U << count) - 1) << first;
+            dirtyCells -= count;
+            budget->sent = 1;
+            first += count;
+        }
+        dirtyRows[row] = 0;
+    }
+    return 1;
+}
+
+// Maze pixels of a sprite
+static BandArea band_sprite_area(const BandSprite* sprite) {
+    BandArea area;
+
+    area.left = sprite->position.x * TILE_SIZE + sprite->offsetX;
+    area.top = sprite->position.y * TILE_SIZE + sprite->offsetY;
+    area.right = area.left + TILE_SIZE - 1;
+    area.bottom = area.top + TILE_SIZE - 1;
+    return area;
+}
+
+// Redraw an area of the maze, one burst per maze row it crosses, composed from the cells under it
+static void band_flush_area(BandArea area) {
+    unsigned char row;
+    unsigned char first;
+    unsigned char last;
+    short left;
+    short right;
+    short top;
+    short bottom;
+
+    area.left = (area.left < 0) ? 0 : area.left;
+    area.top = (area.top < 0) ? 0 : area.top;
+    area.right = (area.right >= GAME_MAP_PIXEL_WIDTH) ? (GAME_MAP_PIXEL_WIDTH - 1) : area.right;
+    area.bottom = (area.bottom >= GAME_MAP_PIXEL_HEIGHT) ? (GAME_MAP_PIXEL_HEIGHT - 1) : area.bottom;
+
+    for (row = area.top / TILE_SIZE; row <= area.bottom / TILE_SIZE; row++) {
+        // The cells at either end already sent by this flush are left out
+        first = area.left / TILE_SIZE;
+        last = area.right / TILE_SIZE;
+        while ((first <= last) && (sentRows[row] & (1U << first))) {
+            first++;
+        }
+        while ((last >= first) && (sentRows[row] & (1U << last))) {
+            last--;
+        }
+        if (first > last) {
+            continue;
+        }
+        left = (area.left > first * TILE_SIZE) ? area.left : (first * TILE_SIZE);
+        right = (area.right < (last + 1) * TILE_SIZE - 1) ? area.right : ((last + 1) * TILE_SIZE - 1);
+        top = (area.top > row * TILE_SIZE) ? (area.top - row * TILE_SIZE) : 0;
+        bottom = (area.bottom < (row + 1) * TILE_SIZE - 1) ? (area.bottom - row * TILE_SIZE) : (TILE_SIZE - 1);
+        band_compose(row, first, last - first + 1);
+        band_push_changed(row, first, last - first + 1, left - first * TILE_SIZE, top, right - left + 1, bottom - top + 1);
+    }
+}
+
+/**
+ * @brief Redraws a sprite where it was sent and where it is to be shown.
+ *
+ * Two places at most a cell apart (a sprite sliding, stepping or changing
+ * tile) go out as the smallest rectangle holding both, at most three cells
+ * wide; places further apart (a respawn, the tunnel) go out one by one. A
+ * sprite shown again where it was is still sent: the maze may have been
+ * drawn over it directly.
+ *
+ * @param actor Actor of the sprite.
+ */
+static void band_flush_sprite(ActorID actor) {
+    BandArea old;
+    BandArea area;
+
+    old = band_sprite_area(&shown[actor]);
+    area = band_sprite_area(&sprites[actor]);
+    if (same_sprite(&shown[actor], &sprites[actor])) {
+        if (sprites[actor].visible && (redrawnSprites & ACTOR_MASK(actor))) {
+            band_flush_area(area);
+        }
+    } else if (shown[actor].visible && sprites[actor].visible &&
+        (old.left - area.left <= TILE_SIZE) && (area.left - old.left <= TILE_SIZE) &&
+        (old.top - area.top <= TILE_SIZE) && (area.top - old.top <= TILE_SIZE)) {
+        area.left = (old.left < area.left) ? old.left : area.left;
+        area.top = (old.top < area.top) ? old.top : area.top;
+        area.right = (old.right > area.right) ? old.right : area.right;
+        area.bottom = (old.bottom > area.bottom) ? old.bottom : area.bottom;
+        band_flush_area(area);
+    } else {
+        if (shown[actor].visible) {
+            band_flush_area(old);
+        }
+        if (sprites[actor].visible) {
+            band_flush_area(area);
+        }
+    }
+    shown[actor] = sprites[actor];
+}
+
+// Redraw the sprites shown differently since the last flush (after the cells: over them)
+static unsigned char band_flush_sprites(BandBudget* budget) {
+    unsigned char actor;
+
+    for (actor = 0; changedSprites && (actor < ACTOR_COUNT); actor++) {
+        if (!(changedSprites & ACTOR_MASK(actor))) {
+            continue;
+        }
+        if (band_budget_spent(budget)) {
+            return 0;
+        }
+        changedSprites &= ~ACTOR_MASK(actor);
+        band_flush_sprite((ActorID)actor);
+        redrawnSprites &= ~ACTOR_MASK(actor);
+        budget->sent = 1;
+    }
+    return 1;
+}
+
+// Redraw the label where it was sent and where it is to be shown (after the sprites: over them)
+static unsigned char band_flush_label(BandBudget* budget) {
+    if (!changedLabel) {
+        return 1;
+    }
+    if (band_budget_spent(budget)) {
+        return 0;
+    }
+    changedLabel = 0;
+    if (shownLabel.visible) {
+        band_flush_area(band_label_area(&shownLabel));
+    }
+    if (label.visible) {
+        band_flush_area(band_label_area(&label));
+    }
+    shownLabel = label;
+    budget->sent = 1;
+    return 1;
+}
+
+// Send every change now (before drawing over the maze directly)
+void band_flush(void) {
+    BandBudget budget = { 0, 0, 0, 0 };
+
+    memset(sentRows, 0, sizeof(sentRows));
+    band_flush_cells(&budget);
+    band_flush_sprites(&budget);
+    band_flush_label(&budget);
+}
+
+/**
+ * @brief Sends the changes until the frame's budget is spent (the cells layer of a frame).
+ *
+ * @param start Cycle counter when the frame began.
+ * @param cycles Cycles the frame may take.
+ * @return Cells, sprites and label left for the next frame.
+ */
+unsigned short band_flush_budget(uint32_t start, uint32_t cycles) {
+    BandBudget budget;
+    unsigned short left;
+    unsigned char actor;
+
+    budget.limited = 1;
+    budget.sent = 0;
+    budget.start = start;
+    budget.cycles = cycles;
+    memset(sentRows, 0, sizeof(sentRows));
+    if (band_flush_cells(&budget) && band_flush_sprites(&budget)) {
+        band_flush_label(&budget);
+    }
+
+    left = dirtyCells + changedLabel;
+    for (actor = 0; actor < ACTOR_COUNT; actor++) {
+        left += (changedSprites >> actor) & 1;
+    }
+    return left;
+}
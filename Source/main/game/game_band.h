@@ -0,0 +1,57 @@
+#ifndef __GAME_BAND_H
+#define __GAME_BAND_H
+
+#include "game_engine.h"
+#include "game_collision.h"
+#include "game_tiles.h"
+
+/*
+ * Band renderer.
+ *
+ * The maze cells and the sprites on them are not drawn straight to the
+ * LCD: drawing a cell only marks it dirty, and showing a sprite records
+ * its tile in a small sprite layer (one entry per actor, in draw order).
+ * A flush then composes every dirty cell in a RAM strip of BAND_LINES
+ * lines (one maze row) and at most BAND_STRIP_CELLS cells: the background
+ * colour, the wall outline crossing the strip, the door bar, the pill on
+ * the map, and the sprites standing there, their background shade
+ * transparent. Each run of dirty cells of a row goes out in one GRAM
+ * window burst, so a moving sprite is never seen erased and the screen
+ * only changes once per cell.
+ *
+ * A sprite may stand a few pixels off its cell (smooth motion: the actor
+ * is still sliding in from the cell it left). The layer keeps each sprite
+ * as it was sent too; a sprite shown differently only redraws the smallest
+ * rectangle holding its old and new places, composed from the cells under
+ * it, so a sprite sliding by two pixels sends 10 x 8 pixels, not two cells.
+ *
+ * A shadow keeps a 32-bit signature of the pixels on each cell of the
+ * screen (3.5 KB). A composed cell that signs the same is not sent again,
+ * whatever asked for it: Pac-Man standing against a wall, a ghost shown
+ * again with the same tile, the same pill redrawn cost no LCD traffic. The
+ * renderer's direct draws over the maze make the cells they cover unknown.
+ *
+ * A label (a score pop-up) is the top layer: small digits composed over
+ * the sprites, flushed like a sprite from where it was to where it is.
+ *
+ * The changes go out with the next frame (game_frame.h), within its cycle
+ * budget. The renderer also flushes before any direct fill or text, so a
+ * banner or a maze band drawn later is never covered by an older cell. A
+ * movement tick moves at most five actors by one cell: it costs at most
+ * ten cells, and a tick that only slides them far less.
+ */
+
+#define BAND_LINES       TILE_SIZE   // Screen lines of the strip: one maze row
+#define BAND_STRIP_CELLS 8           // Cells composed at once (8 x 64 RGB565 pixels, 1 KB)
+#define BAND_LABEL_DIGITS 5          // Digits of a label (any unsigned short)
+
+void band_draw_cell(Position position);
+void band_show_sprite(ActorID actor, Position position, TileID tile, PaletteEntry ink);
+void band_offset_sprite(ActorID actor, signed char offsetX, signed char offsetY);
+void band_show_label(Position position, unsigned short value, PaletteEntry ink);
+void band_hide_label(void);
+void band_forget(unsigned short xStart, unsigned short yStart, unsigned short xEnd, unsigned short yEnd);
+void band_flush(void);
+unsigned short band_flush_budget(uint32_t start, uint32_t budget);
+
+#endif /* __GAME_BAND_H */
@@ -0,0 +1,64 @@
+#include <string.h>
+#include "game_collision.h"
+
+#define VACATED_TILES_MAX (ACTOR_COUNT * 2)   // An actor never steps twice in the same tick
+
+static unsigned char occupancy[GAME_MAP_HEIGHT][GAME_MAP_WIDTH];  // Actors standing on each tile
+static unsigned char departed[GAME_MAP_HEIGHT][GAME_MAP_WIDTH];   // Actors that left each tile in this tick
+static Position vacatedTiles[VACATED_TILES_MAX];                  // Tiles with a non-empty departed mask
+static unsigned char vacatedCount = 0;
+
+// Empty the grid (level start, lost life)
+void collision_reset(void) {
+    memset(occupancy, 0, sizeof(occupancy));
+    memset(departed, 0, sizeof(departed));
+    vacatedCount = 0;
+}
+
+// Forget the moves of the previous movement tick
+void collision_begin_tick(void) {
+    while (vacatedCount) {
+        vacatedCount--;
+        departed[vacatedTiles[vacatedCount].y][vacatedTiles[vacatedCount].x] = 0;
+    }
+}
+
+// Put an actor on a tile without any contact check (spawn)
+void collision_place(ActorID actor, Position position) {
+    occupancy[position.y][position.x] |= ACTOR_MASK(actor);
+}
+
+// Take an actor off the grid
+void collision_remove(ActorID actor, Position position) {
+    occupancy[position.y][position.x] &= ~ACTOR_MASK(actor);
+}
+
+/**
+ * @brief Moves an actor by one tile and returns the actors it met.
+ *
+ * The result has one bit per actor either standing on the destination tile
+ * or coming from it onto the tile being left during the same tick.
+ */
+unsigned char collision_move(ActorID actor, Position from, Position to) {
+    const unsigned char bit = ACTOR_MASK(actor);
+    unsigned char contacts;
+
+    occupancy[from.y][from.x] &= ~bit;
+    contacts = occupancy[to.y][to.x] | (departed[to.y][to.x] & occupancy[from.y][from.x]);
+    occupancy[to.y][to.x] |= bit;
+
+    if (departed[from.y][from.x] == 0) {
+        if (vacatedCount == VACATED_TILES_MAX) {
+            return contacts;   // Cannot happen with one step per actor and tick
+        }
+        vacatedTiles[vacatedCount++] = from;
+    }
+    departed[from.y][from.x] |= bit;
+
+    return contacts;
+}
+
+// Actors standing on a tile
+unsigned char collision_actors_at(Position position) {
+    return occupancy[position.y][position.x];
+}
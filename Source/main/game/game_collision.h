@@ -0,0 +1,42 @@
+#ifndef __GAME_COLLISION_H
+#define __GAME_COLLISION_H
+
+#include "game_engine.h"
+
+/*
+ * Actor occupancy grid.
+ *
+ * Every tile of the maze holds a bitmask of the actors standing on it,
+ * updated on every move. A second grid records the actors that left each
+ * tile during the current movement tick, so a move reports in constant
+ * time both the actors already on the destination tile and the ones that
+ * crossed it in the opposite direction (two actors swapping tiles within
+ * the same tick). The tiles left during a tick are listed, so clearing
+ * them at the next tick costs one entry per move instead of a pass over
+ * the whole maze.
+ */
+
+// Actors tracked by the grid (one bit each)
+typedef enum {
+    ACTOR_PACMAN  = 0,
+    ACTOR_BLINKY  = 1,   // The ghosts follow in GhostID order
+    ACTOR_PINKY   = 2,
+    ACTOR_INKY    = 3,
+    ACTOR_CLYDE   = 4,
+    ACTOR_FRUIT   = 5,   // Bonus fruit
+    ACTOR_COUNT
+} ActorID;
+
+#define ACTOR_MASK(actor)    (1U << (actor))
+#define ACTOR_GHOST(ghost)   ((ActorID)(ACTOR_BLINKY + (ghost)))
+#define ACTOR_TO_GHOST(actor) ((GhostID)((actor) - ACTOR_BLINKY))
+#define ACTOR_GHOSTS_MASK    (((1U << GHOST_COUNT) - 1) << ACTOR_BLINKY)
+
+void collision_reset(void);
+void collision_begin_tick(void);
+void collision_place(ActorID actor, Position position);
+void collision_remove(ActorID actor, Position position);
+unsigned char collision_move(ActorID actor, Position from, Position to);
+unsigned char collision_actors_at(Position position);
+
+#endif /* __GAME_COLLISION_H */
@@ -1,83 +1,106 @@
 #include "game_controller.h"
-#include <math.h> // Per la funzione sqrt()
 
 #define PROBABILITY_THRESHOLD 65     // Threshold for special pill generation in percentage
 #define TIMER_COUNT           4      // Total number of available timers
 #define MAX_ANIMATION_FRAMES 3 // Maximum number of frames for Pac-Man's animation
 #define NO_COLLISION 0         // Indicates no collision
 #define COLLISION 1            // Indicates a collision
-#define TIME_COUNT_FOR_GAME_UPDATE 10 //1 s
-#define TIME_COUNT_FOR_SPECIAL_PILL_GENERATION 7 // 0.7 s
-#define TIME_1_SECOND 10
+#define GAME_CLOCK_MS 1000              // Game time decrement (1 s)
+#define SPECIAL_PILL_GENERATION_MS 700  // Special pill generation attempt (0.7 s)
+#define PROFILER_REPORT_SECONDS 10      // Game time between two interrupt profile reports
+
+// Events that belong to the running game (stopped by pause, failure and end of game)
+#define GAME_EVENTS_MASK (EVENT_MASK(EVENT_MOVEMENT_TICK) | EVENT_MASK(EVENT_GAME_CLOCK) | \
+                          EVENT_MASK(EVENT_SPECIAL_PILL) | EVENT_MASK(EVENT_GHOST_ACCELERATION) | \
+                          EVENT_MASK(EVENT_SCORE_POPUP))
 
 
 void game_trigger_failure();
 void game_trigger_game_over();
 void game_draw_pause_screen();
+void game_draw_actors();
+void game_draw_level_extras();
 void game_pacman_spawn();
-void game_ghost_spawn();
 void pacman_update_position(Pacman* pacman, Position nextPosition, unsigned char* currentCell, unsigned char* nextCell, unsigned char isCollision);
 void pacman_update_animation();
 Position pacman_calculate_next_position(Pacman pacman);
 void handle_pacman_movement(GameRunning* gameRunning, Position nextPosition); 
+void pacman_process_contacts(unsigned char contacts);
 unsigned char game_handle_teleport(Position* position, Direction direction);
-Position ghost_calculate_next_position(Ghost ghost);
-void ghost_update_animation();
-void ghost_update_position(Ghost* ghost, Position nextPosition, unsigned char* currentCell, unsigned char* nextCell, unsigned char isCollision);
-Direction compute_ghost_direction(Ghost *ghost, Pacman *pacman);
-unsigned char position_between_ghost_and_pacman_is_equal(Position posPacman, Position posGhost);
-void process_pacman_ghost_collision();
-void process_ghost_death();
-void revive_ghost();
+void ghost_accelerate();
+void game_schedule_events(const unsigned short* delays);
 void score_update(CellType pill_type);
 void lives_update();
 int random_generate_seed();
 Position random_generate_position();
 void pill_transform_to_special(Position position);
-void timer_toggle_set(unsigned char timer0, unsigned char timer1, unsigned char timer2, unsigned char timer3);
-void timer_toggle_all();
-unsigned char euclidean_distance(Position p1, Position p2);
-void update_ghost_timer(unsigned char speed);
-unsigned short calculate_timer_interval(unsigned char speed);
-void update_game_time_display(unsigned char time_value);
-void update_game_score_display(unsigned short score_value);
-void update_lives_display(unsigned char lives_value);
-void transmit_CAN_data();
-
-static unsigned char ghostVunerableTickReset = 0;
-static unsigned char isInHouse = 1;
+void update_game_stats_display();
+void encode_game_stats(unsigned char data[8]);
+void game_apply_pending_input();
+void game_redraw_restored_map(const GameMap* restoredMap);
+
+static unsigned char gameEventsFrozen = 0;
+static unsigned int movementTicks = 0;                          // Movement ticks since the game started (replay time base)
+static volatile unsigned char pendingDirection = DIRECTION_STILL; // Joystick input waiting for the next movement tick
+static PrngState gameRandom = PRNG_DEFAULT_SEED;                // Special pills (seeded once per game, recorded in the replay)
+static unsigned char lifeIncreases = 0;                         // Extra lives awarded so far
+static GameSnapshot snapshotStaging;                            // Snapshot being taken or checked before a restore
+
+// Snapshot kept across a reset (a plain buffer on the host, which has no retained RAM)
+#ifdef HOST_BUILD
+static unsigned char retainedSnapshot[SNAPSHOT_RETAINED_SIZE];
+#define RETAINED_SNAPSHOT retainedSnapshot
+#else
+#define RETAINED_SNAPSHOT ((unsigned char*)SNAPSHOT_RETAINED_ADDRESS)
+#endif
 
 void game_pacman_spawn(){
 	gameRunning.pacman.sprite.direction = DIRECTION_STILL;
 	gameRunning.pacman.sprite.prevPos = gameRunning.pacman.sprite.currPos;
 	gameRunning.pacman.sprite.currPos = get_pacman_spawn_position();
-}
-
-void game_ghost_spawn(){
-	gameRunning.ghost.sprite.direction = DIRECTION_STILL;
-	gameRunning.ghost.sprite.prevPos = gameRunning.ghost.sprite.currPos;
-	gameRunning.ghost.sprite.currPos = get_ghost_spawn_position();
+	movement_reset_progress(&gameRunning.pacman.sprite);
+	collision_place(ACTOR_PACMAN, gameRunning.pacman.sprite.currPos);
 }
 
 // Initialize a level
-void level_initialize(unsigned short is_first_initialization) {
-    gameStatus.specialPillsGenerated = 0;
-    gameRunning.remainingPills = GAME_CONFIG.standardPillCount;
-    gameRunning.remainingTime = GAME_CONFIG.maxTime;
+void level_initialize(unsigned short screen) {
+    const LevelDescriptor* level = level_get(gameRunning.level);
 
-    initialize_game_map(&gameRunning.gameMap);
+    gameStatus.specialPillsGenerated = 0;
+    gameRunning.remainingPills = level->pillCount;
+    gameRunning.remainingTime = level->maxTime;
+
+    level_load_map(gameRunning.level, &gameRunning.gameMap);
+    palette_reset();
+    movement_set_tunnel(&level->tunnel);
+    collision_reset();
+    hud_clear_popup();
 	
 		game_pacman_spawn();
 	
-		game_ghost_spawn();
+		ghosts_spawn_all();
 
-    if (is_first_initialization) {
-        draw_game_map();
-        draw_area_stat();
-        game_draw_pause_screen();
-    } else {
-        update_game_time_display(gameRunning.remainingTime);
+    game_update_actor_speeds();
+    game_schedule_events(NULL);
+
+    if (screen == LEVEL_SCREEN_KEEP) {
+        update_game_stats_display();
+        return;
     }
+    overlay_discard_all();
+    if (screen == LEVEL_SCREEN_WIPE) {
+        wipe_start(draw_game_map_lines, game_draw_level_extras);   // The statistics and the HUD lines stay
+        return;
+    }
+    draw_game_map();
+    game_draw_level_extras();
+}
+
+// Everything of a new level screen but the maze: the actors, the statistics and the pause banner
+void game_draw_level_extras() {
+    game_draw_actors();
+    draw_area_stat();
+    game_draw_pause_screen();
 }
 
 void game_play_tone_all_track(){
@@ -88,14 +111,14 @@ void game_play_tone_single_note(){
 		play_tone_single_note();
 }
 
-void game_play_tone_single_note_duration(){
-		play_tone_single_note_duration();
-}
-
 // Update the remaining game time
 void game_update_time() {
     gameRunning.remainingTime--;
-    update_game_time_display(gameRunning.remainingTime);
+    update_game_stats_display();
+
+    if ((gameRunning.remainingTime % PROFILER_REPORT_SECONDS) == 0) {
+        task_post(TASK_PROFILER_REPORT);
+    }
 
     if (gameRunning.remainingTime == 0) {
         game_trigger_failure();
@@ -111,35 +134,42 @@ void game_trigger_failure() {
 		
 		set_current_track(TRACK_LOSE_LIFE_SOUND_EFFECT);
 
-    timer_toggle_set(1, !gameStatus.ghostStatus.isDead, 0, 0);
+    game_events_toggle();
 	
     gameStatus.isFailed = 1;
     draw_cell(CELL_FREE, gameRunning.pacman.sprite.currPos);
-		draw_cell(CELL_FREE, gameRunning.ghost.sprite.currPos);
+		ghosts_undraw_all();
 
-    draw_screen_failure();
+    overlay_push(BANNER_START_Y, BANNER_END_Y, draw_screen_failure);
 
     gameRunning.remainingLives--;
-		isInHouse = 1;
     lives_update();
-    level_initialize(0);
+    level_initialize(LEVEL_SCREEN_KEEP);
 }
 
 // Handle a game over
 void game_trigger_game_over() {
 		set_current_track(TRACK_GAME_OVER_SOUND_EFFECT);
     gameStatus.isEnded = 1;
-    timer_toggle_all();
+    game_events_toggle();
     draw_screen_game_over();
 }
 
-// Handle a victory
+// Handle a cleared maze: the next level of the pack starts paused, clearing the last one is a victory
 void game_handle_victory() {
-    if (gameRunning.remainingPills == 0) {
-        gameStatus.isEnded = 1;
-        timer_toggle_all();
-        draw_screen_victory();
+    if (gameRunning.remainingPills != 0) {
+        return;
     }
+    game_events_toggle();
+
+    if (gameRunning.level < LEVEL_PACK_COUNT) {
+        gameRunning.level++;
+        gameStatus.isPaused = 1;
+        level_initialize(LEVEL_SCREEN_WIPE);
+        return;
+    }
+    gameStatus.isEnded = 1;
+    draw_screen_victory();
 }
 
 // Handle game pause
@@ -147,123 +177,112 @@ void game_handle_pause() {
     if (gameStatus.isEnded) {
         return;
     }
+    wipe_complete();   // A new maze still sliding in is finished before the game draws on it
 
-    timer_toggle_all();
+    replay_record(movementTicks, REPLAY_INPUT_PAUSE);
+    game_post_replay_export();
+    game_events_toggle();
 
     if (gameStatus.isFailed) {
         gameStatus.isFailed = 0;
-        undraw_pause_screen();
+        overlay_discard_all();   // The maze was reset under the banner
         draw_game_map();
+        game_draw_actors();
         return;
     }
-		draw_cell(CELL_FREE, gameRunning.pacman.sprite.currPos);
-		draw_cell(CELL_FREE, gameRunning.ghost.sprite.currPos);
     gameStatus.isPaused = !gameStatus.isPaused;
     game_draw_pause_screen();
+
+    // A reset while paused resumes this game at the next boot
+    if (!gameStatus.isPaused || !game_take_snapshot(RETAINED_SNAPSHOT, SNAPSHOT_RETAINED_SIZE)) {
+        RETAINED_SNAPSHOT[0] = 0;
+    }
 }
 
-// Draw the pause screen
+// Show or take off the pause banner (the tiles under it, actors included, are restored as they were)
 void game_draw_pause_screen() {
     if (gameStatus.isPaused) {
-        draw_pause_screen();
+        overlay_push(BANNER_START_Y, BANNER_END_Y, draw_pause_screen);
     } else {
-        undraw_pause_screen();
-        redraw_after_pause();
+        overlay_pop();
     }
 }
 
-// Process the next game tick
-void game_process_next_tick() {
-    static unsigned short tickCountUpdateTime = 0;          // Global tick counter
-    static unsigned short tickCountSpecialPillGeneration = 0; // Global tick counter
-    static unsigned char blinkyRespawnTickCount = 0;        // Counter for Blinky's respawn
-    static unsigned char blinkyBlueTickCount = 0;           // Counter for Blinky's vulnerability
-		static unsigned char tickCountUpdateSpeedGhost = 0;
-    tickCountUpdateTime++;	
-    tickCountSpecialPillGeneration++;
-		tickCountUpdateSpeedGhost++;
-	
-    if (ghostVunerableTickReset) {
-        ghostVunerableTickReset = 0;
-        blinkyBlueTickCount = 0;
-    }
+// Draw Pac-Man and the ghosts where they stand
+void game_draw_actors() {
+    draw_cell(CELL_PACMAN, gameRunning.pacman.sprite.currPos);
+    ghosts_draw_all();
+}
 
-    // Handle Blinky's vulnerability state
-    if (gameRunning.ghost.status.isVulnerable) {
-        blinkyBlueTickCount++;
-        if (blinkyBlueTickCount >= TIME_1_SECOND * GAME_CONFIG.ghostConfig.blueTime) {
-            blinkyBlueTickCount = 0;
-            gameRunning.ghost.status.isVulnerable = 0; // Blinky returns to normal
-        }
-    }
+// Arm the periodic game events, first expiry after delays[id] ticks (NULL: one whole period, as for a new level)
+void game_schedule_events(const unsigned short* delays) {
+    const EventCallback callbacks[SNAPSHOT_EVENT_COUNT] = {
+        game_process_movement_tick, game_update_time, pill_generate_special, ghost_accelerate
+    };
+    const unsigned int periods[SNAPSHOT_EVENT_COUNT] = {
+        SCHEDULER_MS_TO_TICKS(MOVEMENT_TICK_MS),
+        SCHEDULER_MS_TO_TICKS(GAME_CLOCK_MS),
+        SCHEDULER_MS_TO_TICKS(SPECIAL_PILL_GENERATION_MS),
+        SCHEDULER_SECONDS_TO_TICKS(GAME_CONFIG.ghostConfig.accelInterval)
+    };
+    unsigned char id;
 
-    // Handle Blinky's respawn state
-    if (gameRunning.ghost.status.isDead) {
-        blinkyRespawnTickCount++;
-        if (blinkyRespawnTickCount >= TIME_1_SECOND * GAME_CONFIG.ghostConfig.respawnTime) {
-            blinkyRespawnTickCount = 0;
-            revive_ghost();
-        }
+    for (id = 0; id < SNAPSHOT_EVENT_COUNT; id++) {
+        scheduler_start_event((EventID)id, callbacks[id], delays ? delays[id] : periods[id], periods[id]);
     }
-		// Calculate Pac-Man's next position based on its current direction
-		Position nextPosition = pacman_calculate_next_position(gameRunning.pacman);
-		
-		// Handle Pac-Man's movement and interactions
-    handle_pacman_movement(&gameRunning, nextPosition);
-		
-		if(tickCountUpdateTime >= TIME_COUNT_FOR_GAME_UPDATE){
-			tickCountUpdateTime = 0;
-			game_update_time();
-		}
+}
 
-    // Generate special pills if needed
-    if (tickCountSpecialPillGeneration >= TIME_COUNT_FOR_SPECIAL_PILL_GENERATION) {
-        tickCountSpecialPillGeneration = 0;
-        pill_generate_special();
-    }
-		
-    // Handle Blinky's acceleration over time
-		if ((tickCountUpdateSpeedGhost >= TIME_1_SECOND * gameRunning.ghost.config.accelInterval)) {
-        tickCountUpdateSpeedGhost = 0;
+// Pick the speed of every actor from the level table and the current game state
+void game_update_actor_speeds() {
+    const LevelSpeeds* speeds = movement_get_level_speeds(gameRunning.level);
 
-        if (gameRunning.ghost.status.currentSpeed < GAME_CONFIG.ghostConfig.maxSpeed) {
-            gameRunning.ghost.status.currentSpeed++; // Incrementa la velocit di Blinky
-            update_ghost_timer(gameRunning.ghost.status.currentSpeed); // Aggiorna il timer
-        }
-    }
+    movement_set_speed(&gameRunning.pacman.sprite, ghosts_any_frightened() ? speeds->pacmanFrightened : speeds->pacmanNormal);
+    ghosts_update_speeds(speeds);
 }
 
-// Funzione per aggiornare il timer del fantasma in base alla velocit
-void update_ghost_timer(unsigned char speed) {
-    unsigned short interval = calculate_timer_interval(speed);
+// Common movement tick: every actor steps when its sub-tile progress overflows
+void game_process_movement_tick() {
+    collision_begin_tick();
+    game_apply_pending_input();
+    movementTicks++;
 
-    // Disabilita e reimposta il timer
-    disable_timer(1);
-    reset_timer(1);
+    if (movement_advance(&gameRunning.pacman.sprite)) {
+        game_process_pacman_step();
 
-    // Inizializza il timer con il nuovo intervallo
-    init_timer(1,0,0,3, interval);
-		
+        // A failure, a new level or the end of the game restarts or freezes everything
+        if (gameStatus.isFailed || gameStatus.isPaused || gameStatus.isEnded) {
+            return;
+        }
+    }
 
-    // Riabilita il timer
-		//if(!gameRunning.ghost.status.isDead) enable_timer(1);
+    ghosts_process_movement_tick();
+    draw_actors_motion();   // The sprites slide on between the steps
 }
 
-// Funzione per calcolare l'intervallo del timer in base alla velocit
-unsigned short calculate_timer_interval(unsigned char speed) {
-    // Parametri del timer del simulatore
-    unsigned int baseInterval = 0x002625A0; // Intervallo per 0.1 secondi
-
-    // Estremi di velocit e intervallo
-    unsigned char maxSpeed = GAME_CONFIG.ghostConfig.maxSpeed;
-    unsigned char minSpeed = GAME_CONFIG.ghostConfig.minSpeed;
+// Stop or resume every game event (pause, failure and end of game)
+void game_events_toggle() {
+    if (gameEventsFrozen) {
+        scheduler_thaw_events(GAME_EVENTS_MASK);
+    } else {
+        scheduler_freeze_events(GAME_EVENTS_MASK);
+    }
+    gameEventsFrozen = !gameEventsFrozen;
+    profiler_reset();   // The load window only covers uninterrupted play
+}
 
-    // Velocit minima corrisponde al massimo intervallo
-    // Velocit massima corrisponde al minimo intervallo
-    int intervalFactor = (maxSpeed - speed) / (maxSpeed - minSpeed);
+// Move Pac-Man by one tile
+void game_process_pacman_step() {
+		// Calculate Pac-Man's next position based on its current direction
+		Position nextPosition = pacman_calculate_next_position(gameRunning.pacman);
 		
-    // Genera il nuovo intervallo
-    return (unsigned int)(baseInterval * intervalFactor);
+		// Handle Pac-Man's movement and interactions
+    handle_pacman_movement(&gameRunning, nextPosition);
+}
+
+// Handle the ghosts' acceleration over time
+void ghost_accelerate() {
+    ghosts_accelerate();
+    game_update_actor_speeds();
 }
 
 
@@ -272,6 +291,8 @@ void handle_pacman_movement(GameRunning* gameRunning, Position nextPosition) {
     // Pointers to the current and next cells in the game map
     unsigned char* currentCell = &gameRunning->gameMap[gameRunning->pacman.sprite.currPos.y][gameRunning->pacman.sprite.currPos.x];
     unsigned char* nextCell = &gameRunning->gameMap[nextPosition.y][nextPosition.x];
+    Position* prevPosition = &gameRunning->pacman.sprite.prevPos;
+    Position* currPosition = &gameRunning->pacman.sprite.currPos;
 
     // Handle behavior based on the type of the next cell
     switch (*nextCell) {
@@ -297,22 +318,48 @@ void handle_pacman_movement(GameRunning* gameRunning, Position nextPosition) {
 						pacman_update_position(&gameRunning->pacman, nextPosition, currentCell, nextCell, NO_COLLISION);
             score_update(*nextCell); // Update the score based on the pill type
             lives_update();           // Check if an extra life should be awarded
-            game_handle_victory();    // Check if all pills have been eaten
             *nextCell = CELL_FREE;   // Remove the pill from the map
+            game_handle_victory();    // Check if all pills have been eaten
             break;
         case CELL_SPECIAL_PILL:
             // No collision, Pac-Man eats the pill
             pacman_update_position(&gameRunning->pacman, nextPosition, currentCell, nextCell, NO_COLLISION);
             score_update(*nextCell); // Update the score based on the pill type
             lives_update();           // Check if an extra life should be awarded
-            game_handle_victory();    // Check if all pills have been eaten
             *nextCell = CELL_FREE;   // Remove the pill from the map
+            game_handle_victory();    // Check if all pills have been eaten
             break;
     }
 		
-		if(position_between_ghost_and_pacman_is_equal(gameRunning->pacman.sprite.currPos, gameRunning->ghost.sprite.currPos) && !gameStatus.ghostStatus.isDead) {
-						process_pacman_ghost_collision();
+		// A cleared maze ends the step (the next level has its own actors)
+		if (gameStatus.isPaused || gameStatus.isEnded) {
+				return;
 		}
+
+		// Meet the actors on the new tile and the ones that crossed it the other way
+		if ((prevPosition->x != currPosition->x) || (prevPosition->y != currPosition->y)) {
+				pacman_process_contacts(collision_move(ACTOR_PACMAN, *prevPosition, *currPosition));
+		}
+}
+
+// Process the ghosts Pac-Man met on his last step
+void pacman_process_contacts(unsigned char contacts) {
+    unsigned char ghost;
+
+    if ((contacts & ACTOR_GHOSTS_MASK) == 0) {
+        return;
+    }
+
+    for (ghost = 0; ghost < GHOST_COUNT; ghost++) {
+        if ((contacts & ACTOR_MASK(ACTOR_GHOST(ghost))) && ghosts_touch_pacman((GhostID)ghost)) {
+            process_pacman_ghost_collision((GhostID)ghost);
+
+            // A lost life respawns every actor
+            if (gameStatus.isFailed) {
+                return;
+            }
+        }
+    }
 }
 
 
@@ -321,14 +368,12 @@ void pacman_update_position(Pacman* pacman, Position nextPosition, unsigned char
     // Update the previous position
     pacman->sprite.prevPos = pacman->sprite.currPos;  // Accedi alla prevPos di Sprite
 
-    // If there's no collision, update Pac-Man's current position
+    // If there's no collision, update Pac-Man's current position (he only chomps while moving)
     if (isCollision == NO_COLLISION) {
         pacman->sprite.currPos = nextPosition;  // Accedi alla currPos di Sprite
+        pacman_update_animation();
     }
 
-    // Update Pac-Man's animation
-    pacman_update_animation();
-
     // Redraw the cells on the game map
     draw_cell(*currentCell, pacman->sprite.prevPos);  // Restore the previous cell
     draw_cell(CELL_PACMAN, pacman->sprite.currPos);  // Draw Pac-Man in the new position
@@ -367,349 +412,273 @@ Position pacman_calculate_next_position(Pacman pacman) {
     return nextPosition;
 }
 
+// Latch a joystick direction (called by the RIT), it is applied by the next movement tick
 void game_pacman_handle_direction_change(Direction newDirection) {
-	gameRunning.pacman.sprite.direction = newDirection;
+	pendingDirection = newDirection;
 }
 
-// Handle teleportation
-unsigned char game_handle_teleport(Position* position, Direction direction) {
-    unsigned char* cell = &gameRunning.gameMap[position->y][position->x];
+// Apply the latched direction at a tick boundary and record it, so that a replay reproduces it exactly
+void game_apply_pending_input() {
+    const Direction direction = (Direction)pendingDirection;
 
-    if ((*cell == CELL_TELEPORT_LEFT) && (direction == DIRECTION_LEFT)) {
-        position->x = GAME_MAP_WIDTH - 1;
-        return 1;
-    }
-    if ((*cell == CELL_TELEPORT_RIGHT) && (direction == DIRECTION_RIGHT)) {
-        position->x = 0;
-        return 1;
+    if (direction == DIRECTION_STILL) {
+        return;
     }
+    pendingDirection = DIRECTION_STILL;
 
-    return 0;
+    if (direction != gameRunning.pacman.sprite.direction) {
+        gameRunning.pacman.sprite.direction = direction;
+        replay_record(movementTicks, (ReplayInput)direction);
+        game_post_replay_export();
+    }
 }
 
-// Handle ghost movement and interactions with the game map
-void game_process_movement_of_ghost() {
-    // Pointers to the current and next cells in the game map
-		gameRunning.ghost.sprite.direction = compute_ghost_direction(&gameRunning.ghost, &gameRunning.pacman);
-		Position nextPosition = ghost_calculate_next_position(gameRunning.ghost);
-    unsigned char* currentCell = &gameRunning.gameMap[gameRunning.ghost.sprite.currPos.y][gameRunning.ghost.sprite.currPos.x];
-    unsigned char* nextCell = &gameRunning.gameMap[nextPosition.y][nextPosition.x];
+// Restart the tick count and the random stream of a new game, and start recording its replay
+void game_start_replay_recording(unsigned short seed) {
+    movementTicks = 0;
+    lifeIncreases = 0;
+    pendingDirection = DIRECTION_STILL;
+    prng_seed(&gameRandom, seed);
+    replay_start_recording(seed);
+    game_post_replay_export();
+}
 
-     // Handle behavior based on the type of the next cell
-    switch (*nextCell) {
-        case CELL_FREE:
-						ghost_update_position(&gameRunning.ghost, nextPosition, currentCell, nextCell, NO_COLLISION);
-						break;
-        case CELL_TELEPORT_LEFT:
-					  ghost_update_position(&gameRunning.ghost, nextPosition, currentCell, nextCell, NO_COLLISION);
-						break;
-        case CELL_TELEPORT_RIGHT:
-            // No collision, update ghost position
-            ghost_update_position(&gameRunning.ghost, nextPosition, currentCell, nextCell, NO_COLLISION);
-            break;
-        case CELL_WALL:
-            // Collision, keep ghost- in its current position
-            ghost_update_position(&gameRunning.ghost, nextPosition, currentCell, nextCell, COLLISION);
-            break;
-				case CELL_GHOST_DOOR:
-            // Collision, keep ghost in its current position
-            ghost_update_position(&gameRunning.ghost, nextPosition, currentCell, nextCell, !isInHouse);
-            break;
-        case CELL_STANDARD_PILL:
-					  ghost_update_position(&gameRunning.ghost, nextPosition, currentCell, nextCell, NO_COLLISION);
-						break;
-        case CELL_SPECIAL_PILL:
-            ghost_update_position(&gameRunning.ghost, nextPosition, currentCell, nextCell, NO_COLLISION);
-						break;
-				
-		}	
-		
-		if(position_between_ghost_and_pacman_is_equal(gameRunning.pacman.sprite.currPos, gameRunning.ghost.sprite.currPos) && !gameStatus.ghostStatus.isDead) {
-						process_pacman_ghost_collision();
-				}
+// Movement ticks since the game started
+unsigned int game_movement_ticks() {
+    return movementTicks;
 }
-		
-// Calcola la direzione di movimento per il fantasma rosso (Blinky)
-Direction compute_ghost_direction(Ghost *ghost, Pacman *pacman) {
-    // Direzione iniziale di default
-    Direction chosenDirection = ghost->sprite.direction;
-    unsigned char index;
-
-    // Flag per controllare se il fantasma  ancora nella casa
-
-    // Sequenza iniziale per uscire dalla casa
-    if (isInHouse) {
-        if (gameRunning.gameMap[ghost->sprite.currPos.y][ghost->sprite.currPos.x] == CELL_GHOST_DOOR) {
-            // Se il fantasma  gi sulla porta, si muove in basso per uscire
-            chosenDirection = DIRECTION_UP;
-            isInHouse = 0; // Il fantasma ha lasciato la casa
-        } else {
-            // Muovi il fantasma verso la porta (esempio: verso destra)
-            chosenDirection = DIRECTION_UP;
-        }
 
-        // Aggiorna la direzione del fantasma e restituisci
-        ghost->sprite.direction = chosenDirection;
-        return chosenDirection;
+// Have the replay bytes recorded so far sent over CAN (the simulator keeps them in RAM)
+void game_post_replay_export() {
+    if (!IS_SIMULATOR) {
+        task_post(TASK_REPLAY_EXPORT);
     }
+}
 
-    // Posizioni candidate per il movimento (destra, sinistra, su, gi)
-    const Position possibleMoves[4] = {
-        {.x = ghost->sprite.currPos.x + 1, .y = ghost->sprite.currPos.y},  // DESTRA
-        {.x = ghost->sprite.currPos.x - 1, .y = ghost->sprite.currPos.y},  // SINISTRA
-        {.x = ghost->sprite.currPos.x, .y = ghost->sprite.currPos.y - 1},  // SU
-        {.x = ghost->sprite.currPos.x, .y = ghost->sprite.currPos.y + 1},  // GI
-    };
-		
-		const Direction possibleDirections[4] = {
-        DIRECTION_RIGHT, DIRECTION_LEFT, DIRECTION_UP, DIRECTION_DOWN
-    };
-		
-		// Determina la direzione opposta a quella attuale
-    Direction oppositeDirection;
-    switch (ghost->sprite.direction) {
-        case DIRECTION_RIGHT: oppositeDirection = DIRECTION_LEFT; break;
-        case DIRECTION_LEFT: oppositeDirection = DIRECTION_RIGHT; break;
-        case DIRECTION_UP: oppositeDirection = DIRECTION_DOWN; break;
-        case DIRECTION_DOWN: oppositeDirection = DIRECTION_UP; break;
-        default: oppositeDirection = ghost->sprite.direction; break;
-    }
-
-
-    unsigned char maxDistance = 0;
-    unsigned char minDistance = 255;
-
-    // Variabili temporanee per il calcolo
-    Position tempPosition;
-    unsigned char tempDistance;
-
-    // Ciclo attraverso i movimenti possibili
-    for (index = 0; index < 4; index++) {
-			
-				// Esclude la direzione opposta a quella attuale
-        if (possibleDirections[index] == oppositeDirection) {
-            continue;
-        }
+/**
+ * @brief Replay export task: sends the recorded bytes not sent yet.
+ */
+void game_replay_export() {
+    replay_export_can(1);
+}
 
-				
-        tempPosition = possibleMoves[index];
-			
-				
+/**
+ * @brief Saves the running game as a snapshot blob (see game_snapshot.h).
+ *
+ * Called from thread mode, between two game ticks.
+ *
+ * @return Size of the blob, 0 if the game is over or the buffer is too small.
+ */
+unsigned int game_take_snapshot(unsigned char* buffer, unsigned int size) {
+    unsigned char id;
+    unsigned int remaining;
 
-        // Esclude posizioni non valide (muri o posizioni precedenti)
-        if (gameRunning.gameMap[tempPosition.y][tempPosition.x] == CELL_WALL || 
-						gameRunning.gameMap[tempPosition.y][tempPosition.x] == CELL_GHOST_DOOR || 
-						(tempPosition.x == ghost->sprite.prevPos.x && tempPosition.y == ghost->sprite.prevPos.y)) {
-            continue;
-        }
+    if (gameStatus.isEnded) {
+        return 0;
+    }
+    snapshotStaging.running = gameRunning;
+    snapshotStaging.specialPillsGenerated = gameStatus.specialPillsGenerated;
+    ghosts_get_mode_state(&snapshotStaging.ghostModes);
+    snapshotStaging.movementTicks = movementTicks;
+    snapshotStaging.gameRandom = gameRandom;
+    snapshotStaging.lifeIncreases = lifeIncreases;
+    snapshotStaging.pendingDirection = pendingDirection;
+    for (id = 0; id < SNAPSHOT_EVENT_COUNT; id++) {
+        remaining = scheduler_event_remaining((EventID)id);
+        snapshotStaging.eventDelays[id] = (remaining > 0xFFFF) ? 0xFFFF : remaining;
+    }
+    return snapshot_encode(&snapshotStaging, buffer, size);
+}
 
-        // Calcola la distanza ibrida tra la posizione corrente e quella di Pacman
-        tempDistance = euclidean_distance(tempPosition, pacman->sprite.currPos);
+/**
+ * @brief Replaces the current game with a snapshot, paused.
+ *
+ * The blob is checked as a whole first, an invalid one leaves the game
+ * untouched. Only the cells that differ from the current maze are drawn
+ * again (the whole screen after the end of a game). The replay recording
+ * restarts with seed 0: its ticks continue from the snapshot.
+ *
+ * @return 1 if the snapshot was restored, 0 if the blob was rejected.
+ */
+unsigned char game_restore_snapshot(const unsigned char* data, unsigned int length) {
+    unsigned char ghost;
 
-        if (ghost->status.isVulnerable) {  // Modalit spaventata
-            if (tempDistance > maxDistance) {
-                maxDistance = tempDistance;
-                chosenDirection = (Direction)(index + 1);
-            }
-        } else {  // Modalit di inseguimento
-            if (tempDistance < minDistance) {
-                minDistance = tempDistance;
-                chosenDirection = (Direction)(index + 1);
-            }
-        }
+    if (!snapshot_decode(data, length, &snapshotStaging)) {
+        return 0;
+    }
+    if (!gameEventsFrozen) {
+        game_events_toggle();
     }
 
-    // Aggiorna la direzione del fantasma
-    ghost->sprite.direction = chosenDirection;
-    return chosenDirection;
-}
+    // The game resumes paused: the banners are taken off, the actors hidden and the maze updated in place
+    // (after a lost life or the end of the game the screen no longer shows the live maze: it is redrawn whole)
+    if (!gameStatus.isEnded && !gameStatus.isFailed) {
+        overlay_pop_all();
+        draw_cell((CellType)gameRunning.gameMap[gameRunning.pacman.sprite.currPos.y][gameRunning.pacman.sprite.currPos.x],
+                  gameRunning.pacman.sprite.currPos);
+        ghosts_undraw_all();
+        game_redraw_restored_map(&snapshotStaging.running.gameMap);
+    }
 
-// Calcola la distanza Euclidea tra due posizioni
-unsigned char euclidean_distance(Position p1, Position p2) {
-    short dx = (short)p1.x - (short)p2.x;
-    short dy = (short)p1.y - (short)p2.y;
-    return (unsigned char)sqrtf((dx * dx) + (dy * dy));
-}
-		
-// Update Pac-Man's position
-void ghost_update_position(Ghost* ghost, Position nextPosition, unsigned char* currentCell, unsigned char* nextCell, unsigned char isCollision) {
-    // Update the previous position
-    ghost->sprite.prevPos = ghost->sprite.currPos;  // Accedi alla prevPos di Sprite
+    gameRunning = snapshotStaging.running;
+    gameStatus.specialPillsGenerated = snapshotStaging.specialPillsGenerated;
+    ghosts_set_mode_state(&snapshotStaging.ghostModes);
+    movementTicks = snapshotStaging.movementTicks;
+    gameRandom = snapshotStaging.gameRandom;
+    lifeIncreases = snapshotStaging.lifeIncreases;
+    pendingDirection = snapshotStaging.pendingDirection;
 
-    // If there's no collision, update Pac-Man's current position
-    if (isCollision == NO_COLLISION) {
-        ghost->sprite.currPos = nextPosition;  // Accedi alla currPos di Sprite
+    movement_set_tunnel(&level_get(gameRunning.level)->tunnel);
+    collision_reset();
+    hud_clear_popup();
+    collision_place(ACTOR_PACMAN, gameRunning.pacman.sprite.currPos);
+    for (ghost = 0; ghost < GHOST_COUNT; ghost++) {
+        collision_place(ACTOR_GHOST(ghost), gameRunning.ghosts.currPos[ghost]);
     }
+    game_update_actor_speeds();
+    game_schedule_events(snapshotStaging.eventDelays);   // Frozen until the game is resumed
 
-    // Update Pac-Man's animation
-    ghost_update_animation();
+    replay_start_recording(0);
+    game_post_replay_export();
 
-    // Redraw the cells on the game map
-    draw_cell(*currentCell, ghost->sprite.prevPos);  // Restore the previous cell
-    draw_cell(CELL_GHOST, ghost->sprite.currPos);  // Draw Pac-Man in the new position
+    if (gameStatus.isEnded || gameStatus.isFailed) {
+        overlay_discard_all();
+        draw_game_map();
+        draw_area_stat();
+    }
+    game_draw_actors();
+    gameStatus.isEnded = 0;
+    gameStatus.isFailed = 0;
+    gameStatus.isPaused = 1;
+    update_game_stats_display();
+    game_draw_pause_screen();
+    return 1;
 }
 
-void ghost_update_animation() {
-    // Increment the animation frame and reset if it exceeds the maximum
-    if (++gameRunning.ghost.sprite.animationFrame > MAX_ANIMATION_FRAMES) {
-        gameRunning.ghost.sprite.animationFrame = 0;
-    }
+// Resume the game that was paused before the last reset, if its snapshot survived
+unsigned char game_restore_retained_snapshot() {
+    return game_restore_snapshot(RETAINED_SNAPSHOT, SNAPSHOT_RETAINED_SIZE);
 }
 
-// Calculate the next position for Pac-Man
-Position ghost_calculate_next_position(Ghost ghost) {
-    Position nextPosition = ghost.sprite.currPos;
+// Draw the cells of a restored maze that differ from the current one
+void game_redraw_restored_map(const GameMap* restoredMap) {
+    Position position;
 
-    switch (ghost.sprite.direction) {
-        case DIRECTION_STILL:
-            break;
-        case DIRECTION_RIGHT:
-            if (game_handle_teleport(&nextPosition, ghost.sprite.direction)) break;
-            nextPosition.x++;
-            break;
-        case DIRECTION_LEFT:
-            if (game_handle_teleport(&nextPosition, ghost.sprite.direction)) break;
-            nextPosition.x--;
-            break;
-        case DIRECTION_UP:
-            nextPosition.y--;
-            break;
-        case DIRECTION_DOWN:
-            nextPosition.y++;
-            break;
+    for (position.y = 0; position.y < GAME_MAP_HEIGHT; position.y++) {
+        for (position.x = 0; position.x < GAME_MAP_WIDTH; position.x++) {
+            if ((*restoredMap)[position.y][position.x] != gameRunning.gameMap[position.y][position.x]) {
+                draw_cell((CellType)(*restoredMap)[position.y][position.x], position);
+            }
+        }
     }
-    return nextPosition;
 }
 
-unsigned char position_between_ghost_and_pacman_is_equal(Position posPacman, Position posGhost) {
-	return ((posPacman.x == posGhost.x) && (posPacman.y == posGhost.y));
-}
+// Handle teleportation
+unsigned char game_handle_teleport(Position* position, Direction direction) {
+    unsigned char* cell = &gameRunning.gameMap[position->y][position->x];
+
+    if ((*cell == CELL_TELEPORT_LEFT) && (direction == DIRECTION_LEFT)) {
+        position->x = GAME_MAP_WIDTH - 1;
+        return 1;
+    }
+    if ((*cell == CELL_TELEPORT_RIGHT) && (direction == DIRECTION_RIGHT)) {
+        position->x = 0;
+        return 1;
+    }
 
+    return 0;
+}
 
 // Process the collision between Pac-Man and a ghost
-void process_pacman_ghost_collision() {
-    if (gameRunning.ghost.status.isVulnerable) {
-        process_ghost_death();
+void process_pacman_ghost_collision(GhostID ghost) {
+    if (ghosts_is_edible(ghost)) {
+        ghosts_eat(ghost);
+        draw_cell(CELL_PACMAN, gameRunning.pacman.sprite.currPos);  // The eyes leave from under Pac-Man
         score_update(GAME_CONFIG.ghostEatPoint);
+        hud_popup(gameRunning.pacman.sprite.currPos, GAME_CONFIG.ghostEatPoint);
     } else {
         game_trigger_failure();
     }
 }
 
-// Process the death of a ghost (Blinky)
-void process_ghost_death() {
-    gameRunning.ghost.status.isDead = 1;
-    gameRunning.ghost.status.isVulnerable = 0;
-		isInHouse = 1;
-    ghostVunerableTickReset = 1;
-
-    disable_timer(1);  // Disable the timer for the ghost's actions
-}
-
-// Revive the ghost (Blinky)
-void revive_ghost() {
-		game_ghost_spawn();
-    gameRunning.ghost.status.currentSpeed = GAME_CONFIG.ghostConfig.minSpeed;
-	  
-		reset_timer(1);
-		init_timer(1,0,0,3, 0x002625A0);
-    enable_timer(1);  // Enable the timer for the ghost's actions
-	  gameRunning.ghost.status.isDead = 0; // Blinky is revived
-
-}
-
 // Update the score based on the pill type
 void score_update(CellType pill_type) {
     if (pill_type == CELL_STANDARD_PILL) {
         gameRunning.score += GAME_CONFIG.standardPillPoint;
         gameRunning.remainingPills--;
     } else if (pill_type == CELL_SPECIAL_PILL) {
-				gameRunning.ghost.status.isVulnerable = 1;
-				ghostVunerableTickReset = 1;
+				ghosts_frighten();   // The frightened time comes from the level table
+				game_update_actor_speeds();
 				set_current_track(TRACK_EAT_SPECIAL_PILL_SOUND_EFFECT);
         gameRunning.score += GAME_CONFIG.specialPillPoint;
         gameRunning.remainingPills--;
     }
 
-    update_game_score_display(gameRunning.score);
+    update_game_stats_display();
 }
 
 // Update the number of lives
 void lives_update() {
-    static unsigned char life_increases = 0;
-    if (gameRunning.score >= ((life_increases + 1) * GAME_CONFIG.pointsPerExtraLife)) {
-        life_increases++;
+    if (gameRunning.score >= ((lifeIncreases + 1) * GAME_CONFIG.pointsPerExtraLife)) {
+        lifeIncreases++;
         if (gameRunning.remainingLives < GAME_CONFIG.maxLives) {
             gameRunning.remainingLives++;
         }
     }
 		set_current_track(TRACK_EARN_NEW_LIFE_SOUND_EFFECT);
-    update_lives_display(gameRunning.remainingLives);
+    update_game_stats_display();
 }
 
 /**
- * @brief Updates the game time display based on the current environment.
- * 
- * If the program is running in the simulator, it directly updates the display
- * using the `draw_time_stat` function. Otherwise, it sends the updated game time
- * via CAN communication.
+ * @brief Requests a refresh of the game statistics (time, score and lives).
  * 
- * @param time_value The current game time to display.
+ * Nothing is drawn or sent here: in the simulator the next frame redraws the
+ * values that changed, on the board the CAN drain task sends the latest
+ * values. Several updates within the same frame are coalesced into one.
  */
-void update_game_time_display(unsigned char time_value) {
+void update_game_stats_display() {
     if (IS_SIMULATOR) {  // No CAN communication in the simulator
-        draw_time_stat(time_value);  // Update the time display directly
+        hud_request();
     } else {
-        transmit_CAN_data();  // Send updated game data via CAN
+        task_post(TASK_CAN_TX_DRAIN);
     }
 }
 
 /**
- * @brief Updates the game score display based on the current environment.
+ * @brief HUD layer of a frame: redraws the statistics that changed since the last update.
  * 
- * If the program is running in the simulator, it directly updates the display
- * using the `draw_stat_score` function. Otherwise, it sends the updated game score
- * via CAN communication.
- * 
- * @param score_value The current game score to display.
+ * The simulator shows its own game state, the board shows the last statistics
+ * received over CAN.
  */
-void update_game_score_display(unsigned short score_value) {
-    if (IS_SIMULATOR) {  // No CAN communication in the simulator
-        draw_stat_score(score_value);  // Update the score display directly
-    } else {
-        transmit_CAN_data();  // Send updated game data via CAN
+void game_render_flush() {
+    unsigned char stats[8];
+
+    if (IS_SIMULATOR) {
+        encode_game_stats(stats);
+        handle_CAN_update_stats(stats);
+    } else if (take_CAN_received_stats(stats)) {
+        handle_CAN_update_stats(stats);
     }
+    hud_flush();   // Also after a full redraw with no new statistics
 }
 
-/**
- * @brief Updates the lives display based on the current environment.
- * 
- * If the program is running in the simulator, it directly updates the display
- * using the `draw_status_lives` function. Otherwise, it sends the updated lives count
- * via CAN communication.
- * 
- * @param lives_value The current number of lives to display.
- */
-void update_lives_display(unsigned char lives_value) {
-    if (IS_SIMULATOR) {  // No CAN communication in the simulator
-        draw_status_lives(lives_value);  // Update the lives display directly
-    } else {
-        transmit_CAN_data();  // Send updated game data via CAN
-    }
+// Encode the remaining time, lives and score (big-endian) as sent over CAN
+void encode_game_stats(unsigned char data[8]) {
+    data[0] = gameRunning.remainingTime;           // Remaining time
+    data[1] = gameRunning.remainingLives;          // Remaining lives
+    data[2] = (gameRunning.score & 0xFF00) >> 8;   // High byte of the score
+    data[3] = gameRunning.score & 0xFF;            // Low byte of the score
 }
 
 /**
- * @brief Transmits the current game data via CAN communication.
+ * @brief CAN drain task: transmits the current game data via CAN communication.
  * 
  * This function encodes the current game state (remaining time, lives, and score) 
  * into a CAN message and sends it using the `CAN_wrMsg` function.
  */
 void transmit_CAN_data() {
     // Encode the remaining time, lives, and score into the CAN message
-    CAN_TxMsg.data[0] = gameRunning.remainingTime;           // Remaining time
-    CAN_TxMsg.data[1] = gameRunning.remainingLives;          // Remaining lives
-    CAN_TxMsg.data[2] = (gameRunning.score & 0xFF00) >> 8;   // High byte of the score
-    CAN_TxMsg.data[3] = gameRunning.score & 0xFF;            // Low byte of the score
+    encode_game_stats(CAN_TxMsg.data);
 
     // Set CAN message properties
     CAN_TxMsg.len = 4;                  // Data length
@@ -721,15 +690,29 @@ void transmit_CAN_data() {
     CAN_wrMsg(1, &CAN_TxMsg);
 }
 
+/**
+ * @brief Profiler report task: sends the interrupt profile of the last window and starts a new one.
+ * 
+ * The simulator prints the table through semihosting, the board sends it over CAN
+ * (see profiler_report_can for the frame layout).
+ */
+void game_profiler_report() {
+    if (IS_SIMULATOR) {
+        profiler_report_text();
+    } else {
+        profiler_report_can(1);
+    }
+    profiler_reset();
+}
+
 
 // Generate a special pill
 void pill_generate_special() {
-    // Generate a random timer index and use its value for randomness
-    int random_timer_index = rand() % TIMER_COUNT; // Select a random timer (0 to 3)
-    unsigned char random_value = get_game_timer_value(random_timer_index) % 101; // Normalize to [0, 100]
+    // Draw from the seeded game stream, so that a replay generates the same pills
+    unsigned char random_value = prng_next(&gameRandom) % 101; // Normalize to [0, 100]
 
     // Check if the random value exceeds the threshold or if we already generated enough special pills
-    if ((random_value > PROBABILITY_THRESHOLD) || (gameStatus.specialPillsGenerated >= GAME_CONFIG.specialPillCount)) {
+    if ((random_value > PROBABILITY_THRESHOLD) || (gameStatus.specialPillsGenerated >= level_get(gameRunning.level)->specialPillCount)) {
         return; // Do not generate a new special pill
     }
 
@@ -747,7 +730,7 @@ void pill_transform_to_special(Position position) {
     draw_cell(CELL_SPECIAL_PILL, position); // Draw the special pill on the game map
 }
 
-// Generate a random seed using a combination of two random timers and predefined constants
+// Generate a random seed using a combination of two random timers and predefined constants (hardware entropy, once per game)
 int random_generate_seed() {
     int random_timer_index1 = rand() % TIMER_COUNT; // Select the first random timer index
     int random_timer_index2 = rand() % TIMER_COUNT; // Select the second random timer index
@@ -764,30 +747,11 @@ int random_generate_seed() {
            RANDOM_SEED_CONSTANT;
 }
 
-// Generate a random position within the game map
+// Generate a random position within the game map (from the seeded game stream)
 Position random_generate_position() {
-    srand(random_generate_seed()); // Seed the random number generator
-    return (Position){.y = rand() % GAME_MAP_HEIGHT, .x = rand() % GAME_MAP_WIDTH}; // Generate random coordinates
-}
-
-void timer_toggle_set(unsigned char timer0, unsigned char timer1, unsigned char timer2, unsigned char timer3) {
-	if(timer0)
-		start_stop_game_timer(0);
-	
-	if(timer1)
-		start_stop_game_timer(1);
-	
-	if(timer2)
-		start_stop_game_timer(2);
-	
-	if(timer3)
-		start_stop_game_timer(3);
-}
+    Position position;
 
-// Toggle all game timers
-void timer_toggle_all() {
-	  start_stop_game_timer(0);
-		start_stop_game_timer(1);
-		start_stop_game_timer(2);
-		start_stop_game_timer(3);
+    position.y = prng_next(&gameRandom) % GAME_MAP_HEIGHT;
+    position.x = prng_next(&gameRandom) % GAME_MAP_WIDTH;
+    return position;
 }
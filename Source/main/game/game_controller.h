@@ -7,21 +7,58 @@
 #include "game_utils.h"
 #include "../game_melodies.h"
 #include "../CAN/CAN.h"
+#include "../event_scheduler.h"
+#include "game_movement.h"
+#include "game_ghosts.h"
+#include "game_collision.h"
+#include "game_overlay.h"
+#include "game_wipe.h"
+#include "game_band.h"
+#include "game_frame.h"
+#include "game_hud.h"
+#include "game_tiles.h"
+#include "game_replay.h"
+#include "game_snapshot.h"
+#include "../task_scheduler.h"
+#include "../cpu_profiler.h"
+#include "../game_canComuntication.h"
 // Constant for generating random seeds
 #define RANDOM_SEED_CONSTANT 1103515245
 
+// How level_initialize updates the screen
+#define LEVEL_SCREEN_KEEP 0   // Same maze after a lost life: only the statistics change
+#define LEVEL_SCREEN_DRAW 1   // New game: the maze is drawn whole
+#define LEVEL_SCREEN_WIPE 2   // Next maze: it slides in with a scroll wipe
+
 // Level initialization
-void level_initialize(unsigned short is_first_initialization);
+void level_initialize(unsigned short screen);
 
 // Game control functions
 void game_play_tone_single_note();
-void game_play_tone_single_note_duration();
-void game_process_movement_of_ghost();
+void game_play_tone_all_track();
+void game_process_pacman_step();
+void game_process_movement_tick();
+void game_update_actor_speeds();
+void process_pacman_ghost_collision(GhostID ghost);
+void game_events_toggle();
 void game_handle_pause();
 void game_update_time();
-void game_process_next_tick();
+void game_render_flush();
+void transmit_CAN_data();
+void game_profiler_report();
 void game_pacman_handle_direction_change(Direction new_direction);
 
+// Replay recording
+void game_start_replay_recording(unsigned short seed);
+unsigned int game_movement_ticks();
+void game_post_replay_export();
+void game_replay_export();
+
+// Save states
+unsigned int game_take_snapshot(unsigned char* buffer, unsigned int size);
+unsigned char game_restore_snapshot(const unsigned char* data, unsigned int length);
+unsigned char game_restore_retained_snapshot();
+
 // Pill-related functions
 void pill_generate_special();
 
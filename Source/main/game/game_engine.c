@@ -1,21 +1,17 @@
 #include "game_engine.h"
 // Global game configuration (initialized with default values)
 const GameConfig GAME_CONFIG = {
-    .maxTime = 60,                // Tempo massimo di gioco in secondi
     .startLives = 1,               // Numero di vite iniziali
     .maxLives = 5,                 // Numero massimo di vite
     .pointsPerExtraLife = 1000,    // Punti necessari per una vita extra
-    .standardPillCount = 240,      // Numero di pillole standard
-    .specialPillCount = 6,         // Numero di pillole speciali
     .standardPillPoint = 10,       // Punti per una pillola standard
     .specialPillPoint = 50,        // Punti per una pillola speciale
     .ghostEatPoint = 100,          // Punti quando Pacman mangia un fantasma
-    .pacmanSpeed = 5,              // Velocit di Pacman
-    .ghostConfig = {               // Configurazione del fantasma Blinky
+    .pacmanSpeed = 12,             // Velocit di riferimento (100%) in tile al secondo
+    .smoothMotion = 1,             // Gli sprite scorrono fra le celle
+    .ghostConfig = {               // Configurazione comune dei fantasmi
         .minSpeed = 2,             // Velocit minima
         .maxSpeed = 6,             // Velocit massima
-        .respawnTime = 3,          // Tempo di respawn (in secondi)
-        .blueTime = 10,            // Durata vulnerabilit (in secondi)
         .accelInterval = 30        // Intervallo di accelerazione (in tick)
     }
 };
@@ -23,41 +19,17 @@ const GameConfig GAME_CONFIG = {
 // Game running state initialization
 GameRunning gameRunning = {
     .gameMap = {},                 // Inizializza la mappa del gioco a vuota
-    .remainingTime = 60,          // Tempo di gioco rimanente
+    .level = 1,                    // Livello iniziale
     .remainingLives = 1,           // Numero iniziale di vite
     .score = 0,                    // Punteggio iniziale
-    .remainingPills = 240,         // Totale pillole standard rimanenti
+                                   // Tempo, pillole e posizioni vengono impostati da level_initialize
     .pacman = {                    // Stato iniziale di Pacman
         .sprite = {
-            .currPos = {PACMAN_SPAWN_X, PACMAN_SPAWN_Y}, // Posizione iniziale di Pacman
-            .prevPos = {PACMAN_SPAWN_X, PACMAN_SPAWN_Y},
             .direction = DIRECTION_STILL,
             .animationFrame = 0
-        },
-        .speed = 5                  // Velocit iniziale di Pacman
-    },
-    .ghost = {                     // Stato iniziale di Blinky (Fantasma)
-        .sprite = {
-            .currPos = {GHOST_SPAWN_X, GHOST_SPAWN_Y}, // Posizione iniziale del fantasma
-            .prevPos = {GHOST_SPAWN_X, GHOST_SPAWN_Y},
-            .direction = DIRECTION_STILL,
-            .animationFrame = 0
-        },
-        .config = {                 // Configurazione del fantasma
-            .minSpeed = 2,          // Velocit minima
-            .maxSpeed = 6,          // Velocit massima
-            .respawnTime = 3,       // Tempo di respawn
-            .blueTime = 10,         // Tempo di vulnerabilit
-            .accelInterval = 30     // Intervallo di accelerazione
-        },
-        .status = {                 // Stato iniziale del fantasma
-            .currentSpeed = 2,      // Velocit iniziale
-            .isDead = 0,            // Fantasma vivo
-            .isVulnerable = 0,      // Fantasma non vulnerabile
-            .respawnTimer = 0,      // Timer di respawn inattivo
-            .vulnerabilityTimer = 0 // Timer di vulnerabilit inattivo
         }
-    }
+    },
+    .ghosts = {}                   // I fantasmi vengono posizionati da level_initialize
 };
 
 // Game status initialization
@@ -65,12 +37,5 @@ GameStatus gameStatus = {
     .isPaused = 0,                 // Game is not paused
     .isFailed = 0,                 // Game is not failed
     .isEnded = 0,                  // Game is not ended
-    .specialPillsGenerated = 0,    // No special pills generated yet
-    .ghostStatus = {               // Ghost status for Blinky
-        .currentSpeed = 2,
-        .isDead = 0,
-        .isVulnerable = 0,
-        .respawnTimer = 0,
-        .vulnerabilityTimer = 0
-    }
+    .specialPillsGenerated = 0     // No special pills generated yet
 };
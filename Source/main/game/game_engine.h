@@ -52,12 +52,6 @@
 #define SCORE_VALUE_START_X   (SCORE_AREA_START_X + 16)
 #define LIVES_VALUE_START_X   (16)
 
-/* Game Constants */
-#define PACMAN_SPAWN_X        14
-#define PACMAN_SPAWN_Y        23
-#define GHOST_SPAWN_X 				13
-#define GHOST_SPAWN_Y					12
-
 /* Type Definitions */
 
 // Direction Enum
@@ -97,12 +91,13 @@ typedef struct {
     Position prevPos;       // Previous position
     Direction direction;    // Current movement direction
     unsigned char animationFrame; // Animation frame
+    unsigned short speed;   // Tile progress per movement tick (1/65536 of a tile)
+    unsigned short progress; // Progress towards the next tile (1/65536 of a tile)
 } Sprite;
 
 // PacMan Configuration
 typedef struct {
     Sprite sprite;  // Base sprite (inherits common properties)
-    unsigned char speed;  // PacMan's speed
 } Pacman;
 
 // Ghost Configuration
@@ -110,50 +105,66 @@ typedef struct {
     Sprite sprite;   // Base Character (inherits common properties)
     unsigned char minSpeed;    // Ghost's min speed
     unsigned char maxSpeed;    // Ghost's max speed
-    unsigned short respawnTime; // Time to respawn
-    unsigned char blueTime;     // Time when the ghost is vulnerable
     unsigned short accelInterval; // Interval at which the ghost accelerates
 } GhostConfig;
 
-// Ghost Status (State during game)
-typedef struct {
-    unsigned char currentSpeed;   // Current speed of the ghost
-    unsigned char isDead;         // If the ghost is dead
-    unsigned char isVulnerable;   // If the ghost is vulnerable
-    unsigned short respawnTimer;  // Time remaining before respawn
-    unsigned short vulnerabilityTimer;  // Vulnerability timer
-} GhostStatus;
+// Ghosts, in arcade order (also the index in the ghost table)
+typedef enum {
+    GHOST_BLINKY = 0, // Red, chases Pac-Man directly
+    GHOST_PINKY  = 1, // Pink, aims ahead of Pac-Man
+    GHOST_INKY   = 2, // Cyan, flanks Pac-Man with Blinky
+    GHOST_CLYDE  = 3  // Orange, retreats when too close
+} GhostID;
 
+#define GHOST_COUNT 4
+
+// Ghost Modes (states of the ghost mode machine)
+typedef enum {
+    GHOST_MODE_IN_HOUSE   = 0, // Waiting inside the house for its release
+    GHOST_MODE_LEAVING    = 1, // Walking out of the house through the door
+    GHOST_MODE_SCATTER    = 2, // Heading to its home corner
+    GHOST_MODE_CHASE      = 3, // Hunting Pac-Man with its own targeting
+    GHOST_MODE_FRIGHTENED = 4, // Vulnerable, wandering at random
+    GHOST_MODE_EATEN      = 5, // Eyes going back to the house
+    GHOST_MODE_COUNT
+} GhostMode;
+
+// Ghost actor table: one array per property, indexed by GhostID
 typedef struct {
-	Sprite sprite;
-	GhostConfig config;
-  GhostStatus status;
-} Ghost;
+    Position currPos[GHOST_COUNT];            // Current positions
+    Position prevPos[GHOST_COUNT];            // Previous positions
+    unsigned char direction[GHOST_COUNT];     // Movement directions (Direction)
+    unsigned char animationFrame[GHOST_COUNT]; // Animation frames
+    unsigned short speed[GHOST_COUNT];        // Tile progress per movement tick (1/65536 of a tile)
+    unsigned short progress[GHOST_COUNT];     // Progress towards the next tile (1/65536 of a tile)
+    unsigned char mode[GHOST_COUNT];          // Current modes (GhostMode)
+    unsigned char currentSpeed[GHOST_COUNT];  // Acceleration level (minSpeed to maxSpeed)
+    unsigned short timer[GHOST_COUNT];        // Movement ticks left before the release from the house
+} GhostTable;
 
 // Game Configuration Structure
 typedef struct {
-    unsigned char maxTime;           // Maximum time for the game
     unsigned char startLives;        // Number of lives at the start
     unsigned char maxLives;          // Maximum number of lives
     unsigned short pointsPerExtraLife; // Points for an extra life
-    unsigned char standardPillCount;  // Number of standard pills
-    unsigned char specialPillCount;   // Number of special pills
     unsigned short standardPillPoint; // Score for a standard pill
     unsigned short specialPillPoint;  // Score for a special pill
 		unsigned short ghostEatPoint;		// Score Points when pacman eats a Ghost
-    unsigned char pacmanSpeed;       // Pacman speed
+    unsigned char pacmanSpeed;       // Reference speed (100%) in tiles per second
+    unsigned char smoothMotion;      // Sprites slide between the cells (1) or jump from one to the next (0)
     GhostConfig ghostConfig;         // Ghost configuration
 } GameConfig;
 
 // Game Running State
 typedef struct {
     GameMap gameMap;               // Current game map
+    unsigned char level;            // Current level (1-based)
     unsigned char remainingTime;    // Time remaining
     unsigned char remainingLives;   // Remaining lives
     unsigned short score;           // Player's score
     unsigned char remainingPills;   // Number of remaining pills
     Pacman pacman;                  // PacMan's state
-    Ghost ghost;                    // Blinky ghost state
+    GhostTable ghosts;              // Blinky, Pinky, Inky and Clyde
 } GameRunning;
 
 // Game Status Structure
@@ -162,7 +173,6 @@ typedef struct {
     unsigned char isFailed;        // Game failed state
     unsigned char isEnded;         // Game over or victory state
     unsigned char specialPillsGenerated; // Number of special pills generated
-    GhostStatus ghostStatus;       // Ghost status during the game
 } GameStatus;
 
 extern const GameConfig GAME_CONFIG; // Global configuration
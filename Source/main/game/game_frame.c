@@ -0,0 +1,95 @@
+#include "game_frame.h"
+#include "../critical_section.h"
+#include "game_band.h"
+#include "game_controller.h"
+
+#define FRAME_MASK(layer) (1U << (layer))
+
+static volatile unsigned char pendingLayers = 0;   // Layers with something to draw
+static FrameStats stats;
+
+// EVENT_FRAME: the frame is drawn in thread mode, once the game tick due with it is over
+static void frame_due(void) {
+    task_post(TASK_RENDER_FLUSH);
+}
+
+/**
+ * @brief Asks for a layer to be drawn in the next frame (callable from an interrupt).
+ *
+ * @param layer Layer with something new to draw.
+ */
+void frame_request(FrameLayer layer) {
+    ENTER_CRITICAL();
+    if (pendingLayers & FRAME_MASK(layer)) {
+        stats.merged++;
+    }
+    pendingLayers |= FRAME_MASK(layer);
+    if (!scheduler_event_is_active(EVENT_FRAME)) {   // Already set for the next grid point otherwise
+        scheduler_start_event(EVENT_FRAME, frame_due, FRAME_TICKS - (scheduler_now() % FRAME_TICKS), 0);
+    }
+    EXIT_CRITICAL();
+}
+
+// Count a request that an earlier one of the same frame already covers
+void frame_count_merged(void) {
+    stats.merged++;
+}
+
+// Something is still to be drawn
+unsigned char frame_pending(void) {
+    return pendingLayers || scheduler_event_is_active(EVENT_FRAME);
+}
+
+/**
+ * @brief Render flush task: draws the layers requested since the last frame, within the budget.
+ */
+void frame_run(void) {
+    const uint32_t start = CPU_CYCLE_COUNT();
+    const uint32_t preempted = profiler_preempted_cycles();
+    unsigned short cellsLeft = 0;
+    unsigned char spilled = 0;
+    unsigned char layers;
+    unsigned int elapsed;
+
+    {
+        ENTER_CRITICAL();
+        layers = pendingLayers;
+        pendingLayers = 0;
+        EXIT_CRITICAL();
+    }
+    if (!layers) {
+        return;
+    }
+
+    if (layers & FRAME_MASK(FRAME_CELLS)) {
+        cellsLeft = band_flush_budget(start, FRAME_BUDGET_CYCLES);
+        if (cellsLeft) {
+            stats.spilledCells += cellsLeft;
+            spilled = 1;
+            frame_request(FRAME_CELLS);
+        }
+    }
+    if (layers & FRAME_MASK(FRAME_HUD)) {
+        if (cellsLeft || (CPU_CYCLE_COUNT() - start >= FRAME_BUDGET_CYCLES)) {
+            stats.spilledHud++;
+            spilled = 1;
+            frame_request(FRAME_HUD);
+        } else {
+            game_render_flush();
+        }
+    }
+
+    elapsed = (CPU_CYCLE_COUNT() - start) - (profiler_preempted_cycles() - preempted);
+    stats.frames++;
+    stats.spilledFrames += spilled;
+    stats.lastCycles = elapsed;
+    stats.maxCycles = (elapsed > stats.maxCycles) ? elapsed : stats.maxCycles;
+}
+
+const FrameStats* frame_get_stats(void) {
+    return &stats;
+}
+
+void frame_reset_stats(void) {
+    memset(&stats, 0, sizeof(stats));
+}
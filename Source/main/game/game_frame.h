@@ -0,0 +1,54 @@
+#ifndef __GAME_FRAME_H
+#define __GAME_FRAME_H
+
+#include "game_engine.h"
+
+/*
+ * Frame pacer.
+ *
+ * The game state changes whenever an event or an interrupt says so, but
+ * the screen only follows in frames, on a fixed grid of FRAME_TICKS
+ * scheduler ticks. A draw request (a maze cell marked by the band
+ * renderer, a due HUD update from game_hud.h) arms EVENT_FRAME
+ * for the next grid point; nothing runs while nothing changes, so the
+ * scheduler stays tickless. The event posts TASK_RENDER_FLUSH, which runs
+ * after the game tick that was due with it, and draws the layers in
+ * order: the maze cells (each one composed background first, sprites
+ * over it), then the HUD values that changed.
+ *
+ * Requests are merged at their source: a cell marked twice is one dirty
+ * bit, the HUD redraws only the values that differ from the screen. A
+ * frame starts no new burst once FRAME_BUDGET_CYCLES have passed: the
+ * cells and the HUD left over spill to the next frame, so a burst of
+ * drawing never holds the game tick back by more than one run.
+ */
+
+#define FRAME_TICKS          2                 // Scheduler ticks per frame (20 ms, 50 frames a second)
+#define FRAME_BUDGET_CYCLES  (SystemCoreClock / 250)   // 4 ms of CPU, a fifth of the frame
+
+// Layers of a frame, in drawing order
+typedef enum {
+    FRAME_CELLS = 0,   // Maze cells and the sprites on them (game_band.h)
+    FRAME_HUD   = 1,   // Time, score and lives (game_hud.h)
+    FRAME_LAYER_COUNT
+} FrameLayer;
+
+// Frame accounting
+typedef struct {
+    unsigned int frames;          // Frames drawn
+    unsigned int spilledFrames;   // Frames that ran out of budget
+    unsigned int spilledCells;    // Cells carried over to the next frame
+    unsigned int spilledHud;      // HUD updates carried over
+    unsigned int merged;          // Requests folded into one already pending (the same cell or the HUD twice)
+    unsigned int lastCycles;      // CPU cycles of the last frame
+    unsigned int maxCycles;       // Longest frame
+} FrameStats;
+
+void frame_request(FrameLayer layer);
+void frame_count_merged(void);
+unsigned char frame_pending(void);
+void frame_run(void);
+const FrameStats* frame_get_stats(void);
+void frame_reset_stats(void);
+
+#endif /* __GAME_FRAME_H */
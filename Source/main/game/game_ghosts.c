@@ -0,0 +1,656 @@
+#include "game_ghosts.h"
+#include "game_controller.h"
+#include "game_collision.h"
+#include "game_tiles.h"
+
+#define GHOST_DOOR_X              (maze->ghostDoor.x)        // Left column of the house door
+#define GHOST_HOUSE_ENTRANCE_Y    (maze->ghostDoor.y - 1)    // Row right above the door
+#define GHOST_HOUSE_HOME_Y        (maze->ghostDoor.y + 2)    // Row where the eyes turn back into a ghost
+#define GHOST_ANIMATION_FRAMES    3                    // Same animation cycle as Pac-Man
+#define PINKY_LOOK_AHEAD          4                    // Tiles Pinky aims ahead of Pac-Man
+#define INKY_LOOK_AHEAD           2                    // Tiles ahead of Pac-Man used as Inky's pivot
+#define CLYDE_SHY_DISTANCE        8                    // Clyde scatters when closer than this (tiles)
+#define MS_TO_MOVEMENT_TICKS(ms)  ((ms) / MOVEMENT_TICK_MS)
+#define SECONDS_TO_MOVEMENT_TICKS(s) ((unsigned short)((s) * MOVEMENT_TICKS_PER_SECOND))
+#define FRIGHTENED_FLASH_TICKS    MS_TO_MOVEMENT_TICKS(2000)  // The frightened ghosts flash over the last 2 s
+#define FRIGHTENED_FLASH_PERIOD   MS_TO_MOVEMENT_TICKS(250)   // Time in each colour while flashing
+
+/* Transition table entries */
+#define GHOST_KEEP                0xFF  // The event leaves the mode unchanged
+#define GHOST_WAVE                0x40  // Enter the mode of the current wave (scatter or chase)
+#define GHOST_REVERSE             0x80  // Turn around when entering the new mode
+#define GHOST_NEXT_MODE_MASK      0x3F
+
+// Target tile of a ghost (may lie outside the maze)
+typedef struct {
+    short x;
+    short y;
+} TargetTile;
+
+typedef TargetTile (*GhostTargeting)(void);
+typedef Direction (*GhostSteering)(GhostID ghost);
+
+// Behavior of a mode
+typedef struct {
+    GhostSteering steer;          // Direction choice on every new tile
+    unsigned char passesDoor;     // The door lets the ghost through
+    unsigned char touchesPacman;  // Meeting Pac-Man is a collision
+    unsigned char isEdible;       // Pac-Man eats the ghost instead of losing a life
+    unsigned char slowsInTunnel;  // The tunnel speed applies
+    unsigned char accelerates;    // The acceleration bonus applies
+} GhostModeTraits;
+
+// Scatter/chase schedule and frightened time of a group of levels, in movement ticks
+typedef struct {
+    unsigned char lastLevel;                     // Last level using this row (0 = every further level)
+    unsigned short frightenedTicks;              // Time the ghosts stay frightened
+    unsigned short waveTicks[GHOST_WAVE_COUNT];  // Scatter, chase, scatter... (0 = the wave never ends)
+} LevelGhostModes;
+
+static Direction steer_in_house(GhostID ghost);
+static Direction steer_leaving(GhostID ghost);
+static Direction steer_scatter(GhostID ghost);
+static Direction steer_chase(GhostID ghost);
+static Direction steer_frightened(GhostID ghost);
+static Direction steer_eaten(GhostID ghost);
+static void ghosts_select_level(void);
+static void ghost_spawn(GhostID ghost, unsigned short releaseTicks);
+static void ghost_dispatch(GhostID ghost, GhostEvent event);
+static void ghosts_dispatch_all(GhostEvent event);
+static void ghosts_next_wave(void);
+static void ghosts_update_palette(void);
+static void ghost_step(GhostID ghost);
+static unsigned char ghost_exits(GhostID ghost);
+static Direction first_exit(unsigned char exits);
+static Direction ghost_direction_to(GhostID ghost, TargetTile target);
+static Direction ghost_direction_home(GhostID ghost);
+static Position ghost_next_position(Position position, Direction direction);
+static Direction opposite_direction(Direction direction);
+static unsigned int target_distance(Position position, TargetTile target);
+static TargetTile target_ahead_of_pacman(unsigned char tiles);
+static TargetTile target_blinky(void);
+static TargetTile target_pinky(void);
+static TargetTile target_inky(void);
+static TargetTile target_clyde(void);
+
+// Mode machine: next mode of every [mode][event] pair
+static const unsigned char GHOST_TRANSITIONS[GHOST_MODE_COUNT][GHOST_EVENT_COUNT] = {
+    /*                RELEASE             LEFT_HOUSE  SCATTER                             CHASE                             FRIGHTEN                               FRIGHT_END  EATEN             HOME */
+    /* In house   */ { GHOST_MODE_LEAVING, GHOST_KEEP, GHOST_KEEP,                         GHOST_KEEP,                       GHOST_KEEP,                            GHOST_KEEP, GHOST_KEEP,       GHOST_KEEP },
+    /* Leaving    */ { GHOST_KEEP,         GHOST_WAVE, GHOST_KEEP,                         GHOST_KEEP,                       GHOST_KEEP,                            GHOST_KEEP, GHOST_KEEP,       GHOST_KEEP },
+    /* Scatter    */ { GHOST_KEEP,         GHOST_KEEP, GHOST_KEEP,                         GHOST_MODE_CHASE | GHOST_REVERSE, GHOST_MODE_FRIGHTENED | GHOST_REVERSE, GHOST_KEEP, GHOST_KEEP,       GHOST_KEEP },
+    /* Chase      */ { GHOST_KEEP,         GHOST_KEEP, GHOST_MODE_SCATTER | GHOST_REVERSE, GHOST_KEEP,                       GHOST_MODE_FRIGHTENED | GHOST_REVERSE, GHOST_KEEP, GHOST_KEEP,       GHOST_KEEP },
+    /* Frightened */ { GHOST_KEEP,         GHOST_KEEP, GHOST_KEEP,                         GHOST_KEEP,                       GHOST_KEEP,                            GHOST_WAVE, GHOST_MODE_EATEN, GHOST_KEEP },
+    /* Eaten      */ { GHOST_KEEP,         GHOST_KEEP, GHOST_KEEP,                         GHOST_KEEP,                       GHOST_KEEP,                            GHOST_KEEP, GHOST_KEEP,       GHOST_MODE_LEAVING }
+};
+
+// Behavior of every mode
+static const GhostModeTraits GHOST_MODE_TRAITS[GHOST_MODE_COUNT] = {
+    /* steering           door  touch  edible  tunnel  accel */
+    { steer_in_house,     0,    1,     0,      0,      0 },   // In house
+    { steer_leaving,      1,    1,     0,      0,      0 },   // Leaving
+    { steer_scatter,      0,    1,     0,      1,      1 },   // Scatter
+    { steer_chase,        0,    1,     0,      1,      1 },   // Chase
+    { steer_frightened,   0,    1,     1,      1,      0 },   // Frightened
+    { steer_eaten,        1,    0,     0,      0,      0 }    // Eaten
+};
+
+// Mode schedule of every group of levels (arcade progression)
+static const LevelGhostModes LEVEL_GHOST_MODES[] = {
+    {  1, SECONDS_TO_MOVEMENT_TICKS(10), { SECONDS_TO_MOVEMENT_TICKS(7), SECONDS_TO_MOVEMENT_TICKS(20), SECONDS_TO_MOVEMENT_TICKS(7), SECONDS_TO_MOVEMENT_TICKS(20),
+                                           SECONDS_TO_MOVEMENT_TICKS(5), SECONDS_TO_MOVEMENT_TICKS(20), SECONDS_TO_MOVEMENT_TICKS(5), 0 } },     // Level 1
+    {  4, SECONDS_TO_MOVEMENT_TICKS(5),  { SECONDS_TO_MOVEMENT_TICKS(7), SECONDS_TO_MOVEMENT_TICKS(20), SECONDS_TO_MOVEMENT_TICKS(7), SECONDS_TO_MOVEMENT_TICKS(20),
+                                           SECONDS_TO_MOVEMENT_TICKS(5), SECONDS_TO_MOVEMENT_TICKS(1033), 1, 0 } },                             // Levels 2-4
+    { 20, SECONDS_TO_MOVEMENT_TICKS(2),  { SECONDS_TO_MOVEMENT_TICKS(5), SECONDS_TO_MOVEMENT_TICKS(20), SECONDS_TO_MOVEMENT_TICKS(5), SECONDS_TO_MOVEMENT_TICKS(20),
+                                           SECONDS_TO_MOVEMENT_TICKS(5), SECONDS_TO_MOVEMENT_TICKS(1037), 1, 0 } },                             // Levels 5-20
+    {  0, SECONDS_TO_MOVEMENT_TICKS(1),  { SECONDS_TO_MOVEMENT_TICKS(5), SECONDS_TO_MOVEMENT_TICKS(20), SECONDS_TO_MOVEMENT_TICKS(5), SECONDS_TO_MOVEMENT_TICKS(20),
+                                           SECONDS_TO_MOVEMENT_TICKS(5), SECONDS_TO_MOVEMENT_TICKS(1037), 1, 0 } }                              // Levels 21+
+};
+
+#define LEVEL_GHOST_MODES_COUNT (sizeof(LEVEL_GHOST_MODES) / sizeof(LEVEL_GHOST_MODES[0]))
+
+// Chase targeting of every ghost
+static const GhostTargeting GHOST_TARGETING[GHOST_COUNT] = {
+    target_blinky, target_pinky, target_inky, target_clyde
+};
+
+// Home corner of every ghost (scatter target, outside the maze)
+static const TargetTile GHOST_SCATTER_CORNERS[GHOST_COUNT] = {
+    {.x = GAME_MAP_WIDTH - 3, .y = -3},               // Blinky: top right
+    {.x = 2,                  .y = -3},               // Pinky: top left
+    {.x = GAME_MAP_WIDTH - 1, .y = GAME_MAP_HEIGHT},  // Inky: bottom right
+    {.x = 0,                  .y = GAME_MAP_HEIGHT}   // Clyde: bottom left
+};
+
+// Time each ghost waits in the house at the start of a level
+static const unsigned short GHOST_RELEASE_MS[GHOST_COUNT] = {
+    0, 1000, 4000, 7000
+};
+
+static const LevelGhostModes* levelModes = &LEVEL_GHOST_MODES[0];  // Schedule of the current level
+static const LevelDescriptor* maze;          // Maze tables of the current level
+static unsigned char waveIndex = 0;          // Current scatter/chase wave
+static unsigned char waveMode = GHOST_MODE_SCATTER;
+static unsigned short waveTicks = 0;         // Ticks left in the current wave (0 = endless)
+static unsigned short frightenedTicks = 0;   // Ticks left in the frightened time (the waves are paused meanwhile)
+static PrngState frightenedRandom = PRNG_DEFAULT_SEED;  // Turns of the frightened ghosts (own stream, restarted on every life)
+
+// Select the mode schedule of the level, place every ghost at its spawn position and restart the release countdowns
+void ghosts_spawn_all(void) {
+    unsigned char index;
+
+    ghosts_select_level();
+    waveIndex = 0;
+    waveMode = GHOST_MODE_SCATTER;
+    waveTicks = levelModes->waveTicks[0];
+    frightenedTicks = 0;
+    prng_seed(&frightenedRandom, PRNG_DEFAULT_SEED);   // The frightened wandering repeats on every life, as in the arcade
+
+    for (index = 0; index < GHOST_COUNT; index++) {
+        ghost_spawn((GhostID)index, MS_TO_MOVEMENT_TICKS(GHOST_RELEASE_MS[index]));
+    }
+}
+
+// Pick the speed of every ghost from its mode and position
+void ghosts_update_speeds(const LevelSpeeds* speeds) {
+    const unsigned char modePercent[GHOST_MODE_COUNT] = {
+        0,                        // In house: waiting ghosts never step
+        speeds->ghostNormal,      // Leaving
+        speeds->ghostNormal,      // Scatter
+        speeds->ghostNormal,      // Chase
+        speeds->ghostFrightened,  // Frightened
+        speeds->ghostEaten        // Eaten
+    };
+    GhostTable* ghosts = &gameRunning.ghosts;
+    const GhostModeTraits* traits;
+    unsigned char ghost;
+    unsigned char percent;
+
+    for (ghost = 0; ghost < GHOST_COUNT; ghost++) {
+        traits = &GHOST_MODE_TRAITS[ghosts->mode[ghost]];
+        percent = modePercent[ghosts->mode[ghost]];
+
+        if (traits->slowsInTunnel && movement_is_tunnel_cell(ghosts->currPos[ghost])) {
+            percent = speeds->ghostTunnel;
+        } else if (traits->accelerates) {
+            // Every acceleration step above the minimum adds a fixed bonus
+            percent += (ghosts->currentSpeed[ghost] - GAME_CONFIG.ghostConfig.minSpeed) * GHOST_ACCELERATION_PERCENT;
+        }
+        ghosts->speed[ghost] = movement_speed_from_percent(percent);
+    }
+}
+
+// Common movement tick of the ghosts: countdowns, then one step for every ghost that reached a new tile
+void ghosts_process_movement_tick(void) {
+    GhostTable* ghosts = &gameRunning.ghosts;
+    unsigned char modeChanged = 0;
+    unsigned int stepMask;
+    unsigned char ghost;
+
+    if (frightenedTicks) {
+        if (--frightenedTicks == 0) {
+            ghosts_dispatch_all(GHOST_EVENT_FRIGHT_END);
+            modeChanged = 1;
+        }
+        ghosts_update_palette();
+    } else if (waveTicks && (--waveTicks == 0)) {
+        ghosts_next_wave();
+        modeChanged = 1;
+    }
+
+    for (ghost = 0; ghost < GHOST_COUNT; ghost++) {
+        if (ghosts->timer[ghost] && (--ghosts->timer[ghost] == 0)) {
+            ghost_dispatch((GhostID)ghost, GHOST_EVENT_RELEASE);
+            modeChanged = 1;
+        }
+    }
+    if (modeChanged) {
+        game_update_actor_speeds();
+    }
+
+    stepMask = movement_advance_all(ghosts->progress, ghosts->speed, GHOST_COUNT);
+    if (stepMask == 0) {
+        return;
+    }
+
+    for (ghost = 0; stepMask; ghost++, stepMask >>= 1) {
+        if (!(stepMask & 1)) {
+            continue;
+        }
+        ghost_step((GhostID)ghost);
+
+        // Touching Pac-Man can restart the level or end the game
+        if (gameStatus.isFailed || gameStatus.isEnded) {
+            return;
+        }
+    }
+    game_update_actor_speeds(); // Entering or leaving the tunnel or the house changes the speeds
+}
+
+// Pac-Man ate a special pill: the ghosts in the maze become frightened for the time of the level
+void ghosts_frighten(void) {
+    frightenedTicks = levelModes->frightenedTicks;
+    ghosts_update_palette();
+    ghosts_dispatch_all(GHOST_EVENT_FRIGHTEN);
+    ghosts_draw_all();
+}
+
+// Check whether at least one ghost is frightened
+unsigned char ghosts_any_frightened(void) {
+    unsigned char ghost;
+
+    for (ghost = 0; ghost < GHOST_COUNT; ghost++) {
+        if (gameRunning.ghosts.mode[ghost] == GHOST_MODE_FRIGHTENED) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// Check whether Pac-Man eats the ghost when they meet
+unsigned char ghosts_is_edible(GhostID ghost) {
+    return GHOST_MODE_TRAITS[gameRunning.ghosts.mode[ghost]].isEdible;
+}
+
+// A ghost has been eaten: its eyes go back to the house
+void ghosts_eat(GhostID ghost) {
+    ghost_dispatch(ghost, GHOST_EVENT_EATEN);
+    game_update_actor_speeds();
+}
+
+// Every ghost becomes one step faster (up to the maximum speed)
+void ghosts_accelerate(void) {
+    unsigned char ghost;
+
+    for (ghost = 0; ghost < GHOST_COUNT; ghost++) {
+        if (gameRunning.ghosts.currentSpeed[ghost] < GAME_CONFIG.ghostConfig.maxSpeed) {
+            gameRunning.ghosts.currentSpeed[ghost]++;
+        }
+    }
+}
+
+// Check whether meeting Pac-Man is a collision for a ghost in its current mode
+unsigned char ghosts_touch_pacman(GhostID ghost) {
+    return GHOST_MODE_TRAITS[gameRunning.ghosts.mode[ghost]].touchesPacman;
+}
+
+// Draw every ghost
+void ghosts_draw_all(void) {
+    unsigned char ghost;
+
+    for (ghost = 0; ghost < GHOST_COUNT; ghost++) {
+        draw_ghost((GhostID)ghost);
+    }
+}
+
+// Restore the map cells covered by the ghosts
+void ghosts_undraw_all(void) {
+    unsigned char ghost;
+    Position position;
+
+    for (ghost = 0; ghost < GHOST_COUNT; ghost++) {
+        position = gameRunning.ghosts.currPos[ghost];
+        draw_cell((CellType)gameRunning.gameMap[position.y][position.x], position);
+    }
+}
+
+// Copy the shared mode machine state (save state)
+void ghosts_get_mode_state(GhostModeState* state) {
+    state->waveIndex = waveIndex;
+    state->waveMode = waveMode;
+    state->waveTicks = waveTicks;
+    state->frightenedTicks = frightenedTicks;
+    state->frightenedRandom = frightenedRandom;
+}
+
+// Restore the shared mode machine state, the schedule follows gameRunning.level
+void ghosts_set_mode_state(const GhostModeState* state) {
+    ghosts_select_level();
+    waveIndex = state->waveIndex;
+    waveMode = state->waveMode;
+    waveTicks = state->waveTicks;
+    frightenedTicks = state->frightenedTicks;
+    frightenedRandom = state->frightenedRandom;
+    ghosts_update_palette();
+}
+
+// Colour of the frightened ghosts: a palette swap, the ghosts pick it up the next time they are drawn
+static void ghosts_update_palette(void) {
+    const unsigned char flash = (frightenedTicks <= FRIGHTENED_FLASH_TICKS) && ((frightenedTicks / FRIGHTENED_FLASH_PERIOD) & 1);
+
+    palette_set(PALETTE_FRIGHTENED, flash ? COL_WHITE : COL_BLUE);
+}
+
+// Select the mode schedule and the maze of the current level
+static void ghosts_select_level(void) {
+    unsigned char index;
+
+    for (index = 0; index < LEVEL_GHOST_MODES_COUNT - 1; index++) {
+        if (gameRunning.level <= LEVEL_GHOST_MODES[index].lastLevel) {
+            break;
+        }
+    }
+    levelModes = &LEVEL_GHOST_MODES[index];
+    maze = level_get(gameRunning.level);
+}
+
+// Waiting ghosts do not move
+static Direction steer_in_house(GhostID ghost) {
+    (void)ghost;   // The mode table gives every steering function the same signature
+    return DIRECTION_STILL;
+}
+
+// Walk to the door column, then up through the door
+static Direction steer_leaving(GhostID ghost) {
+    const Position position = gameRunning.ghosts.currPos[ghost];
+
+    if (position.x < GHOST_DOOR_X) {
+        return DIRECTION_RIGHT;
+    }
+    if (position.x > GHOST_DOOR_X + 1) {
+        return DIRECTION_LEFT;
+    }
+    return DIRECTION_UP;
+}
+
+// Head to the home corner
+static Direction steer_scatter(GhostID ghost) {
+    return ghost_direction_to(ghost, GHOST_SCATTER_CORNERS[ghost]);
+}
+
+// Head to the target of the ghost's own chase strategy
+static Direction steer_chase(GhostID ghost) {
+    return ghost_direction_to(ghost, GHOST_TARGETING[ghost]());
+}
+
+// Pseudo-random direction: try every direction starting from a random one
+static Direction steer_frightened(GhostID ghost) {
+    const unsigned char first = prng_next(&frightenedRandom) & 3;
+    const unsigned char exits = ghost_exits(ghost);
+    unsigned char index;
+    Direction direction;
+
+    for (index = 0; index < 4; index++) {
+        direction = (Direction)(DIRECTION_RIGHT + ((first + index) & 3));
+        if (exits & LEVEL_MOVE_BIT(direction)) {
+            return direction;
+        }
+    }
+    return opposite_direction((Direction)gameRunning.ghosts.direction[ghost]);   // Dead end
+}
+
+// Head to the tile above the door along the shortest path, then down through the door into the house
+static Direction steer_eaten(GhostID ghost) {
+    const Position position = gameRunning.ghosts.currPos[ghost];
+
+    if ((position.x == GHOST_DOOR_X) && (position.y >= GHOST_HOUSE_ENTRANCE_Y) && (position.y < GHOST_HOUSE_HOME_Y)) {
+        return DIRECTION_DOWN;
+    }
+    return ghost_direction_home(ghost);
+}
+
+// Reset a ghost at its spawn position, it leaves the house after releaseTicks movement ticks
+static void ghost_spawn(GhostID ghost, unsigned short releaseTicks) {
+    GhostTable* ghosts = &gameRunning.ghosts;
+
+    ghosts->currPos[ghost] = get_ghost_spawn_position(ghost);
+    ghosts->prevPos[ghost] = ghosts->currPos[ghost];
+    ghosts->direction[ghost] = DIRECTION_STILL;
+    ghosts->animationFrame[ghost] = 0;
+    ghosts->progress[ghost] = 0;
+    ghosts->currentSpeed[ghost] = GAME_CONFIG.ghostConfig.minSpeed;
+    ghosts->mode[ghost] = releaseTicks ? GHOST_MODE_IN_HOUSE : GHOST_MODE_LEAVING;
+    ghosts->timer[ghost] = releaseTicks;
+    collision_place(ACTOR_GHOST(ghost), ghosts->currPos[ghost]);
+}
+
+// Feed an event to the mode machine of a ghost
+static void ghost_dispatch(GhostID ghost, GhostEvent event) {
+    GhostTable* ghosts = &gameRunning.ghosts;
+    const unsigned char transition = GHOST_TRANSITIONS[ghosts->mode[ghost]][event];
+
+    if (transition == GHOST_KEEP) {
+        return;
+    }
+
+    ghosts->mode[ghost] = (transition & GHOST_WAVE) ? waveMode : (transition & GHOST_NEXT_MODE_MASK);
+    if (transition & GHOST_REVERSE) {
+        ghosts->direction[ghost] = opposite_direction((Direction)ghosts->direction[ghost]);
+        ghosts->prevPos[ghost] = ghosts->currPos[ghost];   // The tile behind is now the way forward
+    }
+}
+
+static void ghosts_dispatch_all(GhostEvent event) {
+    unsigned char ghost;
+
+    for (ghost = 0; ghost < GHOST_COUNT; ghost++) {
+        ghost_dispatch((GhostID)ghost, event);
+    }
+}
+
+// Switch between scatter and chase (the last wave of the table never ends)
+static void ghosts_next_wave(void) {
+    waveIndex++;
+    waveMode = (waveIndex & 1) ? GHOST_MODE_CHASE : GHOST_MODE_SCATTER;
+    waveTicks = (waveIndex < GHOST_WAVE_COUNT) ? levelModes->waveTicks[waveIndex] : 0;
+    ghosts_dispatch_all((waveMode == GHOST_MODE_CHASE) ? GHOST_EVENT_CHASE : GHOST_EVENT_SCATTER);
+}
+
+// Move a ghost by one tile
+static void ghost_step(GhostID ghost) {
+    GhostTable* ghosts = &gameRunning.ghosts;
+    const Direction direction = GHOST_MODE_TRAITS[ghosts->mode[ghost]].steer(ghost);
+    const Position nextPosition = ghost_next_position(ghosts->currPos[ghost], direction);
+    const unsigned char nextCell = gameRunning.gameMap[nextPosition.y][nextPosition.x];
+    Position prevPosition;
+    unsigned char contacts = 0;
+    unsigned char others;
+    unsigned char other;
+
+    ghosts->direction[ghost] = direction;
+    ghosts->prevPos[ghost] = ghosts->currPos[ghost];
+    prevPosition = ghosts->prevPos[ghost];
+
+    // Walls always block, the door only lets leaving ghosts and eyes through
+    if ((nextCell != CELL_WALL) && ((nextCell != CELL_GHOST_DOOR) || GHOST_MODE_TRAITS[ghosts->mode[ghost]].passesDoor)) {
+        ghosts->currPos[ghost] = nextPosition;
+        contacts = collision_move(ACTOR_GHOST(ghost), prevPosition, nextPosition);
+    }
+
+    if ((ghosts->mode[ghost] == GHOST_MODE_LEAVING) &&
+        (gameRunning.gameMap[prevPosition.y][prevPosition.x] == CELL_GHOST_DOOR) &&
+        (ghosts->currPos[ghost].y != prevPosition.y)) {
+        ghost_dispatch(ghost, GHOST_EVENT_LEFT_HOUSE);
+    } else if ((ghosts->mode[ghost] == GHOST_MODE_EATEN) &&
+               (ghosts->currPos[ghost].x == GHOST_DOOR_X) && (ghosts->currPos[ghost].y == GHOST_HOUSE_HOME_Y)) {
+        ghosts->currentSpeed[ghost] = GAME_CONFIG.ghostConfig.minSpeed;
+        ghost_dispatch(ghost, GHOST_EVENT_HOME);
+    }
+
+    if (++ghosts->animationFrame[ghost] > GHOST_ANIMATION_FRAMES) {
+        ghosts->animationFrame[ghost] = 0;
+    }
+
+    // Restore the previous cell, and any other actor still standing on it
+    draw_cell((CellType)gameRunning.gameMap[prevPosition.y][prevPosition.x], prevPosition);
+    others = collision_actors_at(prevPosition) & ~ACTOR_MASK(ACTOR_GHOST(ghost));
+    if (others & ACTOR_MASK(ACTOR_PACMAN)) {
+        draw_cell(CELL_PACMAN, prevPosition);   // Eyes pass through Pac-Man
+    }
+    for (other = 0; (others & ACTOR_GHOSTS_MASK) && (other < GHOST_COUNT); other++) {
+        if (others & ACTOR_MASK(ACTOR_GHOST(other))) {
+            draw_ghost((GhostID)other);
+        }
+    }
+    draw_ghost(ghost);
+
+    // Same tile, or Pac-Man crossed the ghost in the opposite direction during this tick
+    if ((contacts & ACTOR_MASK(ACTOR_PACMAN)) && GHOST_MODE_TRAITS[ghosts->mode[ghost]].touchesPacman) {
+        process_pacman_ghost_collision(ghost);
+    }
+}
+
+// Directions a ghost can take on its current tile: never back, never into walls or the door
+static unsigned char ghost_exits(GhostID ghost) {
+    const Direction direction = (Direction)gameRunning.ghosts.direction[ghost];
+    unsigned char exits = level_move_mask(maze, gameRunning.ghosts.currPos[ghost]);
+
+    if (direction != DIRECTION_STILL) {
+        exits &= ~LEVEL_MOVE_BIT(opposite_direction(direction));
+    }
+    return exits;
+}
+
+// First direction of a set of exits, in right, left, up, down order
+static Direction first_exit(unsigned char exits) {
+    unsigned char direction = DIRECTION_RIGHT;
+
+    while (!(exits & 1)) {
+        exits >>= 1;
+        direction++;
+    }
+    return (Direction)direction;
+}
+
+// Direction that brings a ghost closest to a target tile (ties go to right, left, up, down)
+static Direction ghost_direction_to(GhostID ghost, TargetTile target) {
+    const unsigned char exits = ghost_exits(ghost);
+    Direction chosenDirection = DIRECTION_STILL;
+    unsigned int bestDistance = 0xFFFFFFFF;
+    unsigned int distance;
+    unsigned char direction;
+
+    if (exits == 0) {
+        return opposite_direction((Direction)gameRunning.ghosts.direction[ghost]);   // Dead end
+    }
+    if ((exits & (exits - 1)) == 0) {
+        return first_exit(exits);   // Corridor: a single way on, nothing to compare
+    }
+
+    for (direction = DIRECTION_RIGHT; direction <= DIRECTION_DOWN; direction++) {
+        if (!(exits & LEVEL_MOVE_BIT(direction))) {
+            continue;
+        }
+        distance = target_distance(ghost_next_position(gameRunning.ghosts.currPos[ghost], (Direction)direction), target);
+        if (distance < bestDistance) {
+            bestDistance = distance;
+            chosenDirection = (Direction)direction;
+        }
+    }
+    return chosenDirection;
+}
+
+// Direction on the shortest path to the tile above the door: at a junction, the way whose next junction is closest to home
+static Direction ghost_direction_home(GhostID ghost) {
+    const TargetTile entrance = {.x = GHOST_DOOR_X, .y = GHOST_HOUSE_ENTRANCE_Y};
+    const unsigned char exits = ghost_exits(ghost);
+    const unsigned char node = level_find_node(maze, gameRunning.ghosts.currPos[ghost]);
+    const MazeNode* junction;
+    Direction chosenDirection = DIRECTION_STILL;
+    unsigned short bestDistance = 0xFFFF;
+    unsigned short distance;
+    unsigned char direction;
+
+    if ((node == LEVEL_NO_NODE) || ((exits & (exits - 1)) == 0)) {
+        return ghost_direction_to(ghost, entrance);   // Inside a corridor the only way on is the way home
+    }
+
+    junction = &maze->nodes[node];
+    for (direction = DIRECTION_RIGHT; direction <= DIRECTION_DOWN; direction++) {
+        if (!(exits & LEVEL_MOVE_BIT(direction))) {
+            continue;
+        }
+        distance = junction->length[direction - DIRECTION_RIGHT] +
+                   level_node_distance(maze, junction->next[direction - DIRECTION_RIGHT], maze->homeNode);
+        if (distance < bestDistance) {
+            bestDistance = distance;
+            chosenDirection = (Direction)direction;
+        }
+    }
+    return chosenDirection;
+}
+
+// Neighbour cell in a direction (the teleport row wraps around)
+static Position ghost_next_position(Position position, Direction direction) {
+    switch (direction) {
+        case DIRECTION_RIGHT:
+            position.x = (position.x + 1) % GAME_MAP_WIDTH;
+            break;
+        case DIRECTION_LEFT:
+            position.x = (position.x + GAME_MAP_WIDTH - 1) % GAME_MAP_WIDTH;
+            break;
+        case DIRECTION_UP:
+            position.y--;
+            break;
+        case DIRECTION_DOWN:
+            position.y++;
+            break;
+        default:
+            break;
+    }
+    return position;
+}
+
+static Direction opposite_direction(Direction direction) {
+    switch (direction) {
+        case DIRECTION_RIGHT: return DIRECTION_LEFT;
+        case DIRECTION_LEFT:  return DIRECTION_RIGHT;
+        case DIRECTION_UP:    return DIRECTION_DOWN;
+        case DIRECTION_DOWN:  return DIRECTION_UP;
+        default:              return DIRECTION_STILL;
+    }
+}
+
+// Squared Euclidean distance between a cell and a target tile
+static unsigned int target_distance(Position position, TargetTile target) {
+    const int dx = (int)position.x - target.x;
+    const int dy = (int)position.y - target.y;
+
+    return (unsigned int)((dx * dx) + (dy * dy));
+}
+
+// Tile a number of tiles ahead of Pac-Man in its current direction
+static TargetTile target_ahead_of_pacman(unsigned char tiles) {
+    const Sprite* pacman = &gameRunning.pacman.sprite;
+    TargetTile target = {.x = pacman->currPos.x, .y = pacman->currPos.y};
+
+    switch (pacman->direction) {
+        case DIRECTION_RIGHT: target.x += tiles; break;
+        case DIRECTION_LEFT:  target.x -= tiles; break;
+        case DIRECTION_UP:    target.y -= tiles; break;
+        case DIRECTION_DOWN:  target.y += tiles; break;
+        default: break;
+    }
+    return target;
+}
+
+// Blinky: Pac-Man himself
+static TargetTile target_blinky(void) {
+    return target_ahead_of_pacman(0);
+}
+
+// Pinky: a few tiles ahead of Pac-Man, to cut him off
+static TargetTile target_pinky(void) {
+    return target_ahead_of_pacman(PINKY_LOOK_AHEAD);
+}
+
+// Inky: the vector from Blinky to a pivot ahead of Pac-Man, doubled
+static TargetTile target_inky(void) {
+    const TargetTile pivot = target_ahead_of_pacman(INKY_LOOK_AHEAD);
+    const Position blinky = gameRunning.ghosts.currPos[GHOST_BLINKY];
+    TargetTile target;
+
+    target.x = (short)(2 * pivot.x - blinky.x);
+    target.y = (short)(2 * pivot.y - blinky.y);
+    return target;
+}
+
+// Clyde: chases Pac-Man from afar, falls back to his scatter corner when close
+static TargetTile target_clyde(void) {
+    const TargetTile pacman = target_ahead_of_pacman(0);
+
+    if (target_distance(gameRunning.ghosts.currPos[GHOST_CLYDE], pacman) >= (CLYDE_SHY_DISTANCE * CLYDE_SHY_DISTANCE)) {
+        return pacman;
+    }
+    return GHOST_SCATTER_CORNERS[GHOST_CLYDE];
+}
@@ -0,0 +1,63 @@
+#ifndef __GAME_GHOSTS_H
+#define __GAME_GHOSTS_H
+
+#include "game_engine.h"
+#include "game_movement.h"
+#include "game_utils.h"
+
+/*
+ * Ghost actors.
+ *
+ * The four ghosts live in a structure-of-arrays table (gameRunning.ghosts)
+ * and are updated in one loop from the common movement tick: the progress
+ * of every ghost is advanced in a single pass, then the ghosts that reached
+ * a new tile pick their direction towards their own target tile. House
+ * release delays are per-ghost counters of movement ticks, so adding a
+ * ghost costs a table entry and no timer or scheduler event.
+ *
+ * Every ghost runs the same mode machine (GhostMode). Its inputs are the
+ * GhostEvent values below and every transition is a single lookup in a
+ * const [mode][event] table; per-mode steering, speed and collision rules
+ * are const tables as well. The scatter/chase waves and the frightened
+ * time come from a per-level table selected once when the level starts.
+ */
+
+#define GHOST_WAVE_COUNT 8   // Scatter and chase waves of a level (scatter first)
+
+// Inputs of the ghost mode machine
+typedef enum {
+    GHOST_EVENT_RELEASE     = 0, // The release countdown is over
+    GHOST_EVENT_LEFT_HOUSE  = 1, // The ghost stepped off the door
+    GHOST_EVENT_SCATTER     = 2, // A scatter wave starts
+    GHOST_EVENT_CHASE       = 3, // A chase wave starts
+    GHOST_EVENT_FRIGHTEN    = 4, // Pac-Man ate a special pill
+    GHOST_EVENT_FRIGHT_END  = 5, // The frightened time is over
+    GHOST_EVENT_EATEN       = 6, // Pac-Man ate the ghost
+    GHOST_EVENT_HOME        = 7, // The eyes are back inside the house
+    GHOST_EVENT_COUNT
+} GhostEvent;
+
+// Mode machine state shared by every ghost (the per-ghost part lives in the ghost table)
+typedef struct {
+    unsigned char waveIndex;        // Current scatter/chase wave (up to GHOST_WAVE_COUNT)
+    unsigned char waveMode;         // GHOST_MODE_SCATTER or GHOST_MODE_CHASE
+    unsigned short waveTicks;       // Ticks left in the current wave (0 = endless)
+    unsigned short frightenedTicks; // Ticks left in the frightened time
+    PrngState frightenedRandom;     // Turns of the frightened ghosts
+} GhostModeState;
+
+void ghosts_spawn_all(void);
+void ghosts_update_speeds(const LevelSpeeds* speeds);
+void ghosts_process_movement_tick(void);
+void ghosts_frighten(void);
+unsigned char ghosts_any_frightened(void);
+unsigned char ghosts_is_edible(GhostID ghost);
+void ghosts_eat(GhostID ghost);
+void ghosts_accelerate(void);
+unsigned char ghosts_touch_pacman(GhostID ghost);
+void ghosts_draw_all(void);
+void ghosts_undraw_all(void);
+void ghosts_get_mode_state(GhostModeState* state);
+void ghosts_set_mode_state(const GhostModeState* state);
+
+#endif /* __GAME_GHOSTS_H */
@@ -0,0 +1,178 @@
+#include "game_hud.h"
+#include "../critical_section.h"
+#include "game_band.h"
+#include "game_frame.h"
+#include "game_renderer.h"
+#include "game_tiles.h"
+#include "../event_scheduler.h"
+#include "../GLCD/AsciiLib.h"
+
+#define HUD_GLYPH_WIDTH   8                   // AsciiLib glyphs
+#define HUD_GLYPH_HEIGHT  16
+#define HUD_BLANK         10                  // Glyph of an unused place
+#define HUD_UNKNOWN       0xFF                // Place whose screen content is not known
+#define HUD_PLACES        (HUD_TIME_PLACES + HUD_SCORE_PLACES)
+#define HUD_LIFE_SPACING  (TILE_SIZE + TILE_SIZE / 2)
+#define HUD_POPUP_TICKS   SCHEDULER_MS_TO_TICKS(HUD_POPUP_MS)
+
+static unsigned short glyphs[HUD_BLANK + 1][HUD_GLYPH_HEIGHT][HUD_GLYPH_WIDTH];   // '0' to '9', then a space
+static unsigned short lifeIcon[TILE_SIZE][TILE_SIZE];
+static unsigned char glyphsReady = 0;
+
+static unsigned char places[HUD_PLACES];          // Glyph each place is to show (time first, then score)
+static unsigned char shownPlaces[HUD_PLACES];     // Glyph each place shows
+static unsigned char targetLives = 0;             // Lives to show
+static unsigned char shownLives = 0;              // One bit per slot showing a life
+static unsigned char knownLives = 0;              // One bit per slot whose content is known
+
+// Render the digit glyphs once, white on black
+static void hud_render_glyphs(void) {
+    unsigned char bits[HUD_GLYPH_HEIGHT];
+    unsigned char glyph;
+    unsigned char x;
+    unsigned char y;
+
+    for (glyph = 0; glyph <= HUD_BLANK; glyph++) {
+        GetASCIICode(bits, (glyph == HUD_BLANK) ? ' ' : ('0' + glyph));
+        for (y = 0; y < HUD_GLYPH_HEIGHT; y++) {
+            for (x = 0; x < HUD_GLYPH_WIDTH; x++) {
+                glyphs[glyph][y][x] = (bits[y] & (0x80 >> x)) ? COL_WHITE : COL_BLACK;
+            }
+        }
+    }
+    glyphsReady = 1;
+}
+
+// Render the life icon in the current palette
+static void hud_render_life_icon(void) {
+    const TileSurface surface = { &lifeIcon[0][0], TILE_SIZE, TILE_SIZE, TILE_SIZE };
+    unsigned char x;
+    unsigned char y;
+
+    for (y = 0; y < TILE_SIZE; y++) {
+        for (x = 0; x < TILE_SIZE; x++) {
+            lifeIcon[y][x] = palette_color(PALETTE_BACKGROUND);
+        }
+    }
+    tile_compose(TILE_PACMAN_FRAME(DIRECTION_LEFT, 0), &surface, 0, 0, PALETTE_PACMAN);
+}
+
+// Write a value left-aligned in count places, the unused ones blank
+static void hud_set_places(unsigned char* field, unsigned char count, unsigned short value) {
+    unsigned char digits[HUD_SCORE_PLACES];
+    unsigned char length = 0;
+    unsigned char i;
+
+    do {
+        digits[length++] = value % 10;
+        value /= 10;
+    } while (value && (length < count));
+    for (i = 0; i < count; i++) {
+        field[i] = (i < length) ? digits[length - 1 - i] : HUD_BLANK;
+    }
+}
+
+// EVENT_HUD: the HUD layer is drawn with the next frame
+static void hud_due(void) {
+    frame_request(FRAME_HUD);
+}
+
+/**
+ * @brief Asks for the HUD to be updated at its next grid point (callable from an interrupt).
+ */
+void hud_request(void) {
+    ENTER_CRITICAL();
+    if (scheduler_event_is_active(EVENT_HUD)) {
+        frame_count_merged();
+    } else {
+        scheduler_start_event(EVENT_HUD, hud_due, HUD_TICKS - (scheduler_now() % HUD_TICKS), 0);
+    }
+    EXIT_CRITICAL();
+}
+
+/**
+ * @brief Sets the statistics the HUD is to show (drawn by the next hud_flush).
+ *
+ * @param time Remaining time.
+ * @param score Score.
+ * @param lives Remaining lives.
+ */
+void hud_set_stats(unsigned char time, unsigned short score, unsigned char lives) {
+    hud_set_places(&places[0], HUD_TIME_PLACES, time);
+    hud_set_places(&places[HUD_TIME_PLACES], HUD_SCORE_PLACES, score);
+    targetLives = lives;
+}
+
+/**
+ * @brief Forgets what the screen shows: every place and life slot is sent at the next update.
+ */
+void hud_redraw(void) {
+    if (!glyphsReady) {
+        hud_render_glyphs();
+    }
+    hud_render_life_icon();
+    memset(shownPlaces, HUD_UNKNOWN, sizeof(shownPlaces));
+    knownLives = 0;
+    hud_request();
+}
+
+/**
+ * @brief HUD layer of a frame: sends the digits and the life slots that differ from the screen.
+ */
+void hud_flush(void) {
+    unsigned short x;
+    unsigned short y;
+    unsigned char slot;
+    unsigned char i;
+
+    if (!glyphsReady) {
+        hud_render_glyphs();
+    }
+    for (i = 0; i < HUD_PLACES; i++) {
+        if (places[i] == shownPlaces[i]) {
+            continue;
+        }
+        x = (i < HUD_TIME_PLACES) ? (TIMER_VALUE_START_X + i * HUD_GLYPH_WIDTH)
+                                  : (SCORE_VALUE_START_X + (i - HUD_TIME_PLACES) * HUD_GLYPH_WIDTH);
+        y = (i < HUD_TIME_PLACES) ? TIMER_VALUE_START_Y : SCORE_VALUE_START_Y;
+        LCD_WriteRect(x, y, HUD_GLYPH_WIDTH, HUD_GLYPH_HEIGHT, &glyphs[places[i]][0][0], HUD_GLYPH_WIDTH);
+        shownPlaces[i] = places[i];
+    }
+
+    for (slot = 0; slot < GAME_CONFIG.maxLives; slot++) {
+        if ((knownLives & (1U << slot)) && (((shownLives >> slot) & 1) == (slot < targetLives))) {
+            continue;
+        }
+        x = LIVES_VALUE_START_X + slot * HUD_LIFE_SPACING;
+        if (slot < targetLives) {
+            LCD_WriteRect(x, LIVES_VALUE_START_Y, TILE_SIZE, TILE_SIZE, &lifeIcon[0][0], TILE_SIZE);
+            shownLives |= 1U << slot;
+        } else {
+            LCD_FillRect(x, LIVES_VALUE_START_Y, x + TILE_SIZE - 1, LIVES_VALUE_START_Y + TILE_SIZE - 1, COL_BLACK);
+            shownLives &= ~(1U << slot);
+        }
+        knownLives |= 1U << slot;
+    }
+}
+
+// EVENT_SCORE_POPUP: the pop-up's time is over
+static void hud_popup_expired(void) {
+    band_hide_label();
+}
+
+/**
+ * @brief Shows points won over the maze for HUD_POPUP_MS (an eaten ghost).
+ *
+ * @param position Cell the points are centred on.
+ * @param points Points won.
+ */
+void hud_popup(Position position, unsigned short points) {
+    band_show_label(position, points, PALETTE_POPUP);
+    scheduler_start_event(EVENT_SCORE_POPUP, hud_popup_expired, HUD_POPUP_TICKS, 0);
+}
+
+// Take the pop-up off at once (a new maze, a restored game)
+void hud_clear_popup(void) {
+    scheduler_cancel_event(EVENT_SCORE_POPUP);
+    band_hide_label();
+}
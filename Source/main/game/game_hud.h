@@ -0,0 +1,39 @@
+#ifndef __GAME_HUD_H
+#define __GAME_HUD_H
+
+#include "game_engine.h"
+
+/*
+ * HUD: remaining time, score, lives and score pop-ups.
+ *
+ * The game never draws its statistics itself. A change asks for a HUD
+ * update (hud_request, callable from an interrupt), and the HUD follows
+ * at its own rate: EVENT_HUD, on a grid of HUD_TICKS scheduler ticks,
+ * asks for the HUD layer of the next frame (game_frame.h). However many
+ * pills are eaten in between, the HUD is drawn at most ten times a second.
+ *
+ * The values are kept place by place: each digit and each life slot
+ * remembers what the screen shows, and only the ones that differ are
+ * sent. A digit goes out from a cache of the ten AsciiLib glyphs
+ * pre-rendered in RGB565 (2.8 KB, blank included), a life from a cached
+ * Pac-Man icon, each in one GRAM window burst. A score going from 430 to
+ * 440 sends one 8 x 16 glyph.
+ *
+ * A pop-up (the points of an eaten ghost) is a label of the band renderer
+ * (game_band.h), drawn over the maze with the cells of the next frame and
+ * taken off by EVENT_SCORE_POPUP: the game tick only records it.
+ */
+
+#define HUD_TICKS          10     // Scheduler ticks between two HUD updates (100 ms)
+#define HUD_POPUP_MS       1000   // Time a score pop-up stays on the maze
+#define HUD_TIME_PLACES    3      // Digits of each field, left-aligned (any unsigned char)
+#define HUD_SCORE_PLACES   5      // Any unsigned short
+
+void hud_request(void);
+void hud_set_stats(unsigned char time, unsigned short score, unsigned char lives);
+void hud_redraw(void);
+void hud_flush(void);
+void hud_popup(Position position, unsigned short points);
+void hud_clear_popup(void);
+
+#endif /* __GAME_HUD_H */
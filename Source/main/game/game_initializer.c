@@ -1,49 +1,49 @@
 #include "game_initializer.h"
 
+#define BUZZER_SETUP_PERIOD_US 1000   // Any period up to ~171 s keeps the prescaler at 0: each note then sets MR0 in timer counts
+
 // Function prototypes (internal to this file)
-void initialize_game_timer();
-//void initialize_buzzer_timer();
+void initialize_buzzer_timer();
 
-// Initialize the Pac-Man game state
+// Initialize the Pac-Man game state, seeded from the hardware timers (or resume the game paused before a reset)
 void initialize_pacman_game() {
+    initialize_pacman_game_seeded((unsigned short)random_generate_seed());
+    game_restore_retained_snapshot();
+}
+
+// Initialize the Pac-Man game state with a known random seed (replay playback)
+void initialize_pacman_game_seeded(unsigned short seed) {
+    game_start_replay_recording(seed);             // Tick count, random stream and replay header
     gameRunning.remainingLives = GAME_CONFIG.startLives; // Set starting lives
     gameRunning.score = 0;                         // Reset score
+    gameRunning.level = 1;                         // Start from the first level
     gameStatus.isPaused = 1;                       // Start with the game paused
-    gameStatus.ghostStatus.currentSpeed = GAME_CONFIG.ghostConfig.minSpeed;
-    level_initialize(1); // Initialize level 1
+    game_events_toggle();                          // Game events wait for the first unpause
+    level_initialize(LEVEL_SCREEN_DRAW); // Initialize level 1
 }
 
 // Setup all game timers
 void initialize_game_timers() {
-	
-    initialize_game_timer();
-    initialize_ghost_movement_timer();
-	
-    //initialize_special_pills_timer();
-}
-
-// Setup the game timer (1-second interval)
-void initialize_game_timer() {
-    //init_timer(0, 0, 0, 3, 0x017D7840); // 1 second timer
-	  init_timer(0, 0, 0, 3, 0x002625A0); // 0.1 seconds timer for the simulator
+    // A single tickless timer (TIMER0) drives every game event:
+    // actor movement, the game clock, special pills and ghost acceleration
+    scheduler_init();
+    initialize_buzzer_timer();
 }
 
-void initialize_ghost_movement_timer(){
-		 init_timer(1, 0, 0, 3, 0x002625A0); // 0.1 seconds timer for the simulator
+// Register the thread-mode tasks of the game
+void initialize_game_tasks() {
+    profiler_init();
+    task_scheduler_init();
+    task_register(TASK_GAME_TICK, scheduler_process_expired, TASK_PRIORITY_HIGH);   // Movement, clock, pills
+    task_register(TASK_AUDIO_SEQUENCER, game_play_tone_all_track, TASK_PRIORITY_HIGH);
+    task_register(TASK_PAUSE_TOGGLE, game_handle_pause, TASK_PRIORITY_NORMAL);
+    task_register(TASK_RENDER_FLUSH, frame_run, TASK_PRIORITY_NORMAL);              // After the tick that was due with the frame
+    task_register(TASK_CAN_TX_DRAIN, transmit_CAN_data, TASK_PRIORITY_LOW);
+    task_register(TASK_PROFILER_REPORT, game_profiler_report, TASK_PRIORITY_LOW);
+    task_register(TASK_REPLAY_EXPORT, game_replay_export, TASK_PRIORITY_LOW);
 }
 
-/*
-// Setup the Pac-Man movement timer
+// Setup the buzzer timer: TIMER2 steps the DAC sine wave on every MR0 match (the special pills are a scheduler event)
 void initialize_buzzer_timer() {
-    if (!IS_SIMULATOR) {
-        init_timer(2, 0, 0, 3, 0x00319750); // 0.13 seconds timer for real hardware
-    } else {
-        init_timer(2, 0, 0, 3, 0x00225510); // 0.09 seconds timer for the simulator
-    }
-}
-
-// Setup the special pills timer (0.7-second interval)
-void initialize_special_pills_timer() {
-    init_timer(3, 0, 0, 3, 0x010B0760); // 0.7 seconds timer
-}
-*/
\ No newline at end of file
+    init_timer_us(2, 0, TIMER_MATCH_INTERRUPT | TIMER_MATCH_RESET, BUZZER_SETUP_PERIOD_US);
+}
\ No newline at end of file
@@ -7,8 +7,11 @@
 
 // Initialize the Pac-Man game
 void initialize_pacman_game();
+void initialize_pacman_game_seeded(unsigned short seed);
 
 // Initialize all game timers
 void initialize_game_timers();
-void initialize_ghost_movement_timer();
+
+// Register the thread-mode tasks of the game
+void initialize_game_tasks();
 #endif /* __GAME_INITIALIZER_H */
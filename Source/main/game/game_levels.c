@@ -0,0 +1,82 @@
+#include "game_levels.h"
+
+/**
+ * @brief Descriptor of a level (1-based, the levels past the pack keep its last maze).
+ */
+const LevelDescriptor* level_get(unsigned char level) {
+    if (level == 0) {
+        level = 1;
+    } else if (level > LEVEL_PACK_COUNT) {
+        level = LEVEL_PACK_COUNT;
+    }
+    return &LEVEL_PACK[level - 1];
+}
+
+// Unpack the maze of a level into a map
+void level_load_map(unsigned char level, GameMap* map) {
+    const LevelDescriptor* descriptor = level_get(level);
+    const unsigned char* packed;
+    unsigned char* cell;
+    unsigned char row;
+    unsigned char column;
+
+    for (row = 0; row < GAME_MAP_HEIGHT; row++) {
+        packed = LEVEL_ROWS[descriptor->rows[row]];
+        cell = (*map)[row];
+        for (column = 0; column < LEVEL_ROW_BYTES; column++) {
+            *cell++ = packed[column] >> 4;
+            *cell++ = packed[column] & 0x0F;
+        }
+    }
+}
+
+// Pill columns of a row of a level's maze
+const LevelRowTables* level_row_tables(const LevelDescriptor* level, unsigned char row) {
+    return &LEVEL_ROW_TABLES[level->rows[row]];
+}
+
+// Directions an actor can take from a cell (LEVEL_MOVE_BIT of each, the door counts as a wall)
+unsigned char level_move_mask(const LevelDescriptor* level, Position position) {
+    const unsigned char packed = LEVEL_MOVE_ROWS[level->moveRows[position.y]][position.x >> 1];
+
+    return (position.x & 1) ? (packed & 0x0F) : (packed >> 4);
+}
+
+// Junction index of a cell, LEVEL_NO_NODE when the cell is not a junction
+unsigned char level_find_node(const LevelDescriptor* level, Position position) {
+    const unsigned short key = (position.y << 8) | position.x;
+    unsigned short nodeKey;
+    unsigned char low = 0;
+    unsigned char high = level->nodeCount;
+    unsigned char middle;
+
+    while (low < high) {
+        middle = (low + high) >> 1;
+        nodeKey = (level->nodes[middle].position.y << 8) | level->nodes[middle].position.x;
+        if (nodeKey == key) {
+            return middle;
+        }
+        if (nodeKey < key) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return LEVEL_NO_NODE;
+}
+
+// Length of the shortest path between two junctions (tiles)
+unsigned char level_node_distance(const LevelDescriptor* level, unsigned char from, unsigned char to) {
+    unsigned char swap;
+
+    if (from == to) {
+        return 0;
+    }
+    if (from > to) {
+        swap = from;
+        from = to;
+        to = swap;
+    }
+    // Row 'from' of the triangle starts after the (count - 1) + ... + (count - from) entries above it
+    return level->distances[((from * (2 * level->nodeCount - from - 1)) >> 1) + (to - from - 1)];
+}
@@ -0,0 +1,102 @@
+#ifndef __GAME_LEVELS_H
+#define __GAME_LEVELS_H
+
+#include "game_engine.h"
+
+/*
+ * Level pack.
+ *
+ * The mazes are kept in flash as a dictionary of distinct rows shared by
+ * every level, two cells per byte (CellType in each nibble, the even
+ * column in the high nibble). A level is one index into the dictionary per
+ * maze row plus its spawn points, pill count and difficulty, so a new
+ * maze costs 31 bytes when its rows already exist and 14 more for each new
+ * one. Loading a level unpacks its 31 rows straight into the live map,
+ * the same work for every level.
+ *
+ * Everything the game knows about a maze before it is played comes with
+ * it, so nothing is rediscovered at run time:
+ *   - the outline of the walls, as the horizontal and vertical pixel
+ *     segments the renderer draws (merged across cells);
+ *   - each dictionary row lists its pill columns (renderer, snapshots);
+ *   - each maze cell has a move mask, one bit per direction an actor can
+ *     take from it (ghost steering), packed and shared like the maze rows;
+ *   - the teleport tunnel bounds (tunnel speed);
+ *   - the junctions, with the junction and corridor length found in every
+ *     direction, and the shortest distances between any two junctions as
+ *     the upper triangle of a byte matrix (the path home of eaten ghosts).
+ *
+ * The tables in game_levels_data.c are generated by host/host_maze_pack.c
+ * from the ASCII mazes of game_levels.txt, which also checks that every
+ * maze can be played (see the tool for the rules).
+ */
+
+#define LEVEL_ROW_BYTES (GAME_MAP_WIDTH / 2)   // Packed size of a maze row
+#define LEVEL_NO_NODE   0xFF                   // No junction (walled direction, cell off the junction list)
+#define LEVEL_NO_TUNNEL 0xFF                   // Tunnel row of a maze without teleports
+
+#define LEVEL_OUTLINE_INSET 2   // Pixels between the wall outline and the edge of its cell
+
+#define LEVEL_MOVE_BIT(direction) (1 << ((direction) - DIRECTION_RIGHT))   // Move mask bit of a direction
+
+// Straight piece of the wall outline, in pixels from the top-left corner of the maze
+typedef struct {
+    unsigned char x;
+    unsigned char y;
+    unsigned char length;     // Pixels
+    unsigned char vertical;   // 0 runs right from (x, y), 1 runs down
+} OutlineSegment;
+
+// Static content of a dictionary row
+typedef struct {
+    unsigned short firstPill;   // First pill column in LEVEL_PILL_COLUMNS
+    unsigned char pillCount;
+} LevelRowTables;
+
+// Teleport tunnel: the free corridor between each teleport end and the first junction
+typedef struct {
+    unsigned char row;          // LEVEL_NO_TUNNEL when the maze has no teleports
+    unsigned char leftEnd;      // Last tunnel cell on the left side
+    unsigned char rightStart;   // First tunnel cell on the right side
+} TunnelBounds;
+
+// Junction of a maze (or the tile above the ghost house door)
+typedef struct {
+    Position position;
+    unsigned char next[4];      // Junction reached going right, left, up and down (LEVEL_NO_NODE if walled)
+    unsigned char length[4];    // Corridor length to it (tiles)
+} MazeNode;
+
+// A level of the pack
+typedef struct {
+    unsigned char rows[GAME_MAP_HEIGHT];   // Dictionary entry of every maze row
+    Position pacmanSpawn;                  // Pac-Man's start cell
+    Position ghostDoor;                    // Left cell of the ghost house door
+    unsigned char pillCount;               // Pills in the maze
+    unsigned char specialPillCount;        // Special pills that may appear
+    unsigned char maxTime;                 // Time limit (s)
+    unsigned char moveRows[GAME_MAP_HEIGHT];   // Move mask dictionary entry of every maze row
+    TunnelBounds tunnel;
+    unsigned char nodeCount;               // Junctions, sorted by row then column
+    unsigned char homeNode;                // Junction right above the ghost house door
+    const MazeNode* nodes;
+    const unsigned char* distances;        // Junction distances, upper triangle row by row
+    unsigned short outlineCount;
+    const OutlineSegment* outline;         // Horizontal segments by row, then vertical ones by column
+} LevelDescriptor;
+
+extern const unsigned char LEVEL_PACK_COUNT;
+extern const unsigned char LEVEL_ROWS[][LEVEL_ROW_BYTES];
+extern const LevelRowTables LEVEL_ROW_TABLES[];
+extern const unsigned char LEVEL_PILL_COLUMNS[];
+extern const unsigned char LEVEL_MOVE_ROWS[][LEVEL_ROW_BYTES];
+extern const LevelDescriptor LEVEL_PACK[];
+
+const LevelDescriptor* level_get(unsigned char level);
+void level_load_map(unsigned char level, GameMap* map);
+const LevelRowTables* level_row_tables(const LevelDescriptor* level, unsigned char row);
+unsigned char level_move_mask(const LevelDescriptor* level, Position position);
+unsigned char level_find_node(const LevelDescriptor* level, Position position);
+unsigned char level_node_distance(const LevelDescriptor* level, unsigned char from, unsigned char to);
+
+#endif /* __GAME_LEVELS_H */
@@ -0,0 +1,626 @@
+/* Generated by host/host_maze_pack.c from game_levels.txt: do not edit */
+#include "game_levels.h"
+
+const unsigned char LEVEL_PACK_COUNT = 4;
+
+// Distinct maze rows, two cells per byte
+const unsigned char LEVEL_ROWS[][LEVEL_ROW_BYTES] = {
+    {0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11},   //   0 ############################
+    {0x14, 0x44, 0x44, 0x44, 0x44, 0x44, 0x41, 0x14, 0x44, 0x44, 0x44, 0x44, 0x44, 0x41},   //   1 #............##............#
+    {0x14, 0x11, 0x11, 0x41, 0x11, 0x11, 0x41, 0x14, 0x11, 0x11, 0x14, 0x11, 0x11, 0x41},   //   2 #.####.#####.##.#####.####.#
+    {0x14, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x41},   //   3 #..........................#
+    {0x14, 0x11, 0x11, 0x41, 0x14, 0x11, 0x11, 0x11, 0x11, 0x41, 0x14, 0x11, 0x11, 0x41},   //   4 #.####.##.########.##.####.#
+    {0x14, 0x44, 0x44, 0x41, 0x14, 0x44, 0x41, 0x14, 0x44, 0x41, 0x14, 0x44, 0x44, 0x41},   //   5 #......##....##....##......#
+    {0x11, 0x11, 0x11, 0x41, 0x11, 0x11, 0x01, 0x10, 0x11, 0x11, 0x14, 0x11, 0x11, 0x11},   //   6 ######.##### ## #####.######
+    {0x11, 0x11, 0x11, 0x41, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x14, 0x11, 0x11, 0x11},   //   7 ######.##          ##.######
+    {0x11, 0x11, 0x11, 0x41, 0x10, 0x11, 0x17, 0x71, 0x11, 0x01, 0x14, 0x11, 0x11, 0x11},   //   8 ######.## ###--### ##.######
+    {0x11, 0x11, 0x11, 0x01, 0x10, 0x10, 0x00, 0x00, 0x01, 0x01, 0x10, 0x11, 0x11, 0x11},   //   9 ###### ## #      # ## ######
+    {0x20, 0x00, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x03},   //  10 <     .   #      #   .     >
+    {0x11, 0x11, 0x11, 0x41, 0x10, 0x11, 0x11, 0x11, 0x11, 0x01, 0x14, 0x11, 0x11, 0x11},   //  11 ######.## ######## ##.######
+    {0x14, 0x44, 0x11, 0x44, 0x44, 0x44, 0x40, 0x04, 0x44, 0x44, 0x44, 0x11, 0x44, 0x41},   //  12 #...##.......  .......##...#
+    {0x11, 0x14, 0x11, 0x41, 0x14, 0x11, 0x11, 0x11, 0x11, 0x41, 0x14, 0x11, 0x41, 0x11},   //  13 ###.##.##.########.##.##.###
+    {0x14, 0x11, 0x11, 0x11, 0x11, 0x11, 0x41, 0x14, 0x11, 0x11, 0x11, 0x11, 0x11, 0x41},   //  14 #.##########.##.##########.#
+    {0x14, 0x11, 0x11, 0x41, 0x14, 0x11, 0x41, 0x14, 0x11, 0x41, 0x14, 0x11, 0x11, 0x41},   //  15 #.####.##.##.##.##.##.####.#
+    {0x14, 0x14, 0x11, 0x41, 0x14, 0x11, 0x11, 0x11, 0x11, 0x41, 0x14, 0x11, 0x41, 0x41},   //  16 #.#.##.##.########.##.##.#.#
+    {0x14, 0x11, 0x11, 0x41, 0x10, 0x11, 0x41, 0x14, 0x11, 0x01, 0x14, 0x11, 0x11, 0x41},   //  17 #.####.## ##.##.## ##.####.#
+    {0x14, 0x10, 0x11, 0x41, 0x14, 0x11, 0x11, 0x11, 0x11, 0x41, 0x14, 0x11, 0x01, 0x41},   //  18 #.# ##.##.########.##.## #.#
+    {0x14, 0x11, 0x11, 0x01, 0x11, 0x11, 0x41, 0x14, 0x11, 0x11, 0x10, 0x11, 0x11, 0x41}    //  19 #.#### #####.##.##### ####.#
+};
+
+// Pill columns of the dictionary rows
+const unsigned char LEVEL_PILL_COLUMNS[] = {
+      // 0
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26,   // 1
+    1, 6, 12, 15, 21, 26,   // 2
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26,   // 3
+    1, 6, 9, 18, 21, 26,   // 4
+    1, 2, 3, 4, 5, 6, 9, 10, 11, 12, 15, 16, 17, 18, 21, 22, 23, 24, 25, 26,   // 5
+    6, 21,   // 6
+    6, 21,   // 7
+    6, 21,   // 8
+      // 9
+    6, 21,   // 10
+    6, 21,   // 11
+    1, 2, 3, 6, 7, 8, 9, 10, 11, 12, 15, 16, 17, 18, 19, 20, 21, 24, 25, 26,   // 12
+    3, 6, 9, 18, 21, 24,   // 13
+    1, 12, 15, 26,   // 14
+    1, 6, 9, 12, 15, 18, 21, 26,   // 15
+    1, 3, 6, 9, 18, 21, 24, 26,   // 16
+    1, 6, 12, 15, 21, 26,   // 17
+    1, 6, 9, 18, 21, 26,   // 18
+    1, 12, 15, 26,   // 19
+};
+
+const LevelRowTables LEVEL_ROW_TABLES[] = {
+    {0, 0},   // 0
+    {0, 24},   // 1
+    {24, 6},   // 2
+    {30, 26},   // 3
+    {56, 6},   // 4
+    {62, 20},   // 5
+    {82, 2},   // 6
+    {84, 2},   // 7
+    {86, 2},   // 8
+    {88, 0},   // 9
+    {88, 2},   // 10
+    {90, 2},   // 11
+    {92, 20},   // 12
+    {112, 6},   // 13
+    {118, 4},   // 14
+    {122, 8},   // 15
+    {130, 8},   // 16
+    {138, 6},   // 17
+    {144, 6},   // 18
+    {150, 4}    // 19
+};
+
+// Distinct move mask rows, two cells per byte (bits: right, left, up, down)
+const unsigned char LEVEL_MOVE_ROWS[][LEVEL_ROW_BYTES] = {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},   //   0
+    {0x09, 0x33, 0x33, 0xB3, 0x33, 0x33, 0xA0, 0x09, 0x33, 0x33, 0x3B, 0x33, 0x33, 0xA0},   //   1
+    {0x0C, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0xC0},   //   2
+    {0x0D, 0x33, 0x33, 0xF3, 0x3B, 0x33, 0x73, 0x37, 0x33, 0xB3, 0x3F, 0x33, 0x33, 0xE0},   //   3
+    {0x0C, 0x00, 0x00, 0xC0, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x0C, 0x00, 0x00, 0xC0},   //   4
+    {0x05, 0x33, 0x33, 0xE0, 0x05, 0x33, 0xA0, 0x09, 0x33, 0x60, 0x0D, 0x33, 0x33, 0x60},   //   5
+    {0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00},   //   6
+    {0x00, 0x00, 0x00, 0xC0, 0x09, 0x33, 0x73, 0x37, 0x33, 0xA0, 0x0C, 0x00, 0x00, 0x00},   //   7
+    {0x00, 0x00, 0x00, 0xC0, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x0C, 0x00, 0x00, 0x00},   //   8
+    {0x00, 0x00, 0x00, 0xC0, 0x0C, 0x09, 0xBB, 0xBB, 0xA0, 0xC0, 0x0C, 0x00, 0x00, 0x00},   //   9
+    {0x33, 0x33, 0x33, 0xF3, 0x3E, 0x0D, 0xFF, 0xFF, 0xE0, 0xD3, 0x3F, 0x33, 0x33, 0x33},   //  10
+    {0x00, 0x00, 0x00, 0xC0, 0x0C, 0x05, 0x77, 0x77, 0x60, 0xC0, 0x0C, 0x00, 0x00, 0x00},   //  11
+    {0x00, 0x00, 0x00, 0xC0, 0x0D, 0x33, 0x33, 0x33, 0x33, 0xE0, 0x0C, 0x00, 0x00, 0x00},   //  12
+    {0x09, 0x33, 0x33, 0xF3, 0x37, 0x33, 0xA0, 0x09, 0x33, 0x73, 0x3F, 0x33, 0x33, 0xA0},   //  13
+    {0x05, 0x3A, 0x00, 0xD3, 0x3B, 0x33, 0x73, 0x37, 0x33, 0xB3, 0x3E, 0x00, 0x93, 0x60},   //  14
+    {0x00, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x00},   //  15
+    {0x09, 0x37, 0x33, 0x60, 0x05, 0x33, 0xA0, 0x09, 0x33, 0x60, 0x05, 0x33, 0x73, 0xA0},   //  16
+    {0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0},   //  17
+    {0x05, 0x33, 0x33, 0x33, 0x33, 0x33, 0x73, 0x37, 0x33, 0x33, 0x33, 0x33, 0x33, 0x60},   //  18
+    {0x09, 0x33, 0x33, 0xB3, 0x3B, 0x33, 0xA0, 0x09, 0x33, 0xB3, 0x3B, 0x33, 0x33, 0xA0},   //  19
+    {0x0C, 0x00, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0x00, 0xC0},   //  20
+    {0x0D, 0x3B, 0x33, 0xF3, 0x3F, 0x33, 0x73, 0x37, 0x33, 0xF3, 0x3F, 0x33, 0xB3, 0xE0},   //  21
+    {0x0C, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0xC0},   //  22
+    {0x05, 0x37, 0x33, 0xE0, 0x05, 0x33, 0xA0, 0x09, 0x33, 0x60, 0x0D, 0x33, 0x73, 0x60},   //  23
+    {0x0D, 0x3B, 0x33, 0xF3, 0x3B, 0x33, 0x73, 0x37, 0x33, 0xB3, 0x3F, 0x33, 0xB3, 0xE0},   //  24
+    {0x09, 0x33, 0x33, 0xF3, 0x3F, 0x33, 0xA0, 0x09, 0x33, 0xF3, 0x3F, 0x33, 0x33, 0xA0},   //  25
+    {0x05, 0x3A, 0x00, 0xD3, 0x3F, 0x33, 0x73, 0x37, 0x33, 0xF3, 0x3E, 0x00, 0x93, 0x60},   //  26
+    {0x09, 0x37, 0x33, 0xE0, 0x05, 0x33, 0xA0, 0x09, 0x33, 0x60, 0x0D, 0x33, 0x73, 0xA0},   //  27
+    {0x05, 0x33, 0x33, 0x73, 0x33, 0x33, 0x73, 0x37, 0x33, 0x33, 0x37, 0x33, 0x33, 0x60}    //  28
+};
+
+// Level 1: junctions (position, next junction and corridor length right, left, up, down)
+static const MazeNode LEVEL_1_NODES[] = {
+    {{.x =  6, .y =  1}, {  5,   2, 255,   3}, {10,  9,  0,  4}},   // 0
+    {{.x = 21, .y =  1}, {  9,   6, 255,   8}, { 9, 10,  0,  4}},   // 1
+    {{.x =  1, .y =  5}, {  3, 255,   0,  10}, { 5,  0,  9,  8}},   // 2
+    {{.x =  6, .y =  5}, {  4,   2,   0,  10}, { 3,  5,  4,  3}},   // 3
+    {{.x =  9, .y =  5}, {  5,   3, 255,  12}, { 3,  3,  0,  9}},   // 4
+    {{.x = 12, .y =  5}, {  6,   4,   0, 255}, { 3,  3, 10,  0}},   // 5
+    {{.x = 15, .y =  5}, {  7,   5,   1, 255}, { 3,  3, 10,  0}},   // 6
+    {{.x = 18, .y =  5}, {  8,   6, 255,  14}, { 3,  3,  0,  9}},   // 7
+    {{.x = 21, .y =  5}, {  9,   7,   1,  11}, { 5,  3,  4,  3}},   // 8
+    {{.x = 26, .y =  5}, {255,   8,   1,  11}, { 0,  5,  9,  8}},   // 9
+    {{.x =  6, .y =  8}, {255,   2,   3,  15}, { 0,  8,  3,  6}},   // 10
+    {{.x = 21, .y =  8}, {  9, 255,   8,  18}, { 8,  0,  3,  6}},   // 11
+    {{.x = 12, .y = 11}, { 13,  16,   4, 255}, { 1,  6,  9,  0}},   // 12
+    {{.x = 13, .y = 11}, { 14,  12, 255, 255}, { 2,  1,  0,  0}},   // 13 (home)
+    {{.x = 15, .y = 11}, { 17,  13,   7, 255}, { 6,  2,  9,  0}},   // 14
+    {{.x =  6, .y = 14}, { 16,  18,  10,  21}, { 3, 13,  6,  6}},   // 15
+    {{.x =  9, .y = 14}, {255,  15,  12,  19}, { 0,  3,  6,  3}},   // 16
+    {{.x = 18, .y = 14}, { 18, 255,  14,  20}, { 3,  0,  6,  3}},   // 17
+    {{.x = 21, .y = 14}, { 15,  17,  11,  24}, {13,  3,  6,  6}},   // 18
+    {{.x =  9, .y = 17}, { 20, 255,  16,  22}, { 9,  0,  3,  3}},   // 19
+    {{.x = 18, .y = 17}, {255,  19,  17,  23}, { 0,  9,  3,  3}},   // 20
+    {{.x =  6, .y = 20}, { 22,  31,  15,  25}, { 3, 13,  6,  3}},   // 21
+    {{.x =  9, .y = 20}, { 27,  21,  19, 255}, { 6,  3,  3,  0}},   // 22
+    {{.x = 18, .y = 20}, { 24,  28,  20, 255}, { 3,  6,  3,  0}},   // 23
+    {{.x = 21, .y = 20}, { 32,  23,  18,  30}, {13,  3,  6,  3}},   // 24
+    {{.x =  6, .y = 23}, { 26, 255,  21,  31}, { 3,  0,  3,  6}},   // 25
+    {{.x =  9, .y = 23}, { 27,  25, 255,  33}, { 3,  3,  0,  9}},   // 26
+    {{.x = 12, .y = 23}, { 28,  26,  22, 255}, { 3,  3,  6,  0}},   // 27
+    {{.x = 15, .y = 23}, { 29,  27,  23, 255}, { 3,  3,  6,  0}},   // 28
+    {{.x = 18, .y = 23}, { 30,  28, 255,  34}, { 3,  3,  0,  9}},   // 29
+    {{.x = 21, .y = 23}, {255,  29,  24,  32}, { 0,  3,  3,  6}},   // 30
+    {{.x =  3, .y = 26}, { 25,  33,  21, 255}, { 6, 16, 13,  0}},   // 31
+    {{.x = 24, .y = 26}, { 34,  30,  24, 255}, {16,  6, 13,  0}},   // 32
+    {{.x = 12, .y = 29}, { 34,  31,  26, 255}, { 3, 16,  9,  0}},   // 33
+    {{.x = 15, .y = 29}, { 32,  33,  29, 255}, {16,  3,  9,  0}}    // 34
+};
+
+// Level 1: wall outline (x, y, length, vertical) in pixels
+static const OutlineSegment LEVEL_1_OUTLINE[] = {
+    {5, 5, 102, 0}, {117, 5, 102, 0}, {18, 18, 28, 0}, {58, 18, 36, 0}, {130, 18, 36, 0}, {178, 18, 28, 0},
+    {18, 37, 28, 0}, {58, 37, 36, 0}, {106, 37, 12, 0}, {130, 37, 36, 0}, {178, 37, 28, 0}, {18, 50, 28, 0},
+    {58, 50, 12, 0}, {82, 50, 60, 0}, {154, 50, 12, 0}, {178, 50, 28, 0}, {18, 61, 28, 0}, {82, 61, 25, 0},
+    {117, 61, 25, 0}, {178, 61, 28, 0}, {5, 74, 41, 0}, {69, 74, 25, 0}, {130, 74, 25, 0}, {178, 74, 41, 0},
+    {69, 85, 25, 0}, {106, 85, 12, 0}, {130, 85, 25, 0}, {82, 98, 22, 0}, {120, 98, 22, 0}, {85, 101, 19, 0},
+    {120, 101, 19, 0}, {0, 109, 46, 0}, {58, 109, 12, 0}, {154, 109, 12, 0}, {178, 109, 46, 0}, {0, 122, 46, 0},
+    {58, 122, 12, 0}, {154, 122, 12, 0}, {178, 122, 46, 0}, {85, 130, 54, 0}, {82, 133, 60, 0}, {82, 146, 60, 0},
+    {5, 157, 41, 0}, {58, 157, 12, 0}, {82, 157, 25, 0}, {117, 157, 25, 0}, {154, 157, 12, 0}, {178, 157, 41, 0},
+    {18, 170, 28, 0}, {58, 170, 36, 0}, {130, 170, 36, 0}, {178, 170, 28, 0}, {18, 181, 17, 0}, {58, 181, 36, 0},
+    {106, 181, 12, 0}, {130, 181, 36, 0}, {189, 181, 17, 0}, {5, 194, 17, 0}, {58, 194, 12, 0}, {82, 194, 60, 0},
+    {154, 194, 12, 0}, {202, 194, 17, 0}, {5, 205, 17, 0}, {34, 205, 12, 0}, {82, 205, 25, 0}, {117, 205, 25, 0},
+    {178, 205, 12, 0}, {202, 205, 17, 0}, {18, 218, 41, 0}, {69, 218, 25, 0}, {130, 218, 25, 0}, {165, 218, 41, 0},
+    {18, 229, 76, 0}, {106, 229, 12, 0}, {130, 229, 76, 0}, {5, 242, 214, 0}, {5, 5, 70, 1}, {5, 157, 38, 1},
+    {5, 205, 38, 1}, {18, 18, 20, 1}, {18, 50, 12, 1}, {18, 170, 12, 1}, {18, 218, 12, 1}, {21, 194, 12, 1},
+    {34, 181, 25, 1}, {45, 18, 20, 1}, {45, 50, 12, 1}, {45, 74, 36, 1}, {45, 122, 36, 1}, {45, 170, 36, 1},
+    {58, 18, 20, 1}, {58, 50, 60, 1}, {58, 122, 36, 1}, {58, 170, 12, 1}, {58, 194, 25, 1}, {69, 50, 25, 1},
+    {69, 85, 25, 1}, {69, 122, 36, 1}, {69, 194, 25, 1}, {82, 50, 12, 1}, {82, 98, 36, 1}, {82, 146, 12, 1},
+    {82, 194, 12, 1}, {85, 101, 30, 1}, {93, 18, 20, 1}, {93, 74, 12, 1}, {93, 170, 12, 1}, {93, 218, 12, 1},
+    {106, 5, 33, 1}, {106, 61, 25, 1}, {106, 157, 25, 1}, {106, 205, 25, 1}, {117, 5, 33, 1}, {117, 61, 25, 1},
+    {117, 157, 25, 1}, {117, 205, 25, 1}, {130, 18, 20, 1}, {130, 74, 12, 1}, {130, 170, 12, 1}, {130, 218, 12, 1},
+    {138, 101, 30, 1}, {141, 50, 12, 1}, {141, 98, 36, 1}, {141, 146, 12, 1}, {141, 194, 12, 1}, {154, 50, 25, 1},
+    {154, 85, 25, 1}, {154, 122, 36, 1}, {154, 194, 25, 1}, {165, 18, 20, 1}, {165, 50, 60, 1}, {165, 122, 36, 1},
+    {165, 170, 12, 1}, {165, 194, 25, 1}, {178, 18, 20, 1}, {178, 50, 12, 1}, {178, 74, 36, 1}, {178, 122, 36, 1},
+    {178, 170, 36, 1}, {189, 181, 25, 1}, {202, 194, 12, 1}, {205, 18, 20, 1}, {205, 50, 12, 1}, {205, 170, 12, 1},
+    {205, 218, 12, 1}, {218, 5, 70, 1}, {218, 157, 38, 1}, {218, 205, 38, 1}
+};
+
+// Level 1: junction distances, upper triangle row by row
+static const unsigned char LEVEL_1_DISTANCES[] = {
+    23, 9, 4, 7, 10, 13, 16, 19, 24, 7, 22, 16, 17, 19, 13, 16, 25, 26, 19, 28, 19, 22, 31, 32,
+    22, 25, 28, 31, 34, 35, 28, 41, 34, 37, 24, 19, 16, 13, 10, 7, 4, 9, 22, 7, 19, 18, 16, 26,
+    25, 16, 13, 28, 19, 32, 31, 22, 19, 35, 34, 31, 28, 25, 22, 41, 28, 37, 34, 5, 8, 11, 14, 17,
+    20, 25, 8, 23, 17, 18, 20, 14, 17, 26, 27, 20, 29, 20, 23, 32, 33, 23, 26, 29, 32, 35, 36, 29,
+    42, 35, 38, 3, 6, 9, 12, 15, 20, 3, 18, 12, 13, 15, 9, 12, 21, 22, 15, 24, 15, 18, 27, 28,
+    18, 21, 24, 27, 30, 31, 24, 37, 30, 33, 3, 6, 9, 12, 17, 6, 15, 9, 10, 12, 12, 15, 18, 21,
+    18, 21, 18, 21, 24, 27, 21, 24, 27, 30, 33, 30, 27, 36, 33, 36, 3, 6, 9, 14, 9, 12, 12, 13,
+    15, 15, 18, 21, 18, 21, 24, 21, 24, 27, 24, 24, 27, 30, 33, 30, 27, 30, 33, 36, 39, 3, 6, 11,
+    12, 9, 15, 14, 12, 18, 21, 18, 15, 24, 21, 24, 27, 24, 21, 27, 30, 33, 30, 27, 24, 33, 30, 39,
+    36, 3, 8, 15, 6, 12, 11, 9, 21, 18, 15, 12, 21, 18, 27, 24, 21, 18, 30, 33, 30, 27, 24, 21,
+    36, 27, 36, 33, 5, 18, 3, 15, 14, 12, 22, 21, 12, 9, 24, 15, 28, 27, 18, 15, 31, 30, 27, 24,
+    21, 18, 37, 24, 33, 30, 23, 8, 20, 19, 17, 27, 26, 17, 14, 29, 20, 33, 32, 23, 20, 36, 35, 32,
+    29, 26, 23, 42, 29, 38, 35, 21, 15, 16, 18, 6, 9, 22, 19, 12, 21, 12, 15, 24, 25, 15, 18, 21,
+    24, 27, 28, 21, 34, 27, 30, 18, 17, 15, 19, 22, 9, 6, 21, 12, 25, 24, 15, 12, 28, 27, 24, 21,
+    18, 15, 34, 21, 30, 27, 1, 3, 9, 6, 9, 12, 9, 12, 15, 12, 15, 18, 18, 21, 18, 21, 24, 21,
+    24, 27, 30, 33, 2, 10, 7, 8, 11, 10, 11, 16, 13, 14, 17, 19, 22, 19, 20, 23, 20, 25, 26, 31,
+    32, 12, 9, 6, 9, 12, 9, 18, 15, 12, 15, 21, 24, 21, 18, 21, 18, 27, 24, 33, 30, 3, 16, 13,
+    6, 15, 6, 9, 18, 19, 9, 12, 15, 18, 21, 22, 15, 28, 21, 24, 15, 16, 3, 12, 9, 6, 15, 18,
+    12, 15, 12, 15, 18, 21, 18, 27, 24, 27, 3, 12, 3, 18, 15, 6, 9, 21, 18, 15, 12, 15, 12, 27,
+    18, 27, 24, 15, 6, 19, 18, 9, 6, 22, 21, 18, 15, 12, 9, 28, 15, 24, 21, 9, 6, 3, 12, 15,
+    9, 12, 9, 12, 15, 18, 15, 24, 21, 24, 15, 12, 3, 6, 18, 15, 12, 9, 12, 9, 24, 15, 24, 21,
+    3, 18, 21, 3, 6, 9, 12, 15, 18, 9, 24, 15, 18, 15, 18, 6, 9, 6, 9, 12, 15, 12, 21, 18,
+    21, 3, 15, 12, 9, 6, 9, 6, 21, 12, 21, 18, 18, 15, 12, 9, 6, 3, 24, 9, 18, 15, 3, 6,
+    9, 12, 15, 6, 21, 12, 15, 3, 6, 9, 12, 9, 18, 9, 12, 3, 6, 9, 12, 15, 12, 15, 3, 6,
+    15, 12, 15, 12, 3, 18, 9, 12, 9, 21, 6, 15, 12, 27, 16, 19, 19, 16, 3
+};
+
+// Level 2: junctions (position, next junction and corridor length right, left, up, down)
+static const MazeNode LEVEL_2_NODES[] = {
+    {{.x =  6, .y =  1}, {  1,   4, 255,   6}, { 3,  9,  0,  4}},   // 0
+    {{.x =  9, .y =  1}, {  8,   0, 255,   7}, { 7,  3,  0,  4}},   // 1
+    {{.x = 18, .y =  1}, {  3,   9, 255,  10}, { 3,  7,  0,  4}},   // 2
+    {{.x = 21, .y =  1}, { 13,   2, 255,  11}, { 9,  3,  0,  4}},   // 3
+    {{.x =  1, .y =  5}, {  5, 255,   0,  14}, { 2,  0,  9,  5}},   // 4
+    {{.x =  3, .y =  5}, {  6,   4, 255,  14}, { 3,  2,  0,  3}},   // 5
+    {{.x =  6, .y =  5}, {  7,   5,   0,  15}, { 3,  3,  4,  3}},   // 6
+    {{.x =  9, .y =  5}, {  8,   6,   1,  18}, { 3,  3,  4,  9}},   // 7
+    {{.x = 12, .y =  5}, {  9,   7,   1, 255}, { 3,  3,  7,  0}},   // 8
+    {{.x = 15, .y =  5}, { 10,   8,   2, 255}, { 3,  3,  7,  0}},   // 9
+    {{.x = 18, .y =  5}, { 11,   9,   2,  20}, { 3,  3,  4,  9}},   // 10
+    {{.x = 21, .y =  5}, { 12,  10,   3,  16}, { 3,  3,  4,  3}},   // 11
+    {{.x = 24, .y =  5}, { 13,  11, 255,  17}, { 2,  3,  0,  3}},   // 12
+    {{.x = 26, .y =  5}, {255,  12,   3,  17}, { 0,  2,  9,  5}},   // 13
+    {{.x =  3, .y =  8}, { 15,   4,   5, 255}, { 3,  5,  3,  0}},   // 14
+    {{.x =  6, .y =  8}, {255,  14,   6,  21}, { 0,  3,  3,  6}},   // 15
+    {{.x = 21, .y =  8}, { 17, 255,  11,  24}, { 3,  0,  3,  6}},   // 16
+    {{.x = 24, .y =  8}, { 13,  16,  12, 255}, { 5,  3,  3,  0}},   // 17
+    {{.x = 12, .y = 11}, { 19,  22,   7, 255}, { 1,  6,  9,  0}},   // 18
+    {{.x = 13, .y = 11}, { 20,  18, 255, 255}, { 2,  1,  0,  0}},   // 19 (home)
+    {{.x = 15, .y = 11}, { 23,  19,  10, 255}, { 6,  2,  9,  0}},   // 20
+    {{.x =  6, .y = 14}, { 22,  24,  15,  27}, { 3, 13,  6,  6}},   // 21
+    {{.x =  9, .y = 14}, {255,  21,  18,  25}, { 0,  3,  6,  3}},   // 22
+    {{.x = 18, .y = 14}, { 24, 255,  20,  26}, { 3,  0,  6,  3}},   // 23
+    {{.x = 21, .y = 14}, { 21,  23,  16,  30}, {13,  3,  6,  6}},   // 24
+    {{.x =  9, .y = 17}, { 26, 255,  22,  28}, { 9,  0,  3,  3}},   // 25
+    {{.x = 18, .y = 17}, {255,  25,  23,  29}, { 0,  9,  3,  3}},   // 26
+    {{.x =  6, .y = 20}, { 28,  37,  21,  31}, { 3, 13,  6,  3}},   // 27
+    {{.x =  9, .y = 20}, { 33,  27,  25, 255}, { 6,  3,  3,  0}},   // 28
+    {{.x = 18, .y = 20}, { 30,  34,  26, 255}, { 3,  6,  3,  0}},   // 29
+    {{.x = 21, .y = 20}, { 38,  29,  24,  36}, {13,  3,  6,  3}},   // 30
+    {{.x =  6, .y = 23}, { 32, 255,  27,  37}, { 3,  0,  3,  6}},   // 31
+    {{.x =  9, .y = 23}, { 33,  31, 255,  39}, { 3,  3,  0,  9}},   // 32
+    {{.x = 12, .y = 23}, { 34,  32,  28, 255}, { 3,  3,  6,  0}},   // 33
+    {{.x = 15, .y = 23}, { 35,  33,  29, 255}, { 3,  3,  6,  0}},   // 34
+    {{.x = 18, .y = 23}, { 36,  34, 255,  40}, { 3,  3,  0,  9}},   // 35
+    {{.x = 21, .y = 23}, {255,  35,  30,  38}, { 0,  3,  3,  6}},   // 36
+    {{.x =  3, .y = 26}, { 31,  39,  27, 255}, { 6, 16, 13,  0}},   // 37
+    {{.x = 24, .y = 26}, { 40,  36,  30, 255}, {16,  6, 13,  0}},   // 38
+    {{.x = 12, .y = 29}, { 40,  37,  32, 255}, { 3, 16,  9,  0}},   // 39
+    {{.x = 15, .y = 29}, { 38,  39,  35, 255}, {16,  3,  9,  0}}    // 40
+};
+
+// Level 2: wall outline (x, y, length, vertical) in pixels
+static const OutlineSegment LEVEL_2_OUTLINE[] = {
+    {5, 5, 102, 0}, {117, 5, 102, 0}, {18, 18, 28, 0}, {58, 18, 12, 0}, {82, 18, 12, 0}, {130, 18, 12, 0},
+    {154, 18, 12, 0}, {178, 18, 28, 0}, {18, 37, 28, 0}, {58, 37, 12, 0}, {82, 37, 12, 0}, {106, 37, 12, 0},
+    {130, 37, 12, 0}, {154, 37, 12, 0}, {178, 37, 28, 0}, {18, 50, 4, 0}, {34, 50, 12, 0}, {58, 50, 12, 0},
+    {82, 50, 60, 0}, {154, 50, 12, 0}, {178, 50, 12, 0}, {202, 50, 4, 0}, {18, 61, 4, 0}, {34, 61, 12, 0},
+    {82, 61, 25, 0}, {117, 61, 25, 0}, {178, 61, 12, 0}, {202, 61, 4, 0}, {5, 74, 41, 0}, {69, 74, 25, 0},
+    {130, 74, 25, 0}, {178, 74, 41, 0}, {69, 85, 25, 0}, {106, 85, 12, 0}, {130, 85, 25, 0}, {82, 98, 22, 0},
+    {120, 98, 22, 0}, {85, 101, 19, 0}, {120, 101, 19, 0}, {0, 109, 46, 0}, {58, 109, 12, 0}, {154, 109, 12, 0},
+    {178, 109, 46, 0}, {0, 122, 46, 0}, {58, 122, 12, 0}, {154, 122, 12, 0}, {178, 122, 46, 0}, {85, 130, 54, 0},
+    {82, 133, 60, 0}, {82, 146, 60, 0}, {5, 157, 41, 0}, {58, 157, 12, 0}, {82, 157, 25, 0}, {117, 157, 25, 0},
+    {154, 157, 12, 0}, {178, 157, 41, 0}, {18, 170, 28, 0}, {58, 170, 36, 0}, {130, 170, 36, 0}, {178, 170, 28, 0},
+    {18, 181, 17, 0}, {58, 181, 36, 0}, {106, 181, 12, 0}, {130, 181, 36, 0}, {189, 181, 17, 0}, {5, 194, 17, 0},
+    {58, 194, 12, 0}, {82, 194, 60, 0}, {154, 194, 12, 0}, {202, 194, 17, 0}, {5, 205, 17, 0}, {34, 205, 12, 0},
+    {82, 205, 25, 0}, {117, 205, 25, 0}, {178, 205, 12, 0}, {202, 205, 17, 0}, {18, 218, 41, 0}, {69, 218, 25, 0},
+    {130, 218, 25, 0}, {165, 218, 41, 0}, {18, 229, 76, 0}, {106, 229, 12, 0}, {130, 229, 76, 0}, {5, 242, 214, 0},
+    {5, 5, 70, 1}, {5, 157, 38, 1}, {5, 205, 38, 1}, {18, 18, 20, 1}, {18, 50, 12, 1}, {18, 170, 12, 1},
+    {18, 218, 12, 1}, {21, 50, 12, 1}, {21, 194, 12, 1}, {34, 50, 12, 1}, {34, 181, 25, 1}, {45, 18, 20, 1},
+    {45, 50, 12, 1}, {45, 74, 36, 1}, {45, 122, 36, 1}, {45, 170, 36, 1}, {58, 18, 20, 1}, {58, 50, 60, 1},
+    {58, 122, 36, 1}, {58, 170, 12, 1}, {58, 194, 25, 1}, {69, 18, 20, 1}, {69, 50, 25, 1}, {69, 85, 25, 1},
+    {69, 122, 36, 1}, {69, 194, 25, 1}, {82, 18, 20, 1}, {82, 50, 12, 1}, {82, 98, 36, 1}, {82, 146, 12, 1},
+    {82, 194, 12, 1}, {85, 101, 30, 1}, {93, 18, 20, 1}, {93, 74, 12, 1}, {93, 170, 12, 1}, {93, 218, 12, 1},
+    {106, 5, 33, 1}, {106, 61, 25, 1}, {106, 157, 25, 1}, {106, 205, 25, 1}, {117, 5, 33, 1}, {117, 61, 25, 1},
+    {117, 157, 25, 1}, {117, 205, 25, 1}, {130, 18, 20, 1}, {130, 74, 12, 1}, {130, 170, 12, 1}, {130, 218, 12, 1},
+    {138, 101, 30, 1}, {141, 18, 20, 1}, {141, 50, 12, 1}, {141, 98, 36, 1}, {141, 146, 12, 1}, {141, 194, 12, 1},
+    {154, 18, 20, 1}, {154, 50, 25, 1}, {154, 85, 25, 1}, {154, 122, 36, 1}, {154, 194, 25, 1}, {165, 18, 20, 1},
+    {165, 50, 60, 1}, {165, 122, 36, 1}, {165, 170, 12, 1}, {165, 194, 25, 1}, {178, 18, 20, 1}, {178, 50, 12, 1},
+    {178, 74, 36, 1}, {178, 122, 36, 1}, {178, 170, 36, 1}, {189, 50, 12, 1}, {189, 181, 25, 1}, {202, 50, 12, 1},
+    {202, 194, 12, 1}, {205, 18, 20, 1}, {205, 50, 12, 1}, {205, 170, 12, 1}, {205, 218, 12, 1}, {218, 5, 70, 1},
+    {218, 157, 38, 1}, {218, 205, 38, 1}
+};
+
+// Level 2: junction distances, upper triangle row by row
+static const unsigned char LEVEL_2_DISTANCES[] = {
+    3, 20, 23, 9, 7, 4, 7, 10, 13, 16, 19, 22, 24, 10, 7, 22, 25, 16, 17, 19, 13, 16, 25, 26,
+    19, 28, 19, 22, 31, 32, 22, 25, 28, 31, 34, 35, 28, 41, 34, 37, 17, 20, 12, 10, 7, 4, 7, 10,
+    13, 16, 19, 21, 13, 10, 19, 22, 13, 14, 16, 16, 19, 22, 25, 22, 25, 22, 25, 28, 31, 25, 28, 31,
+    34, 37, 34, 31, 40, 37, 40, 3, 21, 19, 16, 13, 10, 7, 4, 7, 10, 12, 22, 19, 10, 13, 16, 15,
+    13, 25, 22, 19, 16, 25, 22, 31, 28, 25, 22, 34, 37, 34, 31, 28, 25, 40, 31, 40, 37, 24, 22, 19,
+    16, 13, 10, 7, 4, 7, 9, 25, 22, 7, 10, 19, 18, 16, 26, 25, 16, 13, 28, 19, 32, 31, 22, 19,
+    35, 34, 31, 28, 25, 22, 41, 28, 37, 34, 2, 5, 8, 11, 14, 17, 20, 23, 25, 5, 8, 23, 26, 17,
+    18, 20, 14, 17, 26, 27, 20, 29, 20, 23, 32, 33, 23, 26, 29, 32, 35, 36, 29, 42, 35, 38, 3, 6,
+    9, 12, 15, 18, 21, 23, 3, 6, 21, 24, 15, 16, 18, 12, 15, 24, 25, 18, 27, 18, 21, 30, 31, 21,
+    24, 27, 30, 33, 34, 27, 40, 33, 36, 3, 6, 9, 12, 15, 18, 20, 6, 3, 18, 21, 12, 13, 15, 9,
+    12, 21, 22, 15, 24, 15, 18, 27, 28, 18, 21, 24, 27, 30, 31, 24, 37, 30, 33, 3, 6, 9, 12, 15,
+    17, 9, 6, 15, 18, 9, 10, 12, 12, 15, 18, 21, 18, 21, 18, 21, 24, 27, 21, 24, 27, 30, 33, 30,
+    27, 36, 33, 36, 3, 6, 9, 12, 14, 12, 9, 12, 15, 12, 13, 15, 15, 18, 21, 18, 21, 24, 21, 24,
+    27, 24, 24, 27, 30, 33, 30, 27, 30, 33, 36, 39, 3, 6, 9, 11, 15, 12, 9, 12, 15, 14, 12, 18,
+    21, 18, 15, 24, 21, 24, 27, 24, 21, 27, 30, 33, 30, 27, 24, 33, 30, 39, 36, 3, 6, 8, 18, 15,
+    6, 9, 12, 11, 9, 21, 18, 15, 12, 21, 18, 27, 24, 21, 18, 30, 33, 30, 27, 24, 21, 36, 27, 36,
+    33, 3, 5, 21, 18, 3, 6, 15, 14, 12, 22, 21, 12, 9, 24, 15, 28, 27, 18, 15, 31, 30, 27, 24,
+    21, 18, 37, 24, 33, 30, 2, 24, 21, 6, 3, 18, 17, 15, 25, 24, 15, 12, 27, 18, 31, 30, 21, 18,
+    34, 33, 30, 27, 24, 21, 40, 27, 36, 33, 26, 23, 8, 5, 20, 19, 17, 27, 26, 17, 14, 29, 20, 33,
+    32, 23, 20, 36, 35, 32, 29, 26, 23, 42, 29, 38, 35, 3, 24, 27, 18, 19, 21, 9, 12, 25, 22, 15,
+    24, 15, 18, 27, 28, 18, 21, 24, 27, 30, 31, 24, 37, 30, 33, 21, 24, 15, 16, 18, 6, 9, 22, 19,
+    12, 21, 12, 15, 24, 25, 15, 18, 21, 24, 27, 28, 21, 34, 27, 30, 3, 18, 17, 15, 19, 22, 9, 6,
+    21, 12, 25, 24, 15, 12, 28, 27, 24, 21, 18, 15, 34, 21, 30, 27, 21, 20, 18, 22, 25, 12, 9, 24,
+    15, 28, 27, 18, 15, 31, 30, 27, 24, 21, 18, 37, 24, 33, 30, 1, 3, 9, 6, 9, 12, 9, 12, 15,
+    12, 15, 18, 18, 21, 18, 21, 24, 21, 24, 27, 30, 33, 2, 10, 7, 8, 11, 10, 11, 16, 13, 14, 17,
+    19, 22, 19, 20, 23, 20, 25, 26, 31, 32, 12, 9, 6, 9, 12, 9, 18, 15, 12, 15, 21, 24, 21, 18,
+    21, 18, 27, 24, 33, 30, 3, 16, 13, 6, 15, 6, 9, 18, 19, 9, 12, 15, 18, 21, 22, 15, 28, 21,
+    24, 15, 16, 3, 12, 9, 6, 15, 18, 12, 15, 12, 15, 18, 21, 18, 27, 24, 27, 3, 12, 3, 18, 15,
+    6, 9, 21, 18, 15, 12, 15, 12, 27, 18, 27, 24, 15, 6, 19, 18, 9, 6, 22, 21, 18, 15, 12, 9,
+    28, 15, 24, 21, 9, 6, 3, 12, 15, 9, 12, 9, 12, 15, 18, 15, 24, 21, 24, 15, 12, 3, 6, 18,
+    15, 12, 9, 12, 9, 24, 15, 24, 21, 3, 18, 21, 3, 6, 9, 12, 15, 18, 9, 24, 15, 18, 15, 18,
+    6, 9, 6, 9, 12, 15, 12, 21, 18, 21, 3, 15, 12, 9, 6, 9, 6, 21, 12, 21, 18, 18, 15, 12,
+    9, 6, 3, 24, 9, 18, 15, 3, 6, 9, 12, 15, 6, 21, 12, 15, 3, 6, 9, 12, 9, 18, 9, 12,
+    3, 6, 9, 12, 15, 12, 15, 3, 6, 15, 12, 15, 12, 3, 18, 9, 12, 9, 21, 6, 15, 12, 27, 16,
+    19, 19, 16, 3
+};
+
+// Level 3: junctions (position, next junction and corridor length right, left, up, down)
+static const MazeNode LEVEL_3_NODES[] = {
+    {{.x =  6, .y =  1}, {  6,   2, 255,   4}, {10,  9,  0,  4}},   // 0
+    {{.x = 21, .y =  1}, { 11,   7, 255,   9}, { 9, 10,  0,  4}},   // 1
+    {{.x =  1, .y =  5}, {  3, 255,   0,  12}, { 2,  0,  9,  5}},   // 2
+    {{.x =  3, .y =  5}, {  4,   2, 255,  12}, { 3,  2,  0,  3}},   // 3
+    {{.x =  6, .y =  5}, {  5,   3,   0,  13}, { 3,  3,  4,  3}},   // 4
+    {{.x =  9, .y =  5}, {  6,   4, 255,  16}, { 3,  3,  0,  9}},   // 5
+    {{.x = 12, .y =  5}, {  7,   5,   0, 255}, { 3,  3, 10,  0}},   // 6
+    {{.x = 15, .y =  5}, {  8,   6,   1, 255}, { 3,  3, 10,  0}},   // 7
+    {{.x = 18, .y =  5}, {  9,   7, 255,  18}, { 3,  3,  0,  9}},   // 8
+    {{.x = 21, .y =  5}, { 10,   8,   1,  14}, { 3,  3,  4,  3}},   // 9
+    {{.x = 24, .y =  5}, { 11,   9, 255,  15}, { 2,  3,  0,  3}},   // 10
+    {{.x = 26, .y =  5}, {255,  10,   1,  15}, { 0,  2,  9,  5}},   // 11
+    {{.x =  3, .y =  8}, { 13,   2,   3, 255}, { 3,  5,  3,  0}},   // 12
+    {{.x =  6, .y =  8}, {255,  12,   4,  19}, { 0,  3,  3,  6}},   // 13
+    {{.x = 21, .y =  8}, { 15, 255,   9,  22}, { 3,  0,  3,  6}},   // 14
+    {{.x = 24, .y =  8}, { 11,  14,  10, 255}, { 5,  3,  3,  0}},   // 15
+    {{.x = 12, .y = 11}, { 17,  20,   5, 255}, { 1,  6,  9,  0}},   // 16
+    {{.x = 13, .y = 11}, { 18,  16, 255, 255}, { 2,  1,  0,  0}},   // 17 (home)
+    {{.x = 15, .y = 11}, { 21,  17,   8, 255}, { 6,  2,  9,  0}},   // 18
+    {{.x =  6, .y = 14}, { 20,  22,  13,  25}, { 3, 13,  6,  6}},   // 19
+    {{.x =  9, .y = 14}, {255,  19,  16,  23}, { 0,  3,  6,  3}},   // 20
+    {{.x = 18, .y = 14}, { 22, 255,  18,  24}, { 3,  0,  6,  3}},   // 21
+    {{.x = 21, .y = 14}, { 19,  21,  14,  28}, {13,  3,  6,  6}},   // 22
+    {{.x =  9, .y = 17}, { 24, 255,  20,  26}, { 9,  0,  3,  3}},   // 23
+    {{.x = 18, .y = 17}, {255,  23,  21,  27}, { 0,  9,  3,  3}},   // 24
+    {{.x =  6, .y = 20}, { 26,  35,  19,  29}, { 3, 13,  6,  3}},   // 25
+    {{.x =  9, .y = 20}, { 31,  25,  23,  30}, { 6,  3,  3,  3}},   // 26
+    {{.x = 18, .y = 20}, { 28,  32,  24,  33}, { 3,  6,  3,  3}},   // 27
+    {{.x = 21, .y = 20}, { 38,  27,  22,  34}, {13,  3,  6,  3}},   // 28
+    {{.x =  6, .y = 23}, { 30, 255,  25,  36}, { 3,  0,  3,  3}},   // 29
+    {{.x =  9, .y = 23}, { 31,  29,  26,  40}, { 3,  3,  3,  9}},   // 30
+    {{.x = 12, .y = 23}, { 32,  30,  26, 255}, { 3,  3,  6,  0}},   // 31
+    {{.x = 15, .y = 23}, { 33,  31,  27, 255}, { 3,  3,  6,  0}},   // 32
+    {{.x = 18, .y = 23}, { 34,  32,  27,  41}, { 3,  3,  3,  9}},   // 33
+    {{.x = 21, .y = 23}, {255,  33,  28,  37}, { 0,  3,  3,  3}},   // 34
+    {{.x =  3, .y = 26}, { 36,  39,  25, 255}, { 3, 10, 13,  0}},   // 35
+    {{.x =  6, .y = 26}, {255,  35,  29,  39}, { 0,  3,  3,  3}},   // 36
+    {{.x = 21, .y = 26}, { 38, 255,  34,  42}, { 3,  0,  3,  3}},   // 37
+    {{.x = 24, .y = 26}, { 42,  37,  28, 255}, {10,  3, 13,  0}},   // 38
+    {{.x =  6, .y = 29}, { 40,  35,  36, 255}, { 6, 10,  3,  0}},   // 39
+    {{.x = 12, .y = 29}, { 41,  39,  30, 255}, { 3,  6,  9,  0}},   // 40
+    {{.x = 15, .y = 29}, { 42,  40,  33, 255}, { 6,  3,  9,  0}},   // 41
+    {{.x = 21, .y = 29}, { 38,  41,  37, 255}, {10,  6,  3,  0}}    // 42
+};
+
+// Level 3: wall outline (x, y, length, vertical) in pixels
+static const OutlineSegment LEVEL_3_OUTLINE[] = {
+    {5, 5, 102, 0}, {117, 5, 102, 0}, {18, 18, 28, 0}, {58, 18, 36, 0}, {130, 18, 36, 0}, {178, 18, 28, 0},
+    {18, 37, 28, 0}, {58, 37, 36, 0}, {106, 37, 12, 0}, {130, 37, 36, 0}, {178, 37, 28, 0}, {18, 50, 4, 0},
+    {34, 50, 12, 0}, {58, 50, 12, 0}, {82, 50, 60, 0}, {154, 50, 12, 0}, {178, 50, 12, 0}, {202, 50, 4, 0},
+    {18, 61, 4, 0}, {34, 61, 12, 0}, {82, 61, 25, 0}, {117, 61, 25, 0}, {178, 61, 12, 0}, {202, 61, 4, 0},
+    {5, 74, 41, 0}, {69, 74, 25, 0}, {130, 74, 25, 0}, {178, 74, 41, 0}, {69, 85, 25, 0}, {106, 85, 12, 0},
+    {130, 85, 25, 0}, {82, 98, 22, 0}, {120, 98, 22, 0}, {85, 101, 19, 0}, {120, 101, 19, 0}, {0, 109, 46, 0},
+    {58, 109, 12, 0}, {154, 109, 12, 0}, {178, 109, 46, 0}, {0, 122, 46, 0}, {58, 122, 12, 0}, {154, 122, 12, 0},
+    {178, 122, 46, 0}, {85, 130, 54, 0}, {82, 133, 60, 0}, {82, 146, 60, 0}, {5, 157, 41, 0}, {58, 157, 12, 0},
+    {82, 157, 25, 0}, {117, 157, 25, 0}, {154, 157, 12, 0}, {178, 157, 41, 0}, {18, 170, 28, 0}, {58, 170, 12, 0},
+    {82, 170, 12, 0}, {130, 170, 12, 0}, {154, 170, 12, 0}, {178, 170, 28, 0}, {18, 181, 17, 0}, {58, 181, 12, 0},
+    {82, 181, 12, 0}, {106, 181, 12, 0}, {130, 181, 12, 0}, {154, 181, 12, 0}, {189, 181, 17, 0}, {5, 194, 17, 0},
+    {58, 194, 12, 0}, {82, 194, 60, 0}, {154, 194, 12, 0}, {202, 194, 17, 0}, {5, 205, 17, 0}, {34, 205, 12, 0},
+    {82, 205, 25, 0}, {117, 205, 25, 0}, {178, 205, 12, 0}, {202, 205, 17, 0}, {18, 218, 28, 0}, {69, 218, 25, 0},
+    {130, 218, 25, 0}, {178, 218, 28, 0}, {18, 229, 28, 0}, {58, 229, 36, 0}, {106, 229, 12, 0}, {130, 229, 36, 0},
+    {178, 229, 28, 0}, {5, 242, 214, 0}, {5, 5, 70, 1}, {5, 157, 38, 1}, {5, 205, 38, 1}, {18, 18, 20, 1},
+    {18, 50, 12, 1}, {18, 170, 12, 1}, {18, 218, 12, 1}, {21, 50, 12, 1}, {21, 194, 12, 1}, {34, 50, 12, 1},
+    {34, 181, 25, 1}, {45, 18, 20, 1}, {45, 50, 12, 1}, {45, 74, 36, 1}, {45, 122, 36, 1}, {45, 170, 36, 1},
+    {45, 218, 12, 1}, {58, 18, 20, 1}, {58, 50, 60, 1}, {58, 122, 36, 1}, {58, 170, 12, 1}, {58, 194, 36, 1},
+    {69, 50, 25, 1}, {69, 85, 25, 1}, {69, 122, 36, 1}, {69, 170, 12, 1}, {69, 194, 25, 1}, {82, 50, 12, 1},
+    {82, 98, 36, 1}, {82, 146, 12, 1}, {82, 170, 12, 1}, {82, 194, 12, 1}, {85, 101, 30, 1}, {93, 18, 20, 1},
+    {93, 74, 12, 1}, {93, 170, 12, 1}, {93, 218, 12, 1}, {106, 5, 33, 1}, {106, 61, 25, 1}, {106, 157, 25, 1},
+    {106, 205, 25, 1}, {117, 5, 33, 1}, {117, 61, 25, 1}, {117, 157, 25, 1}, {117, 205, 25, 1}, {130, 18, 20, 1},
+    {130, 74, 12, 1}, {130, 170, 12, 1}, {130, 218, 12, 1}, {138, 101, 30, 1}, {141, 50, 12, 1}, {141, 98, 36, 1},
+    {141, 146, 12, 1}, {141, 170, 12, 1}, {141, 194, 12, 1}, {154, 50, 25, 1}, {154, 85, 25, 1}, {154, 122, 36, 1},
+    {154, 170, 12, 1}, {154, 194, 25, 1}, {165, 18, 20, 1}, {165, 50, 60, 1}, {165, 122, 36, 1}, {165, 170, 12, 1},
+    {165, 194, 36, 1}, {178, 18, 20, 1}, {178, 50, 12, 1}, {178, 74, 36, 1}, {178, 122, 36, 1}, {178, 170, 36, 1},
+    {178, 218, 12, 1}, {189, 50, 12, 1}, {189, 181, 25, 1}, {202, 50, 12, 1}, {202, 194, 12, 1}, {205, 18, 20, 1},
+    {205, 50, 12, 1}, {205, 170, 12, 1}, {205, 218, 12, 1}, {218, 5, 70, 1}, {218, 157, 38, 1}, {218, 205, 38, 1}
+};
+
+// Level 3: junction distances, upper triangle row by row
+static const unsigned char LEVEL_3_DISTANCES[] = {
+    23, 9, 7, 4, 7, 10, 13, 16, 19, 22, 24, 10, 7, 22, 25, 16, 17, 19, 13, 16, 25, 26, 19, 28,
+    19, 22, 31, 32, 22, 25, 28, 31, 34, 35, 28, 25, 38, 41, 28, 34, 37, 41, 24, 22, 19, 16, 13, 10,
+    7, 4, 7, 9, 25, 22, 7, 10, 19, 18, 16, 26, 25, 16, 13, 28, 19, 32, 31, 22, 19, 35, 34, 31,
+    28, 25, 22, 41, 38, 25, 28, 41, 37, 34, 28, 2, 5, 8, 11, 14, 17, 20, 23, 25, 5, 8, 23, 26,
+    17, 18, 20, 14, 17, 26, 27, 20, 29, 20, 23, 32, 33, 23, 26, 29, 32, 35, 36, 29, 26, 39, 42, 29,
+    35, 38, 42, 3, 6, 9, 12, 15, 18, 21, 23, 3, 6, 21, 24, 15, 16, 18, 12, 15, 24, 25, 18, 27,
+    18, 21, 30, 31, 21, 24, 27, 30, 33, 34, 27, 24, 37, 40, 27, 33, 36, 40, 3, 6, 9, 12, 15, 18,
+    20, 6, 3, 18, 21, 12, 13, 15, 9, 12, 21, 22, 15, 24, 15, 18, 27, 28, 18, 21, 24, 27, 30, 31,
+    24, 21, 34, 37, 24, 30, 33, 37, 3, 6, 9, 12, 15, 17, 9, 6, 15, 18, 9, 10, 12, 12, 15, 18,
+    21, 18, 21, 18, 21, 24, 27, 21, 24, 27, 30, 27, 30, 27, 24, 33, 36, 27, 33, 36, 36, 3, 6, 9,
+    12, 14, 12, 9, 12, 15, 12, 13, 15, 15, 18, 21, 18, 21, 24, 21, 24, 27, 24, 24, 27, 30, 33, 30,
+    27, 30, 27, 30, 33, 30, 36, 39, 33, 3, 6, 9, 11, 15, 12, 9, 12, 15, 14, 12, 18, 21, 18, 15,
+    24, 21, 24, 27, 24, 21, 27, 30, 33, 30, 27, 24, 33, 30, 27, 30, 33, 39, 36, 30, 3, 6, 8, 18,
+    15, 6, 9, 12, 11, 9, 21, 18, 15, 12, 21, 18, 27, 24, 21, 18, 30, 27, 30, 27, 24, 21, 36, 33,
+    24, 27, 36, 36, 33, 27, 3, 5, 21, 18, 3, 6, 15, 14, 12, 22, 21, 12, 9, 24, 15, 28, 27, 18,
+    15, 31, 30, 27, 24, 21, 18, 37, 34, 21, 24, 37, 33, 30, 24, 2, 24, 21, 6, 3, 18, 17, 15, 25,
+    24, 15, 12, 27, 18, 31, 30, 21, 18, 34, 33, 30, 27, 24, 21, 40, 37, 24, 27, 40, 36, 33, 27, 26,
+    23, 8, 5, 20, 19, 17, 27, 26, 17, 14, 29, 20, 33, 32, 23, 20, 36, 35, 32, 29, 26, 23, 42, 39,
+    26, 29, 42, 38, 35, 29, 3, 24, 27, 18, 19, 21, 9, 12, 25, 22, 15, 24, 15, 18, 27, 28, 18, 21,
+    24, 27, 30, 31, 24, 21, 34, 37, 24, 30, 33, 37, 21, 24, 15, 16, 18, 6, 9, 22, 19, 12, 21, 12,
+    15, 24, 25, 15, 18, 21, 24, 27, 28, 21, 18, 31, 34, 21, 27, 30, 34, 3, 18, 17, 15, 19, 22, 9,
+    6, 21, 12, 25, 24, 15, 12, 28, 27, 24, 21, 18, 15, 34, 31, 18, 21, 34, 30, 27, 21, 21, 20, 18,
+    22, 25, 12, 9, 24, 15, 28, 27, 18, 15, 31, 30, 27, 24, 21, 18, 37, 34, 21, 24, 37, 33, 30, 24,
+    1, 3, 9, 6, 9, 12, 9, 12, 15, 12, 15, 18, 18, 15, 18, 21, 18, 21, 24, 21, 24, 27, 24, 24,
+    27, 27, 2, 10, 7, 8, 11, 10, 11, 16, 13, 14, 17, 19, 16, 19, 20, 17, 20, 25, 22, 23, 26, 25,
+    25, 26, 26, 12, 9, 6, 9, 12, 9, 18, 15, 12, 15, 21, 18, 21, 18, 15, 18, 27, 24, 21, 24, 27,
+    27, 24, 24, 3, 16, 13, 6, 15, 6, 9, 18, 19, 9, 12, 15, 18, 21, 22, 15, 12, 25, 28, 15, 21,
+    24, 28, 15, 16, 3, 12, 9, 6, 15, 18, 12, 9, 12, 15, 18, 21, 18, 15, 24, 27, 18, 18, 21, 27,
+    3, 12, 3, 18, 15, 6, 9, 21, 18, 15, 12, 9, 12, 27, 24, 15, 18, 27, 21, 18, 18, 15, 6, 19,
+    18, 9, 6, 22, 21, 18, 15, 12, 9, 28, 25, 12, 15, 28, 24, 21, 15, 9, 6, 3, 12, 15, 9, 6,
+    9, 12, 15, 18, 15, 12, 21, 24, 15, 15, 18, 24, 15, 12, 3, 6, 18, 15, 12, 9, 6, 9, 24, 21,
+    12, 15, 24, 18, 15, 15, 3, 18, 21, 3, 6, 9, 12, 15, 18, 9, 6, 21, 24, 9, 15, 18, 24, 15,
+    18, 6, 3, 6, 9, 12, 15, 12, 9, 18, 21, 12, 12, 15, 21, 3, 15, 12, 9, 6, 3, 6, 21, 18,
+    9, 12, 21, 15, 12, 12, 18, 15, 12, 9, 6, 3, 24, 21, 6, 9, 24, 18, 15, 9, 3, 6, 9, 12,
+    15, 6, 3, 18, 21, 6, 12, 15, 21, 3, 6, 9, 12, 9, 6, 15, 18, 9, 9, 12, 18, 3, 6, 9,
+    12, 9, 12, 15, 12, 12, 15, 15, 3, 6, 15, 12, 9, 12, 15, 15, 12, 12, 3, 18, 15, 6, 9, 18,
+    12, 9, 9, 21, 18, 3, 6, 21, 15, 12, 6, 3, 24, 27, 6, 12, 15, 21, 21, 24, 3, 9, 12, 18,
+    3, 18, 12, 9, 3, 21, 15, 12, 6, 6, 9, 15, 3, 9, 6
+};
+
+// Level 4: junctions (position, next junction and corridor length right, left, up, down)
+static const MazeNode LEVEL_4_NODES[] = {
+    {{.x =  6, .y =  1}, {  1,   4, 255,   6}, { 3,  9,  0,  4}},   // 0
+    {{.x =  9, .y =  1}, {  8,   0, 255,   7}, { 7,  3,  0,  4}},   // 1
+    {{.x = 18, .y =  1}, {  3,   9, 255,  10}, { 3,  7,  0,  4}},   // 2
+    {{.x = 21, .y =  1}, { 13,   2, 255,  11}, { 9,  3,  0,  4}},   // 3
+    {{.x =  1, .y =  5}, {  5, 255,   0,  14}, { 2,  0,  9,  5}},   // 4
+    {{.x =  3, .y =  5}, {  6,   4, 255,  14}, { 3,  2,  0,  3}},   // 5
+    {{.x =  6, .y =  5}, {  7,   5,   0,  15}, { 3,  3,  4,  3}},   // 6
+    {{.x =  9, .y =  5}, {  8,   6,   1,  18}, { 3,  3,  4,  9}},   // 7
+    {{.x = 12, .y =  5}, {  9,   7,   1, 255}, { 3,  3,  7,  0}},   // 8
+    {{.x = 15, .y =  5}, { 10,   8,   2, 255}, { 3,  3,  7,  0}},   // 9
+    {{.x = 18, .y =  5}, { 11,   9,   2,  20}, { 3,  3,  4,  9}},   // 10
+    {{.x = 21, .y =  5}, { 12,  10,   3,  16}, { 3,  3,  4,  3}},   // 11
+    {{.x = 24, .y =  5}, { 13,  11, 255,  17}, { 2,  3,  0,  3}},   // 12
+    {{.x = 26, .y =  5}, {255,  12,   3,  17}, { 0,  2,  9,  5}},   // 13
+    {{.x =  3, .y =  8}, { 15,   4,   5, 255}, { 3,  5,  3,  0}},   // 14
+    {{.x =  6, .y =  8}, {255,  14,   6,  21}, { 0,  3,  3,  6}},   // 15
+    {{.x = 21, .y =  8}, { 17, 255,  11,  24}, { 3,  0,  3,  6}},   // 16
+    {{.x = 24, .y =  8}, { 13,  16,  12, 255}, { 5,  3,  3,  0}},   // 17
+    {{.x = 12, .y = 11}, { 19,  22,   7, 255}, { 1,  6,  9,  0}},   // 18
+    {{.x = 13, .y = 11}, { 20,  18, 255, 255}, { 2,  1,  0,  0}},   // 19 (home)
+    {{.x = 15, .y = 11}, { 23,  19,  10, 255}, { 6,  2,  9,  0}},   // 20
+    {{.x =  6, .y = 14}, { 22,  24,  15,  27}, { 3, 13,  6,  6}},   // 21
+    {{.x =  9, .y = 14}, {255,  21,  18,  25}, { 0,  3,  6,  3}},   // 22
+    {{.x = 18, .y = 14}, { 24, 255,  20,  26}, { 3,  0,  6,  3}},   // 23
+    {{.x = 21, .y = 14}, { 21,  23,  16,  30}, {13,  3,  6,  6}},   // 24
+    {{.x =  9, .y = 17}, { 26, 255,  22,  28}, { 9,  0,  3,  3}},   // 25
+    {{.x = 18, .y = 17}, {255,  25,  23,  29}, { 0,  9,  3,  3}},   // 26
+    {{.x =  6, .y = 20}, { 28,  37,  21,  31}, { 3, 13,  6,  3}},   // 27
+    {{.x =  9, .y = 20}, { 33,  27,  25,  32}, { 6,  3,  3,  3}},   // 28
+    {{.x = 18, .y = 20}, { 30,  34,  26,  35}, { 3,  6,  3,  3}},   // 29
+    {{.x = 21, .y = 20}, { 40,  29,  24,  36}, {13,  3,  6,  3}},   // 30
+    {{.x =  6, .y = 23}, { 32, 255,  27,  38}, { 3,  0,  3,  3}},   // 31
+    {{.x =  9, .y = 23}, { 33,  31,  28,  42}, { 3,  3,  3,  9}},   // 32
+    {{.x = 12, .y = 23}, { 34,  32,  28, 255}, { 3,  3,  6,  0}},   // 33
+    {{.x = 15, .y = 23}, { 35,  33,  29, 255}, { 3,  3,  6,  0}},   // 34
+    {{.x = 18, .y = 23}, { 36,  34,  29,  43}, { 3,  3,  3,  9}},   // 35
+    {{.x = 21, .y = 23}, {255,  35,  30,  39}, { 0,  3,  3,  3}},   // 36
+    {{.x =  3, .y = 26}, { 38,  41,  27, 255}, { 3, 10, 13,  0}},   // 37
+    {{.x =  6, .y = 26}, {255,  37,  31,  41}, { 0,  3,  3,  3}},   // 38
+    {{.x = 21, .y = 26}, { 40, 255,  36,  44}, { 3,  0,  3,  3}},   // 39
+    {{.x = 24, .y = 26}, { 44,  39,  30, 255}, {10,  3, 13,  0}},   // 40
+    {{.x =  6, .y = 29}, { 42,  37,  38, 255}, { 6, 10,  3,  0}},   // 41
+    {{.x = 12, .y = 29}, { 43,  41,  32, 255}, { 3,  6,  9,  0}},   // 42
+    {{.x = 15, .y = 29}, { 44,  42,  35, 255}, { 6,  3,  9,  0}},   // 43
+    {{.x = 21, .y = 29}, { 40,  43,  39, 255}, {10,  6,  3,  0}}    // 44
+};
+
+// Level 4: wall outline (x, y, length, vertical) in pixels
+static const OutlineSegment LEVEL_4_OUTLINE[] = {
+    {5, 5, 102, 0}, {117, 5, 102, 0}, {18, 18, 28, 0}, {58, 18, 12, 0}, {82, 18, 12, 0}, {130, 18, 12, 0},
+    {154, 18, 12, 0}, {178, 18, 28, 0}, {18, 37, 28, 0}, {58, 37, 12, 0}, {82, 37, 12, 0}, {106, 37, 12, 0},
+    {130, 37, 12, 0}, {154, 37, 12, 0}, {178, 37, 28, 0}, {18, 50, 4, 0}, {34, 50, 12, 0}, {58, 50, 12, 0},
+    {82, 50, 60, 0}, {154, 50, 12, 0}, {178, 50, 12, 0}, {202, 50, 4, 0}, {18, 61, 4, 0}, {34, 61, 12, 0},
+    {82, 61, 25, 0}, {117, 61, 25, 0}, {178, 61, 12, 0}, {202, 61, 4, 0}, {5, 74, 41, 0}, {69, 74, 25, 0},
+    {130, 74, 25, 0}, {178, 74, 41, 0}, {69, 85, 25, 0}, {106, 85, 12, 0}, {130, 85, 25, 0}, {82, 98, 22, 0},
+    {120, 98, 22, 0}, {85, 101, 19, 0}, {120, 101, 19, 0}, {0, 109, 46, 0}, {58, 109, 12, 0}, {154, 109, 12, 0},
+    {178, 109, 46, 0}, {0, 122, 46, 0}, {58, 122, 12, 0}, {154, 122, 12, 0}, {178, 122, 46, 0}, {85, 130, 54, 0},
+    {82, 133, 60, 0}, {82, 146, 60, 0}, {5, 157, 41, 0}, {58, 157, 12, 0}, {82, 157, 25, 0}, {117, 157, 25, 0},
+    {154, 157, 12, 0}, {178, 157, 41, 0}, {18, 170, 28, 0}, {58, 170, 12, 0}, {82, 170, 12, 0}, {130, 170, 12, 0},
+    {154, 170, 12, 0}, {178, 170, 28, 0}, {18, 181, 17, 0}, {58, 181, 12, 0}, {82, 181, 12, 0}, {106, 181, 12, 0},
+    {130, 181, 12, 0}, {154, 181, 12, 0}, {189, 181, 17, 0}, {5, 194, 17, 0}, {58, 194, 12, 0}, {82, 194, 60, 0},
+    {154, 194, 12, 0}, {202, 194, 17, 0}, {5, 205, 17, 0}, {34, 205, 12, 0}, {82, 205, 25, 0}, {117, 205, 25, 0},
+    {178, 205, 12, 0}, {202, 205, 17, 0}, {18, 218, 28, 0}, {69, 218, 25, 0}, {130, 218, 25, 0}, {178, 218, 28, 0},
+    {18, 229, 28, 0}, {58, 229, 36, 0}, {106, 229, 12, 0}, {130, 229, 36, 0}, {178, 229, 28, 0}, {5, 242, 214, 0},
+    {5, 5, 70, 1}, {5, 157, 38, 1}, {5, 205, 38, 1}, {18, 18, 20, 1}, {18, 50, 12, 1}, {18, 170, 12, 1},
+    {18, 218, 12, 1}, {21, 50, 12, 1}, {21, 194, 12, 1}, {34, 50, 12, 1}, {34, 181, 25, 1}, {45, 18, 20, 1},
+    {45, 50, 12, 1}, {45, 74, 36, 1}, {45, 122, 36, 1}, {45, 170, 36, 1}, {45, 218, 12, 1}, {58, 18, 20, 1},
+    {58, 50, 60, 1}, {58, 122, 36, 1}, {58, 170, 12, 1}, {58, 194, 36, 1}, {69, 18, 20, 1}, {69, 50, 25, 1},
+    {69, 85, 25, 1}, {69, 122, 36, 1}, {69, 170, 12, 1}, {69, 194, 25, 1}, {82, 18, 20, 1}, {82, 50, 12, 1},
+    {82, 98, 36, 1}, {82, 146, 12, 1}, {82, 170, 12, 1}, {82, 194, 12, 1}, {85, 101, 30, 1}, {93, 18, 20, 1},
+    {93, 74, 12, 1}, {93, 170, 12, 1}, {93, 218, 12, 1}, {106, 5, 33, 1}, {106, 61, 25, 1}, {106, 157, 25, 1},
+    {106, 205, 25, 1}, {117, 5, 33, 1}, {117, 61, 25, 1}, {117, 157, 25, 1}, {117, 205, 25, 1}, {130, 18, 20, 1},
+    {130, 74, 12, 1}, {130, 170, 12, 1}, {130, 218, 12, 1}, {138, 101, 30, 1}, {141, 18, 20, 1}, {141, 50, 12, 1},
+    {141, 98, 36, 1}, {141, 146, 12, 1}, {141, 170, 12, 1}, {141, 194, 12, 1}, {154, 18, 20, 1}, {154, 50, 25, 1},
+    {154, 85, 25, 1}, {154, 122, 36, 1}, {154, 170, 12, 1}, {154, 194, 25, 1}, {165, 18, 20, 1}, {165, 50, 60, 1},
+    {165, 122, 36, 1}, {165, 170, 12, 1}, {165, 194, 36, 1}, {178, 18, 20, 1}, {178, 50, 12, 1}, {178, 74, 36, 1},
+    {178, 122, 36, 1}, {178, 170, 36, 1}, {178, 218, 12, 1}, {189, 50, 12, 1}, {189, 181, 25, 1}, {202, 50, 12, 1},
+    {202, 194, 12, 1}, {205, 18, 20, 1}, {205, 50, 12, 1}, {205, 170, 12, 1}, {205, 218, 12, 1}, {218, 5, 70, 1},
+    {218, 157, 38, 1}, {218, 205, 38, 1}
+};
+
+// Level 4: junction distances, upper triangle row by row
+static const unsigned char LEVEL_4_DISTANCES[] = {
+    3, 20, 23, 9, 7, 4, 7, 10, 13, 16, 19, 22, 24, 10, 7, 22, 25, 16, 17, 19, 13, 16, 25, 26,
+    19, 28, 19, 22, 31, 32, 22, 25, 28, 31, 34, 35, 28, 25, 38, 41, 28, 34, 37, 41, 17, 20, 12, 10,
+    7, 4, 7, 10, 13, 16, 19, 21, 13, 10, 19, 22, 13, 14, 16, 16, 19, 22, 25, 22, 25, 22, 25, 28,
+    31, 25, 28, 31, 34, 31, 34, 31, 28, 37, 40, 31, 37, 40, 40, 3, 21, 19, 16, 13, 10, 7, 4, 7,
+    10, 12, 22, 19, 10, 13, 16, 15, 13, 25, 22, 19, 16, 25, 22, 31, 28, 25, 22, 34, 31, 34, 31, 28,
+    25, 40, 37, 28, 31, 40, 40, 37, 31, 24, 22, 19, 16, 13, 10, 7, 4, 7, 9, 25, 22, 7, 10, 19,
+    18, 16, 26, 25, 16, 13, 28, 19, 32, 31, 22, 19, 35, 34, 31, 28, 25, 22, 41, 38, 25, 28, 41, 37,
+    34, 28, 2, 5, 8, 11, 14, 17, 20, 23, 25, 5, 8, 23, 26, 17, 18, 20, 14, 17, 26, 27, 20, 29,
+    20, 23, 32, 33, 23, 26, 29, 32, 35, 36, 29, 26, 39, 42, 29, 35, 38, 42, 3, 6, 9, 12, 15, 18,
+    21, 23, 3, 6, 21, 24, 15, 16, 18, 12, 15, 24, 25, 18, 27, 18, 21, 30, 31, 21, 24, 27, 30, 33,
+    34, 27, 24, 37, 40, 27, 33, 36, 40, 3, 6, 9, 12, 15, 18, 20, 6, 3, 18, 21, 12, 13, 15, 9,
+    12, 21, 22, 15, 24, 15, 18, 27, 28, 18, 21, 24, 27, 30, 31, 24, 21, 34, 37, 24, 30, 33, 37, 3,
+    6, 9, 12, 15, 17, 9, 6, 15, 18, 9, 10, 12, 12, 15, 18, 21, 18, 21, 18, 21, 24, 27, 21, 24,
+    27, 30, 27, 30, 27, 24, 33, 36, 27, 33, 36, 36, 3, 6, 9, 12, 14, 12, 9, 12, 15, 12, 13, 15,
+    15, 18, 21, 18, 21, 24, 21, 24, 27, 24, 24, 27, 30, 33, 30, 27, 30, 27, 30, 33, 30, 36, 39, 33,
+    3, 6, 9, 11, 15, 12, 9, 12, 15, 14, 12, 18, 21, 18, 15, 24, 21, 24, 27, 24, 21, 27, 30, 33,
+    30, 27, 24, 33, 30, 27, 30, 33, 39, 36, 30, 3, 6, 8, 18, 15, 6, 9, 12, 11, 9, 21, 18, 15,
+    12, 21, 18, 27, 24, 21, 18, 30, 27, 30, 27, 24, 21, 36, 33, 24, 27, 36, 36, 33, 27, 3, 5, 21,
+    18, 3, 6, 15, 14, 12, 22, 21, 12, 9, 24, 15, 28, 27, 18, 15, 31, 30, 27, 24, 21, 18, 37, 34,
+    21, 24, 37, 33, 30, 24, 2, 24, 21, 6, 3, 18, 17, 15, 25, 24, 15, 12, 27, 18, 31, 30, 21, 18,
+    34, 33, 30, 27, 24, 21, 40, 37, 24, 27, 40, 36, 33, 27, 26, 23, 8, 5, 20, 19, 17, 27, 26, 17,
+    14, 29, 20, 33, 32, 23, 20, 36, 35, 32, 29, 26, 23, 42, 39, 26, 29, 42, 38, 35, 29, 3, 24, 27,
+    18, 19, 21, 9, 12, 25, 22, 15, 24, 15, 18, 27, 28, 18, 21, 24, 27, 30, 31, 24, 21, 34, 37, 24,
+    30, 33, 37, 21, 24, 15, 16, 18, 6, 9, 22, 19, 12, 21, 12, 15, 24, 25, 15, 18, 21, 24, 27, 28,
+    21, 18, 31, 34, 21, 27, 30, 34, 3, 18, 17, 15, 19, 22, 9, 6, 21, 12, 25, 24, 15, 12, 28, 27,
+    24, 21, 18, 15, 34, 31, 18, 21, 34, 30, 27, 21, 21, 20, 18, 22, 25, 12, 9, 24, 15, 28, 27, 18,
+    15, 31, 30, 27, 24, 21, 18, 37, 34, 21, 24, 37, 33, 30, 24, 1, 3, 9, 6, 9, 12, 9, 12, 15,
+    12, 15, 18, 18, 15, 18, 21, 18, 21, 24, 21, 24, 27, 24, 24, 27, 27, 2, 10, 7, 8, 11, 10, 11,
+    16, 13, 14, 17, 19, 16, 19, 20, 17, 20, 25, 22, 23, 26, 25, 25, 26, 26, 12, 9, 6, 9, 12, 9,
+    18, 15, 12, 15, 21, 18, 21, 18, 15, 18, 27, 24, 21, 24, 27, 27, 24, 24, 3, 16, 13, 6, 15, 6,
+    9, 18, 19, 9, 12, 15, 18, 21, 22, 15, 12, 25, 28, 15, 21, 24, 28, 15, 16, 3, 12, 9, 6, 15,
+    18, 12, 9, 12, 15, 18, 21, 18, 15, 24, 27, 18, 18, 21, 27, 3, 12, 3, 18, 15, 6, 9, 21, 18,
+    15, 12, 9, 12, 27, 24, 15, 18, 27, 21, 18, 18, 15, 6, 19, 18, 9, 6, 22, 21, 18, 15, 12, 9,
+    28, 25, 12, 15, 28, 24, 21, 15, 9, 6, 3, 12, 15, 9, 6, 9, 12, 15, 18, 15, 12, 21, 24, 15,
+    15, 18, 24, 15, 12, 3, 6, 18, 15, 12, 9, 6, 9, 24, 21, 12, 15, 24, 18, 15, 15, 3, 18, 21,
+    3, 6, 9, 12, 15, 18, 9, 6, 21, 24, 9, 15, 18, 24, 15, 18, 6, 3, 6, 9, 12, 15, 12, 9,
+    18, 21, 12, 12, 15, 21, 3, 15, 12, 9, 6, 3, 6, 21, 18, 9, 12, 21, 15, 12, 12, 18, 15, 12,
+    9, 6, 3, 24, 21, 6, 9, 24, 18, 15, 9, 3, 6, 9, 12, 15, 6, 3, 18, 21, 6, 12, 15, 21,
+    3, 6, 9, 12, 9, 6, 15, 18, 9, 9, 12, 18, 3, 6, 9, 12, 9, 12, 15, 12, 12, 15, 15, 3,
+    6, 15, 12, 9, 12, 15, 15, 12, 12, 3, 18, 15, 6, 9, 18, 12, 9, 9, 21, 18, 3, 6, 21, 15,
+    12, 6, 3, 24, 27, 6, 12, 15, 21, 21, 24, 3, 9, 12, 18, 3, 18, 12, 9, 3, 21, 15, 12, 6,
+    6, 9, 15, 3, 9, 6
+};
+
+const LevelDescriptor LEVEL_PACK[] = {
+    {   // Level 1
+        {0, 1, 2, 2, 2, 3, 4, 4, 5, 6, 6, 7, 8, 9, 10, 9, 11, 7, 11, 11, 1, 2, 2, 12, 13, 13, 5, 14, 14, 3, 0},
+        {.x = 14, .y = 23},   // Pac-Man spawn
+        {.x = 13, .y = 12},   // Ghost house door
+        240, 6, 60,          // Pills, special pills, time (s)
+        {0, 1, 2, 2, 2, 3, 4, 4, 5, 6, 6, 7, 8, 9, 10, 11, 8, 12, 8, 8, 13, 2, 2, 14, 15, 15, 16, 17, 17, 18, 0},
+        {14, 5, 22},         // Tunnel row, left end, right start
+        35, 13,              // Junctions, home junction
+        LEVEL_1_NODES,
+        LEVEL_1_DISTANCES,
+        148,
+        LEVEL_1_OUTLINE
+    },
+    {   // Level 2
+        {0, 1, 15, 15, 15, 3, 16, 16, 5, 6, 6, 7, 8, 9, 10, 9, 11, 7, 11, 11, 1, 2, 2, 12, 13, 13, 5, 14, 14, 3, 0},
+        {.x = 14, .y = 23},   // Pac-Man spawn
+        {.x = 13, .y = 12},   // Ghost house door
+        250, 5, 55,          // Pills, special pills, time (s)
+        {0, 19, 20, 20, 20, 21, 22, 22, 23, 6, 6, 7, 8, 9, 10, 11, 8, 12, 8, 8, 13, 2, 2, 14, 15, 15, 16, 17, 17, 18, 0},
+        {14, 5, 22},         // Tunnel row, left end, right start
+        41, 19,              // Junctions, home junction
+        LEVEL_2_NODES,
+        LEVEL_2_DISTANCES,
+        164,
+        LEVEL_2_OUTLINE
+    },
+    {   // Level 3
+        {0, 1, 2, 2, 2, 3, 16, 16, 5, 6, 6, 7, 8, 9, 10, 9, 11, 7, 11, 11, 1, 15, 15, 12, 13, 13, 5, 2, 2, 3, 0},
+        {.x = 14, .y = 23},   // Pac-Man spawn
+        {.x = 13, .y = 12},   // Ghost house door
+        252, 4, 50,          // Pills, special pills, time (s)
+        {0, 1, 2, 2, 2, 24, 22, 22, 23, 6, 6, 7, 8, 9, 10, 11, 8, 12, 8, 8, 25, 20, 20, 26, 15, 15, 27, 2, 2, 28, 0},
+        {14, 5, 22},         // Tunnel row, left end, right start
+        43, 17,              // Junctions, home junction
+        LEVEL_3_NODES,
+        LEVEL_3_DISTANCES,
+        168,
+        LEVEL_3_OUTLINE
+    },
+    {   // Level 4
+        {0, 1, 17, 17, 17, 3, 18, 18, 5, 6, 6, 7, 8, 9, 10, 9, 11, 7, 11, 11, 1, 17, 17, 12, 13, 13, 5, 19, 19, 3, 0},
+        {.x = 13, .y = 23},   // Pac-Man spawn
+        {.x = 13, .y = 12},   // Ghost house door
+        240, 3, 45,          // Pills, special pills, time (s)
+        {0, 19, 20, 20, 20, 21, 22, 22, 23, 6, 6, 7, 8, 9, 10, 11, 8, 12, 8, 8, 25, 20, 20, 26, 15, 15, 27, 2, 2, 28, 0},
+        {14, 5, 22},         // Tunnel row, left end, right start
+        45, 19,              // Junctions, home junction
+        LEVEL_4_NODES,
+        LEVEL_4_DISTANCES,
+        176,
+        LEVEL_4_OUTLINE
+    }
+};
@@ -0,0 +1,88 @@
+#include "game_movement.h"
+
+// Speed tables, in percent of GAME_CONFIG.pacmanSpeed (arcade progression)
+static const LevelSpeeds LEVEL_SPEEDS[] = {
+    /* last  pac  pacFr  ghost  ghostFr  tunnel  eaten */
+    {  1,    80,  90,    75,    50,      40,     150 },   // Level 1
+    {  4,    90,  95,    85,    55,      45,     150 },   // Levels 2-4
+    { 20,   100, 100,    95,    60,      50,     160 },   // Levels 5-20
+    {  0,    90,  90,    95,    60,      50,     160 }    // Levels 21+
+};
+
+#define LEVEL_SPEEDS_COUNT (sizeof(LEVEL_SPEEDS) / sizeof(LEVEL_SPEEDS[0]))
+
+// Tunnel bounds of the current maze (from its level tables)
+static unsigned char tunnelRow = LEVEL_NO_TUNNEL;
+static unsigned char tunnelLeftEnd = 0;    // Last tunnel cell on the left side
+static unsigned char tunnelRightStart = 0; // First tunnel cell on the right side
+
+// Return the speed row of a level
+const LevelSpeeds* movement_get_level_speeds(unsigned char level) {
+    unsigned char index;
+
+    for (index = 0; index < LEVEL_SPEEDS_COUNT - 1; index++) {
+        if (level <= LEVEL_SPEEDS[index].lastLevel) {
+            break;
+        }
+    }
+    return &LEVEL_SPEEDS[index];
+}
+
+// Convert a percentage of the reference speed into tile progress per movement tick
+unsigned short movement_speed_from_percent(unsigned char percent) {
+    // pacmanSpeed tiles/s * percent / 100, spread over the ticks of one second
+    unsigned int speed = ((unsigned int)GAME_CONFIG.pacmanSpeed * percent * MOVEMENT_PROGRESS_ONE) / (100UL * MOVEMENT_TICKS_PER_SECOND);
+
+    // An actor never crosses more than one tile per tick
+    if (speed >= MOVEMENT_PROGRESS_ONE) {
+        speed = MOVEMENT_PROGRESS_ONE - 1;
+    }
+    return (unsigned short)speed;
+}
+
+// Change the speed of an actor (the progress already made is kept)
+void movement_set_speed(Sprite* sprite, unsigned char percent) {
+    sprite->speed = movement_speed_from_percent(percent);
+}
+
+// Forget the progress made towards the next tile (spawn, teleport back home)
+void movement_reset_progress(Sprite* sprite) {
+    sprite->progress = 0;
+}
+
+// Advance an actor by one movement tick, returns 1 when it has to step by one tile
+unsigned char movement_advance(Sprite* sprite) {
+    const unsigned int progress = (unsigned int)sprite->progress + sprite->speed;
+
+    sprite->progress = (unsigned short)progress;   // Keep the fraction only
+    return (progress >= MOVEMENT_PROGRESS_ONE);
+}
+
+// Advance a table of actors by one movement tick, returns one bit per actor that has to step
+unsigned int movement_advance_all(unsigned short progress[], const unsigned short speed[], unsigned char count) {
+    unsigned int stepMask = 0;
+    unsigned int next;
+    unsigned char index;
+
+    for (index = 0; index < count; index++) {
+        next = (unsigned int)progress[index] + speed[index];
+        progress[index] = (unsigned short)next;
+        stepMask |= (next >> 16) << index;   // Carry out of the fraction = one tile
+    }
+    return stepMask;
+}
+
+// Select the teleport tunnel of a maze
+void movement_set_tunnel(const TunnelBounds* tunnel) {
+    tunnelRow = tunnel->row;
+    tunnelLeftEnd = tunnel->leftEnd;
+    tunnelRightStart = tunnel->rightStart;
+}
+
+// Check whether a cell belongs to the teleport tunnel
+unsigned char movement_is_tunnel_cell(Position position) {
+    if (position.y != tunnelRow) {
+        return 0;
+    }
+    return (position.x <= tunnelLeftEnd) || (position.x >= tunnelRightStart);
+}
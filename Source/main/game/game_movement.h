@@ -0,0 +1,45 @@
+#ifndef __GAME_MOVEMENT_H
+#define __GAME_MOVEMENT_H
+
+#include "game_engine.h"
+#include "game_levels.h"
+#include "../event_scheduler.h"
+
+/*
+ * Fixed-point sub-tile movement.
+ *
+ * Every actor owns a speed and a progress accumulator, both expressed in
+ * 1/65536 of a tile. A single periodic event (EVENT_MOVEMENT_TICK) adds the
+ * speed to the progress of every actor and the actor steps by one tile each
+ * time its progress overflows. Actor tables (the ghosts) are advanced in a
+ * single pass by movement_advance_all. Speeds are percentages of
+ * GAME_CONFIG.pacmanSpeed taken from per-level tables, so changing a speed
+ * never touches a timer.
+ */
+
+#define MOVEMENT_TICK_MS            20                        // Period of the common movement tick
+#define MOVEMENT_TICKS_PER_SECOND   (1000 / MOVEMENT_TICK_MS)
+#define MOVEMENT_PROGRESS_ONE       0x10000UL                 // One whole tile of progress
+#define GHOST_ACCELERATION_PERCENT  5                         // Speed bonus of each ghost acceleration step
+
+// Speeds of a group of levels, in percent of the reference speed
+typedef struct {
+    unsigned char lastLevel;          // Last level using this row (0 = every further level)
+    unsigned char pacmanNormal;       // Pac-Man
+    unsigned char pacmanFrightened;   // Pac-Man while the ghosts are frightened
+    unsigned char ghostNormal;        // Ghost chasing Pac-Man
+    unsigned char ghostFrightened;    // Vulnerable ghost
+    unsigned char ghostTunnel;        // Ghost inside the teleport tunnel
+    unsigned char ghostEaten;         // Eyes of an eaten ghost going home
+} LevelSpeeds;
+
+const LevelSpeeds* movement_get_level_speeds(unsigned char level);
+unsigned short movement_speed_from_percent(unsigned char percent);
+void movement_set_speed(Sprite* sprite, unsigned char percent);
+void movement_reset_progress(Sprite* sprite);
+unsigned char movement_advance(Sprite* sprite);
+unsigned int movement_advance_all(unsigned short progress[], const unsigned short speed[], unsigned char count);
+void movement_set_tunnel(const TunnelBounds* tunnel);
+unsigned char movement_is_tunnel_cell(Position position);
+
+#endif /* __GAME_MOVEMENT_H */
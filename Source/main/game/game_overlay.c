@@ -0,0 +1,152 @@
+#include "game_overlay.h"
+#include "game_collision.h"
+#include "game_renderer.h"
+
+#define OVERLAY_ACTOR_SHIFT 4      // Tile index: cell type in the low nibble, drawn actor + 1 in the high one
+#define OVERLAY_CELL_MASK   0x0F
+
+typedef struct {
+    unsigned short yStart;                   // Screen rows of the banner
+    unsigned short yEnd;
+    unsigned char firstRow;                  // Maze rows under it
+    unsigned char rowCount;
+    OverlayPainter paint;
+    unsigned char tiles[OVERLAY_MAX_TILES];  // Save-under, row by row
+} Overlay;
+
+static Overlay overlays[OVERLAY_MAX_DEPTH];
+static unsigned char depth = 0;
+
+// Tile index of a maze cell as it is drawn now (the ghosts are drawn over Pac-Man)
+static unsigned char tile_at(Position position) {
+    const unsigned char actors = collision_actors_at(position);
+    unsigned char actor = 0;
+    unsigned char id;
+
+    for (id = ACTOR_PACMAN; id <= ACTOR_CLYDE; id++) {
+        if (actors & ACTOR_MASK(id)) {
+            actor = id + 1;
+        }
+    }
+    return gameRunning.gameMap[position.y][position.x] | (actor << OVERLAY_ACTOR_SHIFT);
+}
+
+// Draw a saved tile: the cell, then the actor that stood on it
+static void draw_tile(unsigned char tile, Position position) {
+    const unsigned char actor = tile >> OVERLAY_ACTOR_SHIFT;
+
+    draw_cell((CellType)(tile & OVERLAY_CELL_MASK), position);
+    if (actor == ACTOR_PACMAN + 1) {
+        draw_cell(CELL_PACMAN, position);
+    } else if (actor > ACTOR_PACMAN + 1) {
+        draw_ghost(ACTOR_TO_GHOST(actor - 1));
+    }
+}
+
+// Save-under entry of a maze cell in an overlay, NULL if the overlay does not cover it
+static unsigned char* saved_tile(Overlay* overlay, Position position) {
+    if ((position.y < overlay->firstRow) || (position.y >= overlay->firstRow + overlay->rowCount)) {
+        return NULL;
+    }
+    return &overlay->tiles[(position.y - overlay->firstRow) * GAME_MAP_WIDTH + position.x];
+}
+
+static unsigned char overlays_overlap(const Overlay* first, const Overlay* second) {
+    return (first->yStart <= second->yEnd) && (second->yStart <= first->yEnd);
+}
+
+/**
+ * @brief Paints a banner over the maze, saving the tiles it covers.
+ *
+ * A tile already under a lower banner is taken from that banner's record.
+ *
+ * @param yStart First screen row of the banner.
+ * @param yEnd Last screen row of the banner (included).
+ * @param paint Draws the banner; called again whenever it has to be repainted.
+ * @return 1 if the banner is up, 0 if the stack is full or the banner is too tall.
+ */
+unsigned char overlay_push(unsigned short yStart, unsigned short yEnd, OverlayPainter paint) {
+    Overlay* overlay;
+    unsigned char* tile;
+    unsigned char* under;
+    unsigned char lower;
+    short first = ((short)yStart - GAME_MAP_START_Y) / TILE_SCALE;
+    short last = ((short)yEnd - GAME_MAP_START_Y) / TILE_SCALE;
+    Position position;
+
+    first = (first < 0) ? 0 : first;
+    last = (last >= GAME_MAP_HEIGHT) ? (GAME_MAP_HEIGHT - 1) : last;
+    if ((depth == OVERLAY_MAX_DEPTH) || (yEnd < yStart) || (last - first + 1 > OVERLAY_MAX_ROWS)) {
+        return 0;
+    }
+
+    overlay = &overlays[depth];
+    overlay->yStart = yStart;
+    overlay->yEnd = yEnd;
+    overlay->firstRow = (unsigned char)first;
+    overlay->rowCount = (last >= first) ? (unsigned char)(last - first + 1) : 0;
+    overlay->paint = paint;
+
+    tile = overlay->tiles;
+    for (position.y = overlay->firstRow; position.y < overlay->firstRow + overlay->rowCount; position.y++) {
+        for (position.x = 0; position.x < GAME_MAP_WIDTH; position.x++) {
+            *tile = tile_at(position);
+            for (lower = depth; lower > 0; lower--) {
+                under = saved_tile(&overlays[lower - 1], position);
+                if (under != NULL) {
+                    *tile = *under;   // The topmost banner below has the maze as it was
+                    break;
+                }
+            }
+            tile++;
+        }
+    }
+
+    depth++;
+    paint();
+    return 1;
+}
+
+// Take the top banner off: restore the tiles under it, then repaint the banners below that it overlapped
+void overlay_pop(void) {
+    const Overlay* overlay;
+    const unsigned char* tile;
+    unsigned char lower;
+    Position position;
+
+    if (depth == 0) {
+        return;
+    }
+    overlay = &overlays[--depth];
+
+    tile = overlay->tiles;
+    for (position.y = overlay->firstRow; position.y < overlay->firstRow + overlay->rowCount; position.y++) {
+        for (position.x = 0; position.x < GAME_MAP_WIDTH; position.x++) {
+            draw_tile(*tile++, position);
+        }
+    }
+    clear_banner_margins(overlay->yStart, overlay->yEnd);
+
+    for (lower = 0; lower < depth; lower++) {
+        if (overlays_overlap(&overlays[lower], overlay)) {
+            overlays[lower].paint();
+        }
+    }
+}
+
+// Take every banner off
+void overlay_pop_all(void) {
+    while (depth) {
+        overlay_pop();
+    }
+}
+
+// Forget the banners without restoring anything (the maze is about to be redrawn whole)
+void overlay_discard_all(void) {
+    depth = 0;
+}
+
+// Number of banners on screen
+unsigned char overlay_depth(void) {
+    return depth;
+}
@@ -0,0 +1,36 @@
+#ifndef __GAME_OVERLAY_H
+#define __GAME_OVERLAY_H
+
+#include "game_engine.h"
+
+/*
+ * Save-under overlays.
+ *
+ * A banner painted across the maze (pause, lost life) is pushed as an
+ * overlay: the maze tiles under its rows are recorded first, as tile
+ * indices (the cell type, plus the actor drawn on it), then the banner is
+ * painted. Popping the overlay redraws exactly those tiles and clears the
+ * screen margins the banner spilled on, so dismissing a banner costs at
+ * most OVERLAY_MAX_TILES cell draws whatever it covered.
+ *
+ * Overlays stack. A tile already under a lower overlay is recorded as such
+ * and is not restored when the upper one is popped; the lower banner is
+ * painted again instead, and its own record stays valid.
+ *
+ * The records describe the maze as it was when the banner appeared: when
+ * the maze is redrawn whole while banners are up, they are discarded.
+ */
+
+#define OVERLAY_MAX_DEPTH 2                                 // Banners on screen at once
+#define OVERLAY_MAX_ROWS  3                                 // Maze rows under a 16-pixel banner, not aligned on the tiles
+#define OVERLAY_MAX_TILES (OVERLAY_MAX_ROWS * GAME_MAP_WIDTH)
+
+typedef void (*OverlayPainter)(void);
+
+unsigned char overlay_push(unsigned short yStart, unsigned short yEnd, OverlayPainter paint);
+void overlay_pop(void);
+void overlay_pop_all(void);
+void overlay_discard_all(void);
+unsigned char overlay_depth(void);
+
+#endif /* __GAME_OVERLAY_H */
@@ -1,33 +1,16 @@
 #include "game_renderer.h"
-
-/**
- * Enumeration for render styles used in the game.
- */
-typedef enum {
-    RENDER_STYLE_FULL = 0,     // Fill the entire cell
-    RENDER_STYLE_BORDER = 1,   // Render only the border of the cell
-    RENDER_STYLE_CIRCLE = 2,   // Render a circular style
-    RENDER_STYLE_PACMAN = 3,    // Render in a Pac-Man style
-		RENDER_STYLE_GHOST  = 4  	 // Render ghost style
-} RenderStyle;
+#include "game_levels.h"
+#include "game_tiles.h"
+#include "game_wipe.h"
+#include "game_band.h"
+#include "game_hud.h"
 
 /** Constants defining rendering properties */
 #define RENDER_CELL_SIZE (TILE_SCALE)                          // Size of a single cell
 #define RENDER_CELL_OFFSET (RENDER_CELL_SIZE - 1)             // Offset for rendering within a cell
 #define RENDER_CHAR_WIDTH_PIXELS 8                            // Character width in pixels
 #define RENDER_CHAR_HEIGHT_PIXELS 16                          // Character height in pixels
-#define WRITINGS_DISPLAY_CENTER_Y (DISPLAY_CENTER_Y - (RENDER_CHAR_HEIGHT_PIXELS / 2)) // Center Y for text
-#define PAUSE_WRITING_START_Y 11                              // Start Y-coordinate for PAUSE text
-#define PAUSE_WRITING_END_Y 17                                // End Y-coordinate for PAUSE text
-
-/** Color definitions for rendering elements */
-#define PACMAN_COLOR COL_YELLOW                               // Color of Pac-Man
-#define GHOST_COLOR COL_RED																		// Color of Blinky Ghost
-#define PACMAN_REDUCTION 1                                    // Reduction for rendering Pac-Man
-#define GHOST_REDUCTION 1
-#define PILL_COLOR COL_TUMBLEWEED                             // Color of standard pills
-#define SPECIAL_PILL_REDUCTION 1                              // Reduction for rendering special pills
-#define STANDARD_PILL_REDUCTION 3                             // Reduction for rendering standard pills
+#define WRITINGS_DISPLAY_CENTER_Y BANNER_START_Y              // Center Y for text
 
 /** Boolean constants for text width handling */
 #define IS_FULL_WIDTH 1                                       // Full-width text rendering
@@ -35,27 +18,12 @@ typedef enum {
 
 /** Function prototypes for rendering different elements */
 void render_map_segment(unsigned char portion_start, unsigned char portion_end);
+void render_outline(unsigned short left, unsigned short top, unsigned short right, unsigned short bottom);
 void clear_cell(Position pos);
-void render_wall(Position pos);
-void render_pill(Position pos);
-void render_special_pill(Position pos);
 void render_character(Position pos);
-void render_ghost(Position pos);
 void render_ghost_door(Position pos);
 void fill_line(unsigned short xStart, unsigned short yStart, unsigned short xEnd, unsigned short yEnd, unsigned short color);
-void draw_border(unsigned short xStart, unsigned short yStart, unsigned short xEnd, unsigned short yEnd, unsigned short color);
-void render_circle(unsigned short xStart, unsigned short yStart, unsigned short xEnd, unsigned short yEnd, unsigned short color);
-void render_character_model(unsigned short xStart, unsigned short yStart, unsigned short xEnd, unsigned short yEnd, unsigned short color, Direction orientation, unsigned char animationFrame);
-void render_character_right(unsigned short xStart, unsigned short yStart, unsigned short xEnd, unsigned short yEnd, unsigned char frame, unsigned short color);
-void render_character_left(unsigned short xStart, unsigned short yStart, unsigned short xEnd, unsigned short yEnd, unsigned char frame, unsigned short color);
-void render_character_up(unsigned short xStart, unsigned short yStart, unsigned short xEnd, unsigned short yEnd, unsigned char frame, unsigned short color);
-void render_character_down(unsigned short xStart, unsigned short yStart, unsigned short xEnd, unsigned short yEnd, unsigned char frame, unsigned short color);
-void render_ghost_model(unsigned short xStart, unsigned short yStart, unsigned short xEnd, unsigned short yEnd, unsigned short color, Direction orientation, unsigned char animationFrame);
-void render_ghost_eyes(unsigned short xStart, unsigned short yStart, unsigned short colorEyes, unsigned char animationFrame, Direction orientation);
-void render_ghost_body(unsigned short xStart, unsigned short yStart, unsigned short xEnd, unsigned short yEnd, unsigned short colorBody);
-void render_ghost_lower_body(unsigned short xStart, unsigned short yStart, unsigned short xEnd, unsigned short yEnd, unsigned short colorBody, unsigned char animationFrame);
-void fill_cell(Position pos, unsigned short color, unsigned char fillStyle);
-void fill_cell_with_offset(Position pos, unsigned char reduction, unsigned short color, RenderStyle fillStyle);
+Direction tile_facing(Direction direction);
 void render_text(unsigned short xStart, unsigned short yStart, char* string, unsigned short color, unsigned short colorBackground);
 void render_centered_text(char* string, unsigned short color, unsigned short colorBackground, unsigned char isFullWidth);
 void render_centered_text_with_y_offset(unsigned short start_y, char* string, unsigned short color, unsigned short colorBackground, unsigned char isFullWidth);
@@ -73,9 +41,10 @@ void draw_pause_screen() {
     render_centered_text_with_y_offset(WRITINGS_DISPLAY_CENTER_Y, "PAUSED", COL_WHITE, COL_BLACK, IS_FULL_WIDTH);
 }
 
-/** Remove the PAUSE screen */
-void undraw_pause_screen() {
-    render_centered_text_with_y_offset(WRITINGS_DISPLAY_CENTER_Y, " ", COL_BLACK, COL_BLACK, IS_FULL_WIDTH);
+/** Clear the parts of a banner's rows outside the maze (the maze itself is restored tile by tile) */
+void clear_banner_margins(unsigned short yStart, unsigned short yEnd) {
+    fill_line(0, yStart, GAME_MAP_START_X - 1, yEnd, COL_BLACK);
+    fill_line(GAME_MAP_START_X + GAME_MAP_PIXEL_WIDTH, yStart, DISPLAY_WIDTH - 1, yEnd, COL_BLACK);
 }
 
 /** Draw the victory screen */
@@ -83,49 +52,33 @@ void draw_screen_victory() {
     render_centered_text("A VIND!", COL_YELLOW, COL_BLACK, IS_NOT_FULL_WIDTH);
 }
 
-/** Draw the GAME OVER screen */
-void draw_screen_game_over() {
-    LCD_Clear(COL_BLACK);
+/** Wipe band of a black screen */
+static void clear_screen_lines(unsigned short yStart, unsigned short yEnd) {
+    fill_line(0, yStart, DISPLAY_WIDTH - 1, yEnd, COL_BLACK);
+}
+
+/** Write the GAME OVER message once the black screen is in */
+static void draw_screen_game_over_message() {
     render_centered_text_with_y_offset(WRITINGS_DISPLAY_CENTER_Y , "GAME OVER!", COL_RED, COL_BLACK, IS_FULL_WIDTH);
 }
 
+/** Draw the GAME OVER screen: a black screen wipes the maze away, then the message */
+void draw_screen_game_over() {
+    wipe_start(clear_screen_lines, draw_screen_game_over_message);
+}
+
 /** Draw the failure screen */
 void draw_screen_failure() {
     render_centered_text_with_y_offset(WRITINGS_DISPLAY_CENTER_Y, "FAIL! TRY AGAIN", COL_RED, COL_BLACK, IS_FULL_WIDTH);
 }
 
-/** Draw statistics on the screen */
+/** Draw the statistics labels; the values follow with the next HUD update */
 void draw_area_stat() {
     render_text(TIMER_AREA_START_X+16, PLAYER_GUI_START_Y , "TIME", COL_WHITE, COL_BLACK);
     render_text(SCORE_AREA_START_X+16, PLAYER_GUI_START_Y , "SCORE", COL_WHITE, COL_BLACK);
 
-    draw_time_stat(gameRunning.remainingTime);
-    draw_stat_score(gameRunning.score);
-    draw_status_lives(gameRunning.remainingLives);
-}
-
-/** Draw the remaining time statistic */
-void draw_time_stat(unsigned char timeValue) {
-    render_text(TIMER_VALUE_START_X, TIMER_VALUE_START_Y , int_to_padded_string(timeValue, 2), COL_WHITE, COL_BLACK);
-}
-
-/** Draw the score statistic */
-void draw_stat_score(unsigned short scoreValue) {
-    render_text(SCORE_VALUE_START_X, SCORE_VALUE_START_Y, int_to_padded_string(scoreValue, 4), COL_WHITE, COL_BLACK);
-}
-
-/** Draw the player's remaining lives */
-void draw_status_lives(unsigned char livesValue) {
-    const unsigned char DISPLAY_PADDING__LIVES = RENDER_CELL_SIZE / 2;
-    unsigned char i;
-    for(i = 0; i < GAME_CONFIG.maxLives; i++) {
-        unsigned short temp = ((RENDER_CELL_SIZE + DISPLAY_PADDING__LIVES) * i);
-        if(i < livesValue) {
-            render_character_model(LIVES_VALUE_START_X + temp, LIVES_VALUE_START_Y, LIVES_VALUE_START_X + temp + RENDER_CELL_OFFSET, LIVES_VALUE_START_Y + RENDER_CELL_OFFSET, PACMAN_COLOR, DIRECTION_LEFT, 0);
-        } else {
-            fill_line(LIVES_VALUE_START_X + temp, LIVES_VALUE_START_Y, LIVES_VALUE_START_X + temp + RENDER_CELL_OFFSET, LIVES_VALUE_START_Y + RENDER_CELL_OFFSET, COL_BLACK);
-        }
-    }
+    hud_set_stats(gameRunning.remainingTime, gameRunning.score, gameRunning.remainingLives);
+    hud_redraw();
 }
 
 /** Draw the entire game map */
@@ -133,477 +86,206 @@ void draw_game_map() {
     render_map_segment(0, GAME_MAP_HEIGHT);
 }
 
-/** Redraw the map portion obscured by the PAUSE screen */
-void redraw_after_pause() {
-    render_map_segment(PAUSE_WRITING_START_Y, PAUSE_WRITING_END_Y);
+/** Draw the maze rows that cross screen lines yStart..yEnd (a wipe band) */
+void draw_game_map_lines(unsigned short yStart, unsigned short yEnd) {
+    if ((yEnd < GAME_MAP_START_Y) || (yStart >= GAME_MAP_END_Y)) {
+        return;
+    }
+    yStart = (yStart < GAME_MAP_START_Y) ? GAME_MAP_START_Y : yStart;
+    yEnd = (yEnd >= GAME_MAP_END_Y) ? (GAME_MAP_END_Y - 1) : yEnd;
+    render_map_segment((yStart - GAME_MAP_START_Y) / TILE_SCALE, (yEnd - GAME_MAP_START_Y) / TILE_SCALE + 1);
 }
 
-/** Render a segment of the map */
+/**
+ * Render a segment of the map from the level tables: the band cleared in one fill, the wall
+ * outline segments that cross it, then the door and the pills still on the map.
+ */
 void render_map_segment(unsigned char portion_start, unsigned char portion_end) {
+    const LevelDescriptor* level = level_get(gameRunning.level);
+    const LevelRowTables* row;
+    const unsigned char* pills;
     unsigned char i, j;
     CellType temp;
     Position temp_pos;
 
+    fill_line(to_absolute_x(0), to_absolute_y(portion_start), to_absolute_x(GAME_MAP_WIDTH - 1) + RENDER_CELL_OFFSET, to_absolute_y(portion_end - 1) + RENDER_CELL_OFFSET, palette_color(PALETTE_BACKGROUND));
+    render_outline(0, portion_start * RENDER_CELL_SIZE, GAME_MAP_WIDTH * RENDER_CELL_SIZE - 1, portion_end * RENDER_CELL_SIZE - 1);
+
     for(i = portion_start; i < portion_end; i++) {
-        for(j = 0; j < GAME_MAP_WIDTH; j++) {
-            temp = (CellType) gameRunning.gameMap[i][j];
-            temp_pos = (Position) {.x = j, .y = i};
-            draw_cell(temp, temp_pos);
+        row = level_row_tables(level, i);
+        pills = &LEVEL_PILL_COLUMNS[row->firstPill];
+        temp_pos.y = i;
+
+        if(i == level->ghostDoor.y) {
+            temp_pos.x = level->ghostDoor.x;
+            render_ghost_door(temp_pos);
+            temp_pos.x++;
+            render_ghost_door(temp_pos);
         }
-    }
-}
 
-/** Render a single cell based on its type */
-void draw_cell(CellType cell_type, Position cell_pos) {
-    switch(cell_type) {
-        case CELL_FREE:
-            clear_cell(cell_pos);
-            break;
-        case CELL_WALL:
-            render_wall(cell_pos);
-            break;
-        case CELL_TELEPORT_LEFT:
-        case CELL_TELEPORT_RIGHT:
-            clear_cell(cell_pos);
-            break;
-        case CELL_STANDARD_PILL:
-            clear_cell(cell_pos);  // Prevent lingering pill artifacts
-            render_pill(cell_pos);
-            break;
-        case CELL_SPECIAL_PILL:
-            render_special_pill(cell_pos);
-            break;
-        case CELL_PACMAN:
-            render_character(cell_pos);
-            break;
-        case CELL_GHOST_DOOR:
-            render_ghost_door(cell_pos);
-            break;
-				case CELL_GHOST:
-						render_ghost(cell_pos);
-						break;
-        default:
-            clear_cell(cell_pos);
-            break;
+        for(j = 0; j < row->pillCount; j++) {
+            temp_pos.x = pills[j];
+            temp = (CellType) gameRunning.gameMap[i][temp_pos.x];
+            if(temp == CELL_STANDARD_PILL) {
+                tile_draw_over(TILE_PILL, to_absolute_x(temp_pos.x), to_absolute_y(i), PALETTE_PILL);   // The band is clear already
+            } else if(temp == CELL_SPECIAL_PILL) {
+                tile_draw_over(TILE_SPECIAL_PILL, to_absolute_x(temp_pos.x), to_absolute_y(i), PALETTE_PILL);
+            }
+        }
     }
 }
 
 /**
- * Clear a cell on the screen by filling it with the background color (black).
- * @param pos The position of the cell to be cleared.
- */
-void clear_cell(Position pos) {
-    fill_cell(pos, COL_BLACK, RENDER_STYLE_FULL);
-}
-
-/**
- * Render a wall cell with a blue border style.
- * @param pos The position of the wall cell.
- */
-void render_wall(Position pos) {
-    fill_cell(pos, COL_BLUE, RENDER_STYLE_BORDER);
-}
-
-/**
- * Render a standard pill in a circular style with a defined reduction offset.
- * @param pos The position of the pill cell.
- */
-void render_pill(Position pos) {
-    fill_cell_with_offset(pos, STANDARD_PILL_REDUCTION, PILL_COLOR, RENDER_STYLE_CIRCLE);
-}
-
-/**
- * Render a special pill in a circular style with a smaller reduction offset.
- * @param pos The position of the special pill cell.
- */
-void render_special_pill(Position pos) {
-    fill_cell_with_offset(pos, SPECIAL_PILL_REDUCTION, PILL_COLOR, RENDER_STYLE_CIRCLE);
-}
-
-/**
- * Render the Pac-Man character at a specified position.
- * @param pos The position of the Pac-Man cell.
+ * Draw the part of the level's wall outline inside a rectangle of the maze.
+ * Each segment is one burst fill, clipped to the rectangle.
+ * @param left Left edge, in pixels from the maze's top-left corner.
+ * @param top Top edge.
+ * @param right Right edge (included).
+ * @param bottom Bottom edge (included).
  */
-void render_character(Position pos) {
-    fill_cell_with_offset(pos, PACMAN_REDUCTION, PACMAN_COLOR, RENDER_STYLE_PACMAN);
-}
+void render_outline(unsigned short left, unsigned short top, unsigned short right, unsigned short bottom) {
+    const LevelDescriptor* level = level_get(gameRunning.level);
+    const OutlineSegment* segment;
+    unsigned short xStart, yStart, xEnd, yEnd;
+    unsigned short i;
 
-void render_ghost(Position pos) {
-	fill_cell_with_offset(pos, GHOST_REDUCTION, GHOST_COLOR, RENDER_STYLE_GHOST);
+    for(i = 0; i < level->outlineCount; i++) {
+        segment = &level->outline[i];
+        xStart = segment->x;
+        yStart = segment->y;
+        xEnd = segment->vertical ? xStart : (xStart + segment->length - 1);
+        yEnd = segment->vertical ? (yStart + segment->length - 1) : yStart;
+        if(xStart > right || xEnd < left || yStart > bottom || yEnd < top) {
+            continue;
+        }
+        xStart = (xStart < left) ? left : xStart;
+        yStart = (yStart < top) ? top : yStart;
+        xEnd = (xEnd > right) ? right : xEnd;
+        yEnd = (yEnd > bottom) ? bottom : yEnd;
+        fill_line(GAME_MAP_START_X + xStart, GAME_MAP_START_Y + yStart, GAME_MAP_START_X + xEnd, GAME_MAP_START_Y + yEnd, palette_color(PALETTE_WALL));
+    }
 }
 
-/**
- * Render the ghost door with a solid style and a unique color.
- * @param pos The position of the ghost door cell.
- */
-void render_ghost_door(Position pos) {
-    fill_cell(pos, COL_GHOST_DOOR, RENDER_STYLE_FULL);
+/** Redraw a maze cell from the map, or show Pac-Man on it: the band renderer composes it at the next flush */
+void draw_cell(CellType cell_type, Position cell_pos) {
+    if(cell_type == CELL_PACMAN) {
+        render_character(cell_pos);
+        return;
+    }
+    band_draw_cell(cell_pos);
 }
 
 /**
- * Fill a cell with a given color and style.
- * This is a wrapper for `fill_cell_with_offset` with no reduction.
- * @param pos The position of the cell.
- * @param color The color to fill the cell with.
- * @param fillStyle The rendering style to use.
+ * Clear a cell on the screen by filling it with the background color (black).
+ * @param pos The position of the cell to be cleared.
  */
-void fill_cell(Position pos, unsigned short color, RenderStyle fillStyle) {
-    fill_cell_with_offset(pos, 0, color, fillStyle);
+void clear_cell(Position pos) {
+    fill_line(to_absolute_x(pos.x), to_absolute_y(pos.y), to_absolute_x(pos.x) + RENDER_CELL_OFFSET, to_absolute_y(pos.y) + RENDER_CELL_OFFSET, palette_color(PALETTE_BACKGROUND));
 }
 
 /**
- * Fill a cell with an offset for rendering styles.
- * Handles different styles like FULL, BORDER, CIRCLE, and PACMAN.
- * @param pos The position of the cell.
- * @param reduction The reduction offset to shrink the rendered area.
- * @param color The color to use for rendering.
- * @param fillStyle The rendering style to apply.
+ * Shift an actor's sprite back towards the cell it came from, by the part of the step it has not made yet.
+ * An actor that did not step to a neighbouring cell (blocked, turned round, teleported) is drawn on its cell.
+ * @param actor The actor of the sprite.
+ * @param previous The cell the actor left on its last step.
+ * @param current The cell of the actor.
+ * @param progress The actor's progress towards its next step (1/65536 of a tile).
  */
-void fill_cell_with_offset(Position pos, unsigned char reduction, unsigned short color, RenderStyle fillStyle) {
-    unsigned short x_screenStart = to_absolute_x(pos.x) + reduction;
-    unsigned short y_screenStart = to_absolute_y(pos.y) + reduction;
-    unsigned short x_screenEnd = x_screenStart + RENDER_CELL_OFFSET - (reduction * 2);
-    unsigned short y_screenEnd = y_screenStart + RENDER_CELL_OFFSET - (reduction * 2);
-
-    switch (fillStyle) {
-        case RENDER_STYLE_FULL:
-            fill_line(x_screenStart, y_screenStart, x_screenEnd, y_screenEnd, color);
-            break;
-        case RENDER_STYLE_BORDER:
-            draw_border(x_screenStart, y_screenStart, x_screenEnd, y_screenEnd, color);
-            break;
-        case RENDER_STYLE_CIRCLE:
-            render_circle(x_screenStart, y_screenStart, x_screenEnd, y_screenEnd, color);
-            break;
-        case RENDER_STYLE_PACMAN:
-            render_character_model(x_screenStart, y_screenStart, x_screenEnd, y_screenEnd, color, gameRunning.pacman.sprite.direction, gameRunning.pacman.sprite.animationFrame);
-            break;
-				case RENDER_STYLE_GHOST:
-						render_ghost_model(x_screenStart, y_screenStart, x_screenEnd, y_screenEnd, color, gameRunning.ghost.sprite.direction, gameRunning.ghost.sprite.animationFrame);
-						break;
+static void render_motion(ActorID actor, Position previous, Position current, unsigned short progress) {
+    const signed char dx = (signed char)(previous.x - current.x);
+    const signed char dy = (signed char)(previous.y - current.y);
+    signed char lag;
+
+    if (!GAME_CONFIG.smoothMotion || ((dx * dx + dy * dy) != 1)) {
+        band_offset_sprite(actor, 0, 0);
+        return;
     }
+    lag = (signed char)(TILE_SIZE - (((unsigned long)progress * TILE_SIZE) >> 16));   // 1 to TILE_SIZE pixels
+    band_offset_sprite(actor, dx * lag, dy * lag);
 }
 
 /**
- * Fill a rectangle defined by start and end coordinates with a color.
- * @param xStart Starting X-coordinate.
- * @param yStart Starting Y-coordinate.
- * @param xEnd Ending X-coordinate.
- * @param yEnd Ending Y-coordinate.
- * @param color The color to fill with.
+ * Show the Pac-Man sprite at a specified position, facing its direction.
+ * @param pos The position of the Pac-Man cell.
  */
-void fill_line(unsigned short xStart, unsigned short yStart, unsigned short xEnd, unsigned short yEnd, unsigned short color) {
-    unsigned short i;
-    const short lineWidth = ((yStart - yEnd) * -1) + 1;
+void render_character(Position pos) {
+    const Sprite* sprite = &gameRunning.pacman.sprite;
+    const TileID tile = TILE_PACMAN_FRAME(tile_facing(sprite->direction), sprite->animationFrame >= DURATION_FRAME);
 
-    for (i = 0; i < lineWidth; i++) {
-        LCD_DrawLine(xStart, (yStart + i), xEnd, (yStart + i), color);
-    }
+    band_show_sprite(ACTOR_PACMAN, pos, tile, PALETTE_PACMAN);
+    render_motion(ACTOR_PACMAN, sprite->prevPos, pos, sprite->progress);
 }
 
 /**
- * Draw a border around a rectangular area with the specified color.
- * @param xStart Starting X-coordinate.
- * @param yStart Starting Y-coordinate.
- * @param xEnd Ending X-coordinate.
- * @param yEnd Ending Y-coordinate.
- * @param color The color of the border.
+ * Show a ghost's sprite at its current position: its own color, the frightened color when frightened, only the eyes when eaten.
+ * @param ghost The ghost to render.
  */
-void draw_border(unsigned short xStart, unsigned short yStart, unsigned short xEnd, unsigned short yEnd, unsigned short color) {
-    unsigned short i;
-    const short lineWidth = ((yStart - yEnd) * -1) + 1;
-
-    i = 0;
-    LCD_DrawLine(xStart, (yStart + i), xEnd, (yStart + i), color);
-    while (i < lineWidth - 1) {
-        LCD_SetPoint(xStart, (yStart + i), color);
-        LCD_SetPoint(xEnd, (yStart + i), color);
-        i++;
+void draw_ghost(GhostID ghost) {
+    const Position pos = gameRunning.ghosts.currPos[ghost];
+    const Direction facing = tile_facing((Direction)gameRunning.ghosts.direction[ghost]);
+    const GhostMode mode = (GhostMode)gameRunning.ghosts.mode[ghost];
+
+    if (mode == GHOST_MODE_EATEN) {
+        // Only the eyes go back to the house
+        band_show_sprite(ACTOR_GHOST(ghost), pos, TILE_EYES_FACING(facing), PALETTE_EYES);
+    } else {
+        band_show_sprite(ACTOR_GHOST(ghost), pos, TILE_GHOST_FRAME(facing, gameRunning.ghosts.animationFrame[ghost] >= DURATION_FRAME),
+                         (mode == GHOST_MODE_FRIGHTENED) ? PALETTE_FRIGHTENED : PALETTE_GHOST(ghost));
     }
-    LCD_DrawLine(xStart, (yStart + i), xEnd, (yStart + i), color);
+    render_motion(ACTOR_GHOST(ghost), gameRunning.ghosts.prevPos[ghost], pos, gameRunning.ghosts.progress[ghost]);
 }
 
 /**
- * Render a circle within a rectangular area.
- * The circle is defined by the radius, calculated from the rectangle.
- * @param xStart Starting X-coordinate.
- * @param yStart Starting Y-coordinate.
- * @param xEnd Ending X-coordinate.
- * @param yEnd Ending Y-coordinate.
- * @param color The color of the circle.
+ * Slide every actor's sprite on by the progress of the last movement tick (smooth motion).
+ * Only the sprites move: the actors are still on their cells for the game.
  */
-void render_circle(unsigned short xStart, unsigned short yStart, unsigned short xEnd, unsigned short yEnd, unsigned short color) {
-    unsigned short i;
-    const short radius = ((xStart - xEnd) * -1) / 2;
-    unsigned char isEven = (radius % 2 == 0) ? 1 : 0;
+void draw_actors_motion() {
+    unsigned char ghost;
 
-    for (i = 0; i <= radius; i++) {
-        LCD_DrawLine(xStart + i, (yStart + radius - i), xEnd - i, (yStart + radius - i), color);
-        LCD_DrawLine(xStart + i, (yStart + radius + i + isEven), xEnd - i, (yStart + radius + i + isEven), color);
+    if (!GAME_CONFIG.smoothMotion) {
+        return;
     }
-}
-
-/**
- * Render a character model with orientation and animation.
- * Handles four directions: UP, DOWN, LEFT, and RIGHT.
- * @param xStart Starting X-coordinate.
- * @param yStart Starting Y-coordinate.
- * @param xEnd Ending X-coordinate.
- * @param yEnd Ending Y-coordinate.
- * @param color The color of the character.
- * @param orientation Direction the character is facing.
- * @param animationFrame Frame index for animation.
- */
-void render_character_model(unsigned short xStart, unsigned short yStart, unsigned short xEnd, unsigned short yEnd, unsigned short color, Direction orientation, unsigned char animationFrame) {
-    animationFrame = (animationFrame >= DURATION_FRAME);
-
-    switch (orientation) {
-        case DIRECTION_STILL:
-        case DIRECTION_RIGHT:
-            render_character_right(xStart, yStart, xEnd, yEnd, animationFrame, color);
-            break;
-        case DIRECTION_LEFT:
-            render_character_left(xStart, yStart, xEnd, yEnd, animationFrame, color);
-            break;
-        case DIRECTION_UP:
-            render_character_up(xStart, yStart, xEnd, yEnd, animationFrame, color);
-            break;
-        case DIRECTION_DOWN:
-            render_character_down(xStart, yStart, xEnd, yEnd, animationFrame, color);
-            break;
+    render_motion(ACTOR_PACMAN, gameRunning.pacman.sprite.prevPos, gameRunning.pacman.sprite.currPos, gameRunning.pacman.sprite.progress);
+    for (ghost = 0; ghost < GHOST_COUNT; ghost++) {
+        render_motion(ACTOR_GHOST(ghost), gameRunning.ghosts.prevPos[ghost], gameRunning.ghosts.currPos[ghost], gameRunning.ghosts.progress[ghost]);
     }
 }
 
 /**
- * Render Pac-Man facing right.
- * The appearance changes depending on the animation frame.
- * @param xStart Starting X-coordinate.
- * @param yStart Starting Y-coordinate.
- * @param xEnd Ending X-coordinate.
- * @param yEnd Ending Y-coordinate.
- * @param frame Current animation frame (0 or 1).
- * @param color Color used for rendering.
+ * Direction of the tile of an actor: a still actor is drawn facing right.
+ * @param direction Direction of the actor.
+ * @return The direction of the tile to draw.
  */
-void render_character_right(unsigned short xStart, unsigned short yStart, unsigned short xEnd, unsigned short yEnd, unsigned char frame, unsigned short color) {
-    if (frame == 0) { // First animation frame
-        LCD_DrawLine(xStart + 1, yStart + 0, xEnd - 1, yStart + 0, color);
-        LCD_DrawLine(xStart + 0, yStart + 1, xEnd - 2, yStart + 1, color);
-        LCD_DrawLine(xStart + 0, yStart + 2, xEnd - 3, yStart + 2, color);
-        LCD_DrawLine(xStart + 0, yStart + 3, xEnd - 4, yStart + 3, color);
-        LCD_DrawLine(xStart + 0, yStart + 4, xEnd - 3, yStart + 4, color);
-        LCD_DrawLine(xStart + 0, yStart + 5, xEnd - 2, yStart + 5, color);
-        LCD_DrawLine(xStart + 1, yStart + 6, xEnd - 1, yStart + 6, color);
-    } else { // Second animation frame
-        LCD_DrawLine(xStart + 1, yStart + 0, xEnd - 1, yStart + 0, color);
-        LCD_DrawLine(xStart + 0, yStart + 1, xEnd - 1, yStart + 1, color);
-        LCD_DrawLine(xStart + 0, yStart + 2, xEnd - 2, yStart + 2, color);
-        LCD_DrawLine(xStart + 0, yStart + 3, xEnd - 3, yStart + 3, color);
-        LCD_DrawLine(xStart + 0, yStart + 4, xEnd - 2, yStart + 4, color);
-        LCD_DrawLine(xStart + 0, yStart + 5, xEnd - 1, yStart + 5, color);
-        LCD_DrawLine(xStart + 1, yStart + 6, xEnd - 1, yStart + 6, color);
-    }
+Direction tile_facing(Direction direction) {
+    return (direction == DIRECTION_STILL) ? DIRECTION_RIGHT : direction;
 }
 
 /**
- * Render Pac-Man facing left.
- * The appearance changes depending on the animation frame.
- * @param xStart Starting X-coordinate.
- * @param yStart Starting Y-coordinate.
- * @param xEnd Ending X-coordinate.
- * @param yEnd Ending Y-coordinate.
- * @param frame Current animation frame (0 or 1).
- * @param color Color used for rendering.
+ * Render the ghost door as a bar between the two outline lines of the house wall.
+ * @param pos The position of the ghost door cell.
  */
-void render_character_left(unsigned short xStart, unsigned short yStart, unsigned short xEnd, unsigned short yEnd, unsigned char frame, unsigned short color) {
-    if (frame == 0) { // First animation frame
-        LCD_DrawLine(xStart + 1, yStart + 0, xEnd - 1, yStart + 0, color);
-        LCD_DrawLine(xStart + 2, yStart + 1, xEnd - 0, yStart + 1, color);
-        LCD_DrawLine(xStart + 3, yStart + 2, xEnd - 0, yStart + 2, color);
-        LCD_DrawLine(xStart + 4, yStart + 3, xEnd - 0, yStart + 3, color);
-        LCD_DrawLine(xStart + 3, yStart + 4, xEnd - 0, yStart + 4, color);
-        LCD_DrawLine(xStart + 2, yStart + 5, xEnd - 0, yStart + 5, color);
-        LCD_DrawLine(xStart + 1, yStart + 6, xEnd - 1, yStart + 6, color);
-    } else { // Second animation frame
-        LCD_DrawLine(xStart + 1, yStart + 0, xEnd - 1, yStart + 0, color);
-        LCD_DrawLine(xStart + 1, yStart + 1, xEnd - 0, yStart + 1, color);
-        LCD_DrawLine(xStart + 2, yStart + 2, xEnd - 0, yStart + 2, color);
-        LCD_DrawLine(xStart + 3, yStart + 3, xEnd - 0, yStart + 3, color);
-        LCD_DrawLine(xStart + 2, yStart + 4, xEnd - 0, yStart + 4, color);
-        LCD_DrawLine(xStart + 1, yStart + 5, xEnd - 0, yStart + 5, color);
-        LCD_DrawLine(xStart + 1, yStart + 6, xEnd - 1, yStart + 6, color);
-    }
-}
+void render_ghost_door(Position pos) {
+    const unsigned short x_screenStart = to_absolute_x(pos.x);
+    const unsigned short y_screenStart = to_absolute_y(pos.y);
 
-/**
- * Render Pac-Man facing up.
- * The appearance changes depending on the animation frame.
- * @param xStart Starting X-coordinate.
- * @param yStart Starting Y-coordinate.
- * @param xEnd Ending X-coordinate.
- * @param yEnd Ending Y-coordinate.
- * @param frame Current animation frame (0 or 1).
- * @param color Color used for rendering.
- */
-void render_character_up(unsigned short xStart, unsigned short yStart, unsigned short xEnd, unsigned short yEnd, unsigned char frame, unsigned short color) {
-    if (frame == 0) { // First animation frame
-        LCD_SetPoint(xStart, yStart + 1, COL_YELLOW);
-        LCD_SetPoint(xEnd, yStart + 1, COL_YELLOW);
-        LCD_DrawLine(xStart + 0, yStart + 2, xStart + 1, yStart + 2, color);
-        LCD_DrawLine(xEnd - 0, yStart + 2, xEnd - 1, yStart + 2, color);
-        LCD_DrawLine(xStart + 0, yStart + 3, xStart + 2, yStart + 3, color);
-        LCD_DrawLine(xEnd - 0, yStart + 3, xEnd - 2, yStart + 3, color);
-        LCD_DrawLine(xStart + 0, yStart + 4, xEnd - 0, yStart + 4, color);
-        LCD_DrawLine(xStart + 0, yStart + 5, xEnd - 0, yStart + 5, color);
-        LCD_DrawLine(xStart + 1, yStart + 6, xEnd - 1, yStart + 6, color);
-    } else { // Second animation frame
-        LCD_DrawLine(xStart + 0, yStart + 1, xStart + 1, yStart + 1, color);
-        LCD_DrawLine(xEnd - 0, yStart + 1, xEnd - 1, yStart + 1, color);
-        LCD_DrawLine(xStart + 0, yStart + 2, xStart + 2, yStart + 2, color);
-        LCD_DrawLine(xEnd - 0, yStart + 2, xEnd - 2, yStart + 2, color);
-        LCD_DrawLine(xStart + 0, yStart + 3, xEnd - 0, yStart + 3, color);
-        LCD_DrawLine(xStart + 0, yStart + 4, xEnd - 0, yStart + 4, color);
-        LCD_DrawLine(xStart + 0, yStart + 5, xEnd - 0, yStart + 5, color);
-        LCD_DrawLine(xStart + 1, yStart + 6, xEnd - 1, yStart + 6, color);
-    }
+    clear_cell(pos);
+    fill_line(x_screenStart, y_screenStart + LEVEL_OUTLINE_INSET + 1, x_screenStart + RENDER_CELL_OFFSET, y_screenStart + RENDER_CELL_OFFSET - LEVEL_OUTLINE_INSET - 1, palette_color(PALETTE_DOOR));
 }
 
 /**
- * Render Pac-Man facing down.
- * The appearance changes depending on the animation frame.
+ * Fill a rectangle defined by start and end coordinates with a color.
  * @param xStart Starting X-coordinate.
  * @param yStart Starting Y-coordinate.
  * @param xEnd Ending X-coordinate.
  * @param yEnd Ending Y-coordinate.
- * @param frame Current animation frame (0 or 1).
- * @param color Color used for rendering.
+ * @param color The color to fill with.
  */
-void render_character_down(unsigned short xStart, unsigned short yStart, unsigned short xEnd, unsigned short yEnd, unsigned char frame, unsigned short color) {
-	
-	if (frame == 0) { // First animation frame
-				LCD_DrawLine(xStart+1, yStart+0, xEnd-1, yStart+0, color);
-				LCD_DrawLine(xStart+0, yStart+1, xEnd-0, yStart+1, color);
-				LCD_DrawLine(xStart+0, yStart+2, xEnd-0, yStart+2, color);
-				LCD_DrawLine(xStart+0, yStart+3, xStart+2, yStart+3, color);
-				LCD_DrawLine(xEnd-0, yStart+3, xEnd-2, yStart+3, color);
-				LCD_DrawLine(xStart+0, yStart+4, xStart+1, yStart+4, color);
-				LCD_DrawLine(xEnd-0, yStart+4, xEnd-1, yStart+4, color);
-				LCD_SetPoint(xStart, yStart+5, COL_YELLOW);
-				LCD_SetPoint(xEnd, yStart+5, COL_YELLOW);
-	} else { // Second animation frame
-				LCD_DrawLine(xStart+1, yStart+0, xEnd-1, yStart+0, color);
-				LCD_DrawLine(xStart+0, yStart+1, xEnd-0, yStart+1, color);
-				LCD_DrawLine(xStart+0, yStart+2, xEnd-0, yStart+2, color);
-				LCD_DrawLine(xStart+0, yStart+3, xEnd-0, yStart+3, color);
-				LCD_DrawLine(xStart+0, yStart+4, xStart+2, yStart+4, color);
-				LCD_DrawLine(xEnd-0, yStart+4, xEnd-2, yStart+4, color);
-				LCD_DrawLine(xStart+0, yStart+5, xStart+1, yStart+5, color);
-				LCD_DrawLine(xEnd-0, yStart+5, xEnd-1, yStart+5, color);
-	}
-	
-}
-
-void render_ghost_model(unsigned short xStart, unsigned short yStart, unsigned short xEnd, unsigned short yEnd, unsigned short color, Direction orientation, unsigned char animationFrame) {
-    // Determine the body and eye colors based on the ghost's vulnerability
-    const unsigned short colorBody = (gameRunning.ghost.status.isVulnerable) ? COL_BLUE : color;
-    const unsigned short colorEyes = (gameRunning.ghost.status.isVulnerable) ? COL_PINK : COL_CYAN;
-
-    // Adjust animation frame duration for better visibility
-    animationFrame = (animationFrame >= 2); // A frame lasts 2 ticks to make the animation more visible, especially on physical board
-
-    // Render the main body of the ghost
-    render_ghost_body(xStart, yStart, xEnd, yEnd, colorBody);
-
-    // Render the lower body with animation effect
-    render_ghost_lower_body(xStart, yStart, xEnd, yEnd, colorBody, animationFrame);
-
-    // Render the eyes of the ghost
-    render_ghost_eyes(xStart, yStart, colorEyes, animationFrame, orientation);
-}
-
-// Renders the main body of the ghost
-void render_ghost_body(unsigned short xStart, unsigned short yStart, unsigned short xEnd, unsigned short yEnd, unsigned short colorBody) {
-    // Top of the ghost body
-    LCD_DrawLine(xStart + 1, yStart + 0, xEnd - 1, yStart + 0, colorBody);
-    
-    // Body rows
-    LCD_SetPoint(xStart + 0, yStart + 1, colorBody);
-    LCD_SetPoint(xStart + 3, yStart + 1, colorBody);
-    LCD_SetPoint(xStart + 6, yStart + 1, colorBody);
-    
-    LCD_SetPoint(xStart + 0, yStart + 2, colorBody);
-    LCD_SetPoint(xStart + 3, yStart + 2, colorBody);
-    LCD_SetPoint(xStart + 6, yStart + 2, colorBody);
-    
-    // Bottom of the ghost body
-    LCD_DrawLine(xStart + 0, yStart + 3, xEnd - 0, yStart + 3, colorBody);
-    LCD_DrawLine(xStart + 0, yStart + 4, xEnd - 0, yStart + 4, colorBody);
-}
-
-// Renders the lower part of the ghost body, applying animation effect
-void render_ghost_lower_body(unsigned short xStart, unsigned short yStart, unsigned short xEnd, unsigned short yEnd, unsigned short colorBody, unsigned char animationFrame) {
-    if (animationFrame == 0) {
-        LCD_SetPoint(xStart + 0, yStart + 5, colorBody);
-        LCD_DrawLine(xStart + 2, yStart + 5, xEnd - 2, yStart + 5, colorBody);
-        LCD_SetPoint(xEnd - 0, yStart + 5, colorBody);
-        
-        LCD_SetPoint(xStart + 0, yStart + 6, colorBody);
-        LCD_SetPoint(xStart + 2, yStart + 6, colorBody);
-        LCD_SetPoint(xEnd - 2, yStart + 6, colorBody);
-        LCD_SetPoint(xEnd - 0, yStart + 6, colorBody);
-    } else if (animationFrame == 1) {
-        LCD_DrawLine(xStart + 0, yStart + 5, xStart + 2, yStart + 5, colorBody);
-        LCD_DrawLine(xEnd - 2, yStart + 5, xEnd - 0, yStart + 5, colorBody);
-        
-        LCD_SetPoint(xStart + 0, yStart + 6, colorBody);
-        LCD_SetPoint(xStart + 2, yStart + 6, colorBody);
-        LCD_SetPoint(xEnd - 2, yStart + 6, colorBody);
-        LCD_SetPoint(xEnd - 0, yStart + 6, colorBody);
-    }
-}
-
-// Renders the eyes of the ghost based on the ghost's orientation and animation frame
-void render_ghost_eyes(unsigned short xStart, unsigned short yStart, unsigned short colorEyes, unsigned char animationFrame, Direction orientation) {
-    // Draw the basic eye shapes (white eyes)
-    LCD_DrawLine(xStart + 1, yStart + 1, xStart + 2, yStart + 1, COL_WHITE);
-    LCD_DrawLine(xStart + 4, yStart + 1, xStart + 5, yStart + 1, COL_WHITE);
-    LCD_DrawLine(xStart + 1, yStart + 2, xStart + 2, yStart + 2, COL_WHITE);
-    LCD_DrawLine(xStart + 4, yStart + 2, xStart + 5, yStart + 2, COL_WHITE);
-
-    // Draw pupils (black pixels) and adjust position based on orientation and animation frame
-    switch (orientation) {
-        case DIRECTION_STILL:
-        case DIRECTION_RIGHT:
-            // Pupils slightly to the right
-            LCD_SetPoint(xStart + 2, yStart + animationFrame + 1, colorEyes); // Blue pixel (iris)
-            LCD_SetPoint(xStart + 2, yStart + animationFrame + 1, COL_BLACK); // Black pixel (pupil)
-            LCD_SetPoint(xStart + 5, yStart + animationFrame + 1, colorEyes); // Blue pixel (iris)
-            LCD_SetPoint(xStart + 5, yStart + animationFrame + 1, COL_BLACK); // Black pixel (pupil)
-            break;
-        case DIRECTION_LEFT:
-            // Pupils slightly to the left
-            LCD_SetPoint(xStart + 1, yStart + animationFrame + 1, colorEyes); // Blue pixel (iris)
-            LCD_SetPoint(xStart + 1, yStart + animationFrame + 1, COL_BLACK); // Black pixel (pupil)
-            LCD_SetPoint(xStart + 4, yStart + animationFrame + 1, colorEyes); // Blue pixel (iris)
-            LCD_SetPoint(xStart + 4, yStart + animationFrame + 1, COL_BLACK); // Black pixel (pupil)
-            break;
-        case DIRECTION_UP:
-            // Pupils shifted upward
-            LCD_SetPoint(xStart + 1 + animationFrame, yStart + 1, colorEyes); // Blue pixel (iris)
-            LCD_SetPoint(xStart + 1 + animationFrame, yStart + 1, COL_BLACK); // Black pixel (pupil)
-            LCD_SetPoint(xStart + 4 + animationFrame, yStart + 1, colorEyes); // Blue pixel (iris)
-            LCD_SetPoint(xStart + 4 + animationFrame, yStart + 1, COL_BLACK); // Black pixel (pupil)
-            break;
-        case DIRECTION_DOWN:
-            // Pupils shifted downward
-            LCD_SetPoint(xStart + 1 + animationFrame, yStart + 2, colorEyes); // Blue pixel (iris)
-            LCD_SetPoint(xStart + 1 + animationFrame, yStart + 2, COL_BLACK); // Black pixel (pupil)
-            LCD_SetPoint(xStart + 4 + animationFrame, yStart + 2, colorEyes); // Blue pixel (iris)
-            LCD_SetPoint(xStart + 4 + animationFrame, yStart + 2, COL_BLACK); // Black pixel (pupil)
-            break;
-    }
+void fill_line(unsigned short xStart, unsigned short yStart, unsigned short xEnd, unsigned short yEnd, unsigned short color) {
+    band_flush();   // The cells still pending must not land over what is drawn now
+    band_forget(xStart, yStart, xEnd, yEnd);
+    LCD_FillRectAsync(xStart, yStart, xEnd, yEnd, color, 0);   // Large fills run by GPDMA until the next LCD call
 }
 
-
 /**
  * Render text on the screen at the specified coordinates with a given foreground and background color.
  * @param xStart Starting X-coordinate.
@@ -613,6 +295,8 @@ void render_ghost_eyes(unsigned short xStart, unsigned short yStart, unsigned sh
  * @param colorBackground Background color of the text.
  */
 void render_text(unsigned short xStart, unsigned short yStart, char* string, unsigned short color, unsigned short colorBackground) {
+    band_flush();
+    band_forget(xStart, yStart, xStart + strlen(string) * RENDER_CHAR_WIDTH_PIXELS - 1, yStart + RENDER_CHAR_HEIGHT_PIXELS - 1);
     GUI_Text(xStart, yStart, (uint8_t*) string, color, colorBackground);
 }
 
@@ -24,17 +24,19 @@
 
 #define DURATION_FRAME 2
 
+#define BANNER_START_Y (DISPLAY_CENTER_Y - 8)   // Screen rows of the full-width text banners
+#define BANNER_END_Y   (DISPLAY_CENTER_Y + 7)
+
 void draw_area_stat();
 void draw_game_map();
-void draw_time_stat(unsigned char timeValue);
-void draw_stat_score(unsigned short scoreValue);
-void draw_status_lives(unsigned char livesValue);
+void draw_game_map_lines(unsigned short yStart, unsigned short yEnd);
 void draw_pause_screen();
-void undraw_pause_screen();
-void redraw_after_pause();
+void clear_banner_margins(unsigned short yStart, unsigned short yEnd);
 void draw_screen_victory();
 void draw_screen_game_over();
 void draw_screen_failure();
 void draw_cell(CellType cell_type, Position pos);
+void draw_ghost(GhostID ghost);
+void draw_actors_motion();
 
 #endif //__GAME_RENDERER_H
@@ -0,0 +1,156 @@
+#include "game_replay.h"
+#include "../../CAN/CAN.h"
+
+#define REPLAY_RECORD_MAX_SIZE 6   // Record byte plus a 32-bit varint
+
+static unsigned char ring[REPLAY_BUFFER_SIZE];
+static unsigned int ringHead = 0;        // Bytes written since the start (free running)
+static unsigned int ringTail = 0;        // Bytes read since the start (free running)
+static unsigned int lastTick = 0;        // Tick of the previous record
+static unsigned char overflow = 0;       // A record did not fit: the rest of the stream is lost
+
+// Append bytes to the ring, all or nothing
+static unsigned char ring_write(const unsigned char* bytes, unsigned int count) {
+    unsigned int i;
+
+    if (overflow || (REPLAY_BUFFER_SIZE - (ringHead - ringTail) < count)) {
+        overflow = 1;
+        return 0;
+    }
+    for (i = 0; i < count; i++) {
+        ring[(ringHead + i) & REPLAY_BUFFER_MASK] = bytes[i];
+    }
+    ringHead += count;
+    return 1;
+}
+
+/**
+ * @brief Clears the ring and starts a new stream with its header.
+ */
+void replay_start_recording(unsigned short seed) {
+    const unsigned char header[REPLAY_HEADER_SIZE] = {REPLAY_FORMAT_VERSION, (seed >> 8) & 0xFF, seed & 0xFF};
+
+    ringHead = 0;
+    ringTail = 0;
+    lastTick = 0;
+    overflow = 0;
+    ring_write(header, REPLAY_HEADER_SIZE);
+}
+
+/**
+ * @brief Appends an input applied at the given movement tick.
+ *
+ * Ticks must not decrease between two records.
+ */
+void replay_record(unsigned int tick, ReplayInput input) {
+    unsigned char record[REPLAY_RECORD_MAX_SIZE];
+    unsigned char size = 1;
+    unsigned int delta = tick - lastTick;
+
+    if (delta < REPLAY_DELTA_ESCAPE) {
+        record[0] = (input << 5) | delta;
+    } else {
+        record[0] = (input << 5) | REPLAY_DELTA_ESCAPE;
+        delta -= REPLAY_DELTA_ESCAPE;
+        while (delta >= 0x80) {
+            record[size++] = (delta & 0x7F) | 0x80;
+            delta >>= 7;
+        }
+        record[size++] = delta;
+    }
+
+    if (ring_write(record, size)) {
+        lastTick = tick;
+    }
+}
+
+// Bytes recorded and not read yet
+unsigned int replay_pending_bytes(void) {
+    return ringHead - ringTail;
+}
+
+/**
+ * @brief Takes the oldest recorded bytes out of the ring.
+ *
+ * @return Number of bytes copied (at most size).
+ */
+unsigned int replay_read(unsigned char* buffer, unsigned int size) {
+    unsigned int count = 0;
+
+    while ((count < size) && (ringTail != ringHead)) {
+        buffer[count++] = ring[ringTail & REPLAY_BUFFER_MASK];
+        ringTail++;
+    }
+    return count;
+}
+
+unsigned char replay_overflowed(void) {
+    return overflow;
+}
+
+/**
+ * @brief Sends every pending byte of the stream, up to 8 per frame (ID REPLAY_CAN_ID).
+ */
+void replay_export_can(uint32_t ctrl) {
+    CAN_msg msg;
+
+    msg.id = REPLAY_CAN_ID;
+    msg.format = STANDARD_FORMAT;
+    msg.type = DATA_FRAME;
+
+    while (replay_pending_bytes()) {
+        msg.len = replay_read(msg.data, sizeof(msg.data));
+        CAN_waitReady(ctrl);   // CAN_wrMsg drops the frame while the buffer is busy
+        CAN_wrMsg(ctrl, &msg);
+    }
+}
+
+/**
+ * @brief Checks the header of a recorded stream and positions a reader on its first record.
+ *
+ * @return 1 if the stream can be played back, 0 otherwise.
+ */
+unsigned char replay_reader_open(ReplayReader* reader, const unsigned char* data, unsigned int length, unsigned short* seed) {
+    if ((length < REPLAY_HEADER_SIZE) || (data[0] != REPLAY_FORMAT_VERSION)) {
+        return 0;
+    }
+    *seed = (data[1] << 8) | data[2];
+    reader->data = data;
+    reader->length = length;
+    reader->offset = REPLAY_HEADER_SIZE;
+    reader->tick = 0;
+    return 1;
+}
+
+/**
+ * @brief Decodes the next record of a stream.
+ *
+ * @return 1 if a record was read, 0 at the end of the stream (or on a truncated record).
+ */
+unsigned char replay_reader_next(ReplayReader* reader, unsigned int* tick, ReplayInput* input) {
+    unsigned int delta;
+    unsigned char shift = 0;
+    unsigned char byte;
+
+    if (reader->offset >= reader->length) {
+        return 0;
+    }
+    byte = reader->data[reader->offset++];
+    *input = (ReplayInput)(byte >> 5);
+    delta = byte & REPLAY_DELTA_ESCAPE;
+
+    if (delta == REPLAY_DELTA_ESCAPE) {
+        do {
+            if (reader->offset >= reader->length) {
+                return 0;
+            }
+            byte = reader->data[reader->offset++];
+            delta += (unsigned int)(byte & 0x7F) << shift;
+            shift += 7;
+        } while (byte & 0x80);
+    }
+
+    reader->tick += delta;
+    *tick = reader->tick;
+    return 1;
+}
@@ -0,0 +1,64 @@
+#ifndef __GAME_REPLAY_H
+#define __GAME_REPLAY_H
+
+#include "game_engine.h"
+
+/*
+ * Deterministic replay recording.
+ *
+ * A game is fully determined by the seed of its random stream and by the
+ * inputs, each applied at a known movement tick (see game_controller.c):
+ * joystick directions are latched by the RIT and taken at the next tick,
+ * pause presses are stamped with the tick they happened before. The
+ * recorder writes the seed once, then one delta-encoded record per input
+ * change into a RAM ring; on the board a low priority task drains the ring
+ * over CAN (frames REPLAY_CAN_ID, payloads in stream order).
+ *
+ * Stream layout:
+ *   header  [0] REPLAY_FORMAT_VERSION, [1..2] seed (big-endian)
+ *   record  one byte: input in bits 7..5, ticks since the previous record
+ *           in bits 4..0; the value REPLAY_DELTA_ESCAPE in bits 4..0 means
+ *           the delta minus REPLAY_DELTA_ESCAPE follows as a little-endian
+ *           base-128 varint (bit 7 set on every byte but the last)
+ *
+ * With 20 ms ticks an input change costs one byte within 0.6 s of the
+ * previous one, two bytes within 3 s and three within 5 minutes.
+ * host/host_replay_player.c plays a stream back.
+ */
+
+#define REPLAY_FORMAT_VERSION   1
+#define REPLAY_HEADER_SIZE      3
+#define REPLAY_BUFFER_SIZE      512      // Ring bytes (power of two)
+#define REPLAY_BUFFER_MASK      (REPLAY_BUFFER_SIZE - 1)
+#define REPLAY_DELTA_ESCAPE     31       // Delta field value announcing a varint
+#define REPLAY_CAN_ID           0x120    // CAN export: consecutive stream bytes, up to 8 per frame
+
+// Recorded inputs (directions keep their Direction value)
+typedef enum {
+    REPLAY_INPUT_NONE  = DIRECTION_STILL,
+    REPLAY_INPUT_RIGHT = DIRECTION_RIGHT,
+    REPLAY_INPUT_LEFT  = DIRECTION_LEFT,
+    REPLAY_INPUT_UP    = DIRECTION_UP,
+    REPLAY_INPUT_DOWN  = DIRECTION_DOWN,
+    REPLAY_INPUT_PAUSE = 5               // Pause button (also resumes after a lost life)
+} ReplayInput;
+
+// Cursor over a recorded stream
+typedef struct {
+    const unsigned char* data;
+    unsigned int length;
+    unsigned int offset;
+    unsigned int tick;                   // Tick of the last record read
+} ReplayReader;
+
+void replay_start_recording(unsigned short seed);
+void replay_record(unsigned int tick, ReplayInput input);
+unsigned int replay_pending_bytes(void);
+unsigned int replay_read(unsigned char* buffer, unsigned int size);
+unsigned char replay_overflowed(void);
+void replay_export_can(uint32_t ctrl);
+
+unsigned char replay_reader_open(ReplayReader* reader, const unsigned char* data, unsigned int length, unsigned short* seed);
+unsigned char replay_reader_next(ReplayReader* reader, unsigned int* tick, ReplayInput* input);
+
+#endif /* __GAME_REPLAY_H */
@@ -0,0 +1,292 @@
+#include "game_snapshot.h"
+
+#define POSITION_BITS        5     // Per coordinate (the maze is 28x31)
+#define DIRECTION_BITS       3
+#define ANIMATION_BITS       2
+#define GHOST_MODE_BITS      3
+#define WAVE_INDEX_BITS      4
+#define PILL_CELL_BITS       2
+
+/* Pill cell codes */
+#define PILL_CELL_EATEN      0
+#define PILL_CELL_STANDARD   1
+#define PILL_CELL_SPECIAL    2
+
+// Bit cursor over a blob (MSB first)
+typedef struct {
+    unsigned char* data;
+    unsigned int bitCount;     // Bits available
+    unsigned int bit;          // Next bit
+    unsigned char overflow;    // A field did not fit
+} BitCursor;
+
+static void bits_put(BitCursor* cursor, unsigned int value, unsigned char width);
+static unsigned int bits_get(BitCursor* cursor, unsigned char width);
+static void put_position(BitCursor* cursor, Position position);
+static unsigned char get_position(BitCursor* cursor, Position* position);
+static unsigned short crc16_ccitt(const unsigned char* data, unsigned int length);
+
+/**
+ * @brief Packs a snapshot into a blob.
+ *
+ * @return Size of the blob, 0 if it does not fit in size bytes.
+ */
+unsigned int snapshot_encode(const GameSnapshot* snapshot, unsigned char* buffer, unsigned int size) {
+    const GameRunning* running = &snapshot->running;
+    const GhostTable* ghosts = &running->ghosts;
+    const LevelDescriptor* level = level_get(running->level);
+    const LevelRowTables* row;
+    BitCursor cursor;
+    Position position;
+    unsigned int length;
+    unsigned short crc;
+    unsigned char ghost;
+    unsigned char cell;
+    unsigned char pill;
+    unsigned char id;
+
+    if (size < SNAPSHOT_HEADER_SIZE + SNAPSHOT_CRC_SIZE) {
+        return 0;
+    }
+    cursor.data = &buffer[SNAPSHOT_HEADER_SIZE];
+    cursor.bitCount = (size - SNAPSHOT_HEADER_SIZE - SNAPSHOT_CRC_SIZE) * 8;
+    cursor.bit = 0;
+    cursor.overflow = 0;
+
+    // Game statistics
+    bits_put(&cursor, running->level, 8);
+    bits_put(&cursor, running->remainingTime, 8);
+    bits_put(&cursor, running->remainingLives, 8);
+    bits_put(&cursor, running->score, 16);
+    bits_put(&cursor, snapshot->specialPillsGenerated, 8);
+
+    // Pac-Man
+    put_position(&cursor, running->pacman.sprite.currPos);
+    put_position(&cursor, running->pacman.sprite.prevPos);
+    bits_put(&cursor, running->pacman.sprite.direction, DIRECTION_BITS);
+    bits_put(&cursor, running->pacman.sprite.animationFrame, ANIMATION_BITS);
+    bits_put(&cursor, running->pacman.sprite.progress, 16);
+
+    // Ghost table and mode machine
+    for (ghost = 0; ghost < GHOST_COUNT; ghost++) {
+        put_position(&cursor, ghosts->currPos[ghost]);
+        put_position(&cursor, ghosts->prevPos[ghost]);
+        bits_put(&cursor, ghosts->direction[ghost], DIRECTION_BITS);
+        bits_put(&cursor, ghosts->animationFrame[ghost], ANIMATION_BITS);
+        bits_put(&cursor, ghosts->progress[ghost], 16);
+        bits_put(&cursor, ghosts->mode[ghost], GHOST_MODE_BITS);
+        bits_put(&cursor, ghosts->currentSpeed[ghost], 8);
+        bits_put(&cursor, ghosts->timer[ghost], 16);
+    }
+    bits_put(&cursor, snapshot->ghostModes.waveIndex, WAVE_INDEX_BITS);
+    bits_put(&cursor, snapshot->ghostModes.waveMode, GHOST_MODE_BITS);
+    bits_put(&cursor, snapshot->ghostModes.waveTicks, 16);
+    bits_put(&cursor, snapshot->ghostModes.frightenedTicks, 16);
+    bits_put(&cursor, snapshot->ghostModes.frightenedRandom, 16);
+
+    // Controller
+    bits_put(&cursor, snapshot->movementTicks, 32);
+    bits_put(&cursor, snapshot->gameRandom, 16);
+    bits_put(&cursor, snapshot->lifeIncreases, 8);
+    bits_put(&cursor, snapshot->pendingDirection, DIRECTION_BITS);
+    for (id = 0; id < SNAPSHOT_EVENT_COUNT; id++) {
+        bits_put(&cursor, snapshot->eventDelays[id], 16);
+    }
+
+    // Pills left in the maze (every other cell never changes), in the order of the level's pill columns
+    for (position.y = 0; position.y < GAME_MAP_HEIGHT; position.y++) {
+        row = level_row_tables(level, position.y);
+        for (pill = 0; pill < row->pillCount; pill++) {
+            position.x = LEVEL_PILL_COLUMNS[row->firstPill + pill];
+            cell = running->gameMap[position.y][position.x];
+            bits_put(&cursor, (cell == CELL_STANDARD_PILL) ? PILL_CELL_STANDARD :
+                              ((cell == CELL_SPECIAL_PILL) ? PILL_CELL_SPECIAL : PILL_CELL_EATEN), PILL_CELL_BITS);
+        }
+    }
+
+    length = SNAPSHOT_HEADER_SIZE + (cursor.bit + 7) / 8 + SNAPSHOT_CRC_SIZE;
+    if (cursor.overflow || (length > 0xFF)) {
+        return 0;
+    }
+    buffer[0] = SNAPSHOT_MAGIC;
+    buffer[1] = SNAPSHOT_FORMAT_VERSION;
+    buffer[2] = length;
+    crc = crc16_ccitt(buffer, length - SNAPSHOT_CRC_SIZE);
+    buffer[length - 2] = (crc >> 8) & 0xFF;
+    buffer[length - 1] = crc & 0xFF;
+    return length;
+}
+
+/**
+ * @brief Unpacks and checks a blob.
+ *
+ * The blob may be followed by unrelated bytes (its size is in the header).
+ * The snapshot is only complete when 1 is returned.
+ *
+ * @return 1 if the blob is a valid snapshot of this format, 0 otherwise.
+ */
+unsigned char snapshot_decode(const unsigned char* data, unsigned int length, GameSnapshot* snapshot) {
+    GameRunning* running = &snapshot->running;
+    GhostTable* ghosts = &running->ghosts;
+    const LevelRowTables* row;
+    BitCursor cursor;
+    Position position;
+    unsigned char valid = 1;
+    unsigned char ghost;
+    unsigned char code;
+    unsigned char pill;
+    unsigned char id;
+
+    if ((length < SNAPSHOT_HEADER_SIZE + SNAPSHOT_CRC_SIZE) ||
+        (data[0] != SNAPSHOT_MAGIC) || (data[1] != SNAPSHOT_FORMAT_VERSION) ||
+        (data[2] < SNAPSHOT_HEADER_SIZE + SNAPSHOT_CRC_SIZE) || (data[2] > length)) {
+        return 0;
+    }
+    length = data[2];
+    if (crc16_ccitt(data, length - SNAPSHOT_CRC_SIZE) != ((data[length - 2] << 8) | data[length - 1])) {
+        return 0;
+    }
+    cursor.data = (unsigned char*)&data[SNAPSHOT_HEADER_SIZE];
+    cursor.bitCount = (length - SNAPSHOT_HEADER_SIZE - SNAPSHOT_CRC_SIZE) * 8;
+    cursor.bit = 0;
+    cursor.overflow = 0;
+
+    // Game statistics
+    running->level = bits_get(&cursor, 8);
+    running->remainingTime = bits_get(&cursor, 8);
+    running->remainingLives = bits_get(&cursor, 8);
+    running->score = bits_get(&cursor, 16);
+    snapshot->specialPillsGenerated = bits_get(&cursor, 8);
+    valid &= (running->level >= 1) && (running->level <= LEVEL_PACK_COUNT) &&
+             (running->remainingTime <= level_get(running->level)->maxTime) &&
+             (running->remainingLives <= GAME_CONFIG.maxLives) &&
+             (snapshot->specialPillsGenerated <= level_get(running->level)->specialPillCount);
+
+    // Pac-Man
+    valid &= get_position(&cursor, &running->pacman.sprite.currPos);
+    valid &= get_position(&cursor, &running->pacman.sprite.prevPos);
+    running->pacman.sprite.direction = (Direction)bits_get(&cursor, DIRECTION_BITS);
+    running->pacman.sprite.animationFrame = bits_get(&cursor, ANIMATION_BITS);
+    running->pacman.sprite.progress = bits_get(&cursor, 16);
+    running->pacman.sprite.speed = 0;
+    valid &= (running->pacman.sprite.direction <= DIRECTION_DOWN);
+
+    // Ghost table and mode machine
+    for (ghost = 0; ghost < GHOST_COUNT; ghost++) {
+        valid &= get_position(&cursor, &ghosts->currPos[ghost]);
+        valid &= get_position(&cursor, &ghosts->prevPos[ghost]);
+        ghosts->direction[ghost] = bits_get(&cursor, DIRECTION_BITS);
+        ghosts->animationFrame[ghost] = bits_get(&cursor, ANIMATION_BITS);
+        ghosts->progress[ghost] = bits_get(&cursor, 16);
+        ghosts->mode[ghost] = bits_get(&cursor, GHOST_MODE_BITS);
+        ghosts->currentSpeed[ghost] = bits_get(&cursor, 8);
+        ghosts->timer[ghost] = bits_get(&cursor, 16);
+        ghosts->speed[ghost] = 0;
+        valid &= (ghosts->direction[ghost] <= DIRECTION_DOWN) && (ghosts->mode[ghost] < GHOST_MODE_COUNT) &&
+                 (ghosts->currentSpeed[ghost] >= GAME_CONFIG.ghostConfig.minSpeed) &&
+                 (ghosts->currentSpeed[ghost] <= GAME_CONFIG.ghostConfig.maxSpeed);
+    }
+    snapshot->ghostModes.waveIndex = bits_get(&cursor, WAVE_INDEX_BITS);
+    snapshot->ghostModes.waveMode = bits_get(&cursor, GHOST_MODE_BITS);
+    snapshot->ghostModes.waveTicks = bits_get(&cursor, 16);
+    snapshot->ghostModes.frightenedTicks = bits_get(&cursor, 16);
+    snapshot->ghostModes.frightenedRandom = bits_get(&cursor, 16);
+    valid &= (snapshot->ghostModes.waveIndex <= GHOST_WAVE_COUNT) &&
+             ((snapshot->ghostModes.waveMode == GHOST_MODE_SCATTER) || (snapshot->ghostModes.waveMode == GHOST_MODE_CHASE)) &&
+             (snapshot->ghostModes.frightenedRandom != 0);
+
+    // Controller
+    snapshot->movementTicks = bits_get(&cursor, 32);
+    snapshot->gameRandom = bits_get(&cursor, 16);
+    snapshot->lifeIncreases = bits_get(&cursor, 8);
+    snapshot->pendingDirection = bits_get(&cursor, DIRECTION_BITS);
+    valid &= (snapshot->gameRandom != 0) && (snapshot->pendingDirection <= DIRECTION_DOWN);
+    for (id = 0; id < SNAPSHOT_EVENT_COUNT; id++) {
+        snapshot->eventDelays[id] = bits_get(&cursor, 16);
+        valid &= (snapshot->eventDelays[id] != 0);
+    }
+
+    // Maze: the one of the level with the pills that are left
+    level_load_map(running->level, &running->gameMap);
+    running->remainingPills = 0;
+    for (position.y = 0; position.y < GAME_MAP_HEIGHT; position.y++) {
+        row = level_row_tables(level_get(running->level), position.y);
+        for (pill = 0; pill < row->pillCount; pill++) {
+            position.x = LEVEL_PILL_COLUMNS[row->firstPill + pill];
+            code = bits_get(&cursor, PILL_CELL_BITS);
+            if (code == PILL_CELL_EATEN) {
+                running->gameMap[position.y][position.x] = CELL_FREE;
+                continue;
+            }
+            running->gameMap[position.y][position.x] = (code == PILL_CELL_SPECIAL) ? CELL_SPECIAL_PILL : CELL_STANDARD_PILL;
+            running->remainingPills++;
+            valid &= (code <= PILL_CELL_SPECIAL);
+        }
+    }
+
+    // Only the padding of the last byte may be left over
+    return valid && !cursor.overflow && ((cursor.bitCount - cursor.bit) < 8);
+}
+
+// Append a field of width bits (most significant bit first)
+static void bits_put(BitCursor* cursor, unsigned int value, unsigned char width) {
+    unsigned char* byte;
+    unsigned char mask;
+
+    if (cursor->bit + width > cursor->bitCount) {
+        cursor->overflow = 1;
+        return;
+    }
+    while (width--) {
+        byte = &cursor->data[cursor->bit >> 3];
+        mask = 0x80 >> (cursor->bit & 7);
+        if ((cursor->bit & 7) == 0) {
+            *byte = 0;
+        }
+        if ((value >> width) & 1) {
+            *byte |= mask;
+        }
+        cursor->bit++;
+    }
+}
+
+// Read a field of width bits (0 past the end of the blob)
+static unsigned int bits_get(BitCursor* cursor, unsigned char width) {
+    unsigned int value = 0;
+
+    if (cursor->bit + width > cursor->bitCount) {
+        cursor->overflow = 1;
+        return 0;
+    }
+    while (width--) {
+        value = (value << 1) | ((cursor->data[cursor->bit >> 3] >> (7 - (cursor->bit & 7))) & 1);
+        cursor->bit++;
+    }
+    return value;
+}
+
+static void put_position(BitCursor* cursor, Position position) {
+    bits_put(cursor, position.x, POSITION_BITS);
+    bits_put(cursor, position.y, POSITION_BITS);
+}
+
+// Read a position, 0 if it lies outside the maze
+static unsigned char get_position(BitCursor* cursor, Position* position) {
+    position->x = bits_get(cursor, POSITION_BITS);
+    position->y = bits_get(cursor, POSITION_BITS);
+    return (position->x < GAME_MAP_WIDTH) && (position->y < GAME_MAP_HEIGHT);
+}
+
+// CRC-16/CCITT (polynomial 0x1021, initial value 0xFFFF)
+static unsigned short crc16_ccitt(const unsigned char* data, unsigned int length) {
+    unsigned short crc = 0xFFFF;
+    unsigned char bit;
+
+    while (length--) {
+        crc ^= (unsigned short)(*data++) << 8;
+        for (bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x8000) ? (unsigned short)((crc << 1) ^ 0x1021) : (unsigned short)(crc << 1);
+        }
+    }
+    return crc;
+}
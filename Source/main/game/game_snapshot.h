@@ -0,0 +1,63 @@
+#ifndef __GAME_SNAPSHOT_H
+#define __GAME_SNAPSHOT_H
+
+#include "game_engine.h"
+#include "game_utils.h"
+#include "game_ghosts.h"
+#include "../event_scheduler.h"
+
+/*
+ * Save-state snapshots.
+ *
+ * A snapshot holds everything a running game depends on: the GameRunning
+ * and GameStatus fields, the ghost mode machine, the tick count, random
+ * stream and extra-life count of the controller and the ticks each game
+ * event still has to wait. Restoring it resumes the game at the same
+ * movement tick with the same event phases, so a replay recorded after a
+ * restore plays back from the snapshot exactly.
+ *
+ * Blob layout:
+ *   header   [0] SNAPSHOT_MAGIC, [1] SNAPSHOT_FORMAT_VERSION, [2] total size
+ *   payload  fields packed MSB first with the width they need: positions
+ *            in 5+5 bits, directions in 3, speeds and pill counts are
+ *            recomputed instead of stored, and each maze cell that starts
+ *            with a pill takes 2 bits (eaten, standard or special)
+ *   trailer  CRC-16/CCITT of the header and payload (big-endian)
+ *
+ * A whole game fits in about 140 bytes. Every field is range checked
+ * before a snapshot is accepted, so a blob from another build or a
+ * corrupted one is rejected and never half applied.
+ */
+
+#define SNAPSHOT_MAGIC            0x5A
+#define SNAPSHOT_FORMAT_VERSION   1
+#define SNAPSHOT_HEADER_SIZE      3
+#define SNAPSHOT_CRC_SIZE         2
+#define SNAPSHOT_MAX_SIZE         192                            // Worst case blob size (buffers)
+#define SNAPSHOT_EVENT_COUNT      (EVENT_GHOST_ACCELERATION + 1) // Game events, in EventID order
+
+/*
+ * Snapshot kept across a reset: the last bytes of the AHB SRAM (IRAM2),
+ * kept out of the linker's reach in the project memory layout. A reset
+ * leaves them untouched, a power cycle fills them with noise that the CRC
+ * rejects.
+ */
+#define SNAPSHOT_RETAINED_ADDRESS 0x20083F00
+#define SNAPSHOT_RETAINED_SIZE    256
+
+// Decoded content of a snapshot
+typedef struct {
+    GameRunning running;                   // Map, stats and actors (speeds and pill count recomputed)
+    unsigned char specialPillsGenerated;   // GameStatus counter (the game always resumes paused)
+    GhostModeState ghostModes;             // Scatter/chase waves and frightened time
+    unsigned int movementTicks;            // Replay time base
+    PrngState gameRandom;                  // Special pill stream
+    unsigned char lifeIncreases;           // Extra lives already awarded
+    unsigned char pendingDirection;        // Joystick input latched for the next tick
+    unsigned short eventDelays[SNAPSHOT_EVENT_COUNT];  // Ticks left before each game event
+} GameSnapshot;
+
+unsigned int snapshot_encode(const GameSnapshot* snapshot, unsigned char* buffer, unsigned int size);
+unsigned char snapshot_decode(const unsigned char* data, unsigned int length, GameSnapshot* snapshot);
+
+#endif /* __GAME_SNAPSHOT_H */
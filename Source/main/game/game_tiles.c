@@ -0,0 +1,124 @@
+#include <string.h>
+#include "game_tiles.h"
+#include "game_renderer.h"
+
+// Colours of every level start
+static const unsigned short PALETTE_DEFAULTS[PALETTE_COUNT] = {
+    COL_BLACK,        // Background
+    COL_BLUE,         // Wall outline
+    COL_GHOST_DOOR,   // Ghost house door
+    COL_TUMBLEWEED,   // Pills
+    COL_YELLOW,       // Pac-Man
+    COL_RED,          // Blinky
+    COL_PINK,         // Pinky
+    COL_CYAN,         // Inky
+    COL_ORANGE,       // Clyde
+    COL_BLUE,         // Frightened ghosts
+    COL_WHITE,        // Ghost eyes
+    COL_CYAN          // Score pop-ups
+};
+
+static unsigned short palette[PALETTE_COUNT];
+
+// Put the default colours back
+void palette_reset(void) {
+    memcpy(palette, PALETTE_DEFAULTS, sizeof(palette));
+}
+
+// Recolour a role: the next draws use the new colour
+void palette_set(PaletteEntry entry, unsigned short color) {
+    palette[entry] = color;
+}
+
+unsigned short palette_color(PaletteEntry entry) {
+    return palette[entry];
+}
+
+static const TileTrim FULL_TILE = { 0, 0, TILE_SIZE - 1, TILE_SIZE - 1 };
+
+// Stream a rectangle of a tile to the LCD, expanding its shades to RGB565
+static void tile_stream(TileID tile, unsigned short x, unsigned short y, PaletteEntry ink, const TileTrim* area) {
+    const unsigned char* pixels = TILE_ATLAS[tile];
+    unsigned short shades[1 << TILE_BITS];
+    unsigned short image[TILE_SIZE][TILE_SIZE];
+    unsigned char shade;
+    unsigned char row;
+    unsigned char column;
+
+    shades[TILE_SHADE_BACKGROUND] = palette[PALETTE_BACKGROUND];
+    shades[TILE_SHADE_INK] = palette[ink];
+    shades[TILE_SHADE_EYES] = palette[PALETTE_EYES];
+    shades[3] = palette[PALETTE_BACKGROUND];   // Not used by the atlas
+
+    for (row = area->top; row <= area->bottom; row++) {
+        for (column = area->left; column <= area->right; column++) {
+            // Four pixels a byte, the leftmost in the high bits
+            shade = (pixels[row * TILE_ROW_BYTES + (column >> 2)] >> (6 - 2 * (column & 3))) & 3;
+            image[row][column] = shades[shade];
+        }
+    }
+    LCD_WriteRect(x + area->left, y + area->top, area->right - area->left + 1, area->bottom - area->top + 1,
+                  &image[area->top][area->left], TILE_SIZE);
+}
+
+/**
+ * @brief Draws a whole tile, its background pixels included.
+ *
+ * @param tile Tile of the atlas.
+ * @param x Screen column of the tile's left edge.
+ * @param y Screen row of the tile's top edge.
+ * @param ink Palette entry of the tile's ink.
+ */
+void tile_draw(TileID tile, unsigned short x, unsigned short y, PaletteEntry ink) {
+    tile_stream(tile, x, y, ink, &FULL_TILE);
+}
+
+/**
+ * @brief Draws a tile over a cleared background: only the rectangle around its ink.
+ *
+ * @param tile Tile of the atlas.
+ * @param x Screen column of the tile's left edge.
+ * @param y Screen row of the tile's top edge.
+ * @param ink Palette entry of the tile's ink.
+ */
+void tile_draw_over(TileID tile, unsigned short x, unsigned short y, PaletteEntry ink) {
+    tile_stream(tile, x, y, ink, &TILE_TRIMS[tile]);
+}
+
+/**
+ * @brief Draws the ink and eye pixels of a tile into a RAM surface: its background shade is transparent.
+ *
+ * The tile may stand partly outside the surface (a sprite between two
+ * cells), only the pixels inside it are drawn.
+ *
+ * @param tile Tile of the atlas.
+ * @param surface Surface to draw into.
+ * @param x Surface column of the tile's left edge (may be negative).
+ * @param y Surface row of the tile's top edge (may be negative).
+ * @param ink Palette entry of the tile's ink.
+ */
+void tile_compose(TileID tile, const TileSurface* surface, short x, short y, PaletteEntry ink) {
+    const unsigned char* shades = TILE_ATLAS[tile];
+    const TileTrim* area = &TILE_TRIMS[tile];
+    const short top = (y + area->top < 0) ? -y : area->top;
+    const short bottom = (y + area->bottom >= (short)surface->height) ? ((short)surface->height - 1 - y) : area->bottom;
+    const short left = (x + area->left < 0) ? -x : area->left;
+    const short right = (x + area->right >= (short)surface->width) ? ((short)surface->width - 1 - x) : area->right;
+    unsigned short colors[1 << TILE_BITS];
+    unsigned short* line;
+    unsigned char shade;
+    short row;
+    short column;
+
+    colors[TILE_SHADE_INK] = palette[ink];
+    colors[TILE_SHADE_EYES] = palette[PALETTE_EYES];
+    for (row = top; row <= bottom; row++) {
+        line = surface->pixels + (y + row) * surface->stride;
+        for (column = left; column <= right; column++) {
+            shade = (shades[row * TILE_ROW_BYTES + (column >> 2)] >> (6 - 2 * (column & 3))) & 3;
+            if ((shade == TILE_SHADE_INK) || (shade == TILE_SHADE_EYES)) {
+                line[x + column] = colors[shade];
+            }
+        }
+    }
+}
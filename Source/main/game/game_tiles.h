@@ -0,0 +1,96 @@
+#ifndef __GAME_TILES_H
+#define __GAME_TILES_H
+
+#include "game_engine.h"
+
+/*
+ * Tile atlas and palette.
+ *
+ * The sprites (pills, Pac-Man, the ghosts and their eyes) are 8x8 tiles
+ * kept in flash at two bits per pixel, 16 bytes a tile instead of 128 as
+ * RGB565. A tile pixel is one of three shades:
+ *   0 background   1 ink (the colour the caller picks)   2 eye white
+ * so one ghost tile serves the four ghosts and the frightened ones.
+ *
+ * Colours come from a small palette in RAM, one RGB565 entry per role. A
+ * tile is expanded to RGB565 while it streams into the GRAM window of its
+ * cell, four lookups per tile. Changing a palette entry recolours every
+ * later draw of that role (frightened ghosts flashing white) with no
+ * per-pixel work. Over a background already cleared (a map band) only the
+ * rectangle around the tile's ink is sent. The band renderer composes
+ * tiles into RAM instead, their background shade left transparent.
+ *
+ * The atlas in game_tiles_data.c is generated by host/host_tile_pack.c from
+ * the ASCII art of game_tiles.txt.
+ */
+
+#define TILE_SIZE       TILE_SCALE                        // Pixels per side
+#define TILE_BITS       2                                 // Bits per pixel
+#define TILE_ROW_BYTES  (TILE_SIZE * TILE_BITS / 8)
+#define TILE_BYTES      (TILE_SIZE * TILE_ROW_BYTES)
+
+// Tile shades
+#define TILE_SHADE_BACKGROUND 0
+#define TILE_SHADE_INK        1
+#define TILE_SHADE_EYES       2
+
+// Tiles of the atlas, in game_tiles.txt order (directions RIGHT, LEFT, UP, DOWN as in Direction)
+typedef enum {
+    TILE_PILL = 0,
+    TILE_SPECIAL_PILL,
+    TILE_PACMAN,                                  // Two animation frames per direction
+    TILE_GHOST = TILE_PACMAN + 8,                 // Two animation frames per direction
+    TILE_EYES = TILE_GHOST + 8,                   // One per direction (eaten ghost)
+    TILE_COUNT = TILE_EYES + 4
+} TileID;
+
+#define TILE_PACMAN_FRAME(direction, frame) ((TileID)(TILE_PACMAN + ((direction) - DIRECTION_RIGHT) * 2 + (frame)))
+#define TILE_GHOST_FRAME(direction, frame)  ((TileID)(TILE_GHOST + ((direction) - DIRECTION_RIGHT) * 2 + (frame)))
+#define TILE_EYES_FACING(direction)         ((TileID)(TILE_EYES + ((direction) - DIRECTION_RIGHT)))
+
+// Palette entries
+typedef enum {
+    PALETTE_BACKGROUND = 0,
+    PALETTE_WALL,
+    PALETTE_DOOR,
+    PALETTE_PILL,
+    PALETTE_PACMAN,
+    PALETTE_BLINKY,        // The ghosts follow in GhostID order
+    PALETTE_PINKY,
+    PALETTE_INKY,
+    PALETTE_CLYDE,
+    PALETTE_FRIGHTENED,
+    PALETTE_EYES,
+    PALETTE_POPUP,         // Score pop-ups
+    PALETTE_COUNT
+} PaletteEntry;
+
+#define PALETTE_GHOST(ghost) ((PaletteEntry)(PALETTE_BLINKY + (ghost)))
+
+// Smallest rectangle holding the non-background pixels of a tile (corners included)
+typedef struct {
+    unsigned char left;
+    unsigned char top;
+    unsigned char right;
+    unsigned char bottom;
+} TileTrim;
+
+// RAM surface tiles are composed into (a band strip)
+typedef struct {
+    unsigned short* pixels;   // Top-left pixel
+    unsigned short stride;    // Pixels per line
+    unsigned short width;     // Pixels drawn into per line
+    unsigned short height;    // Lines
+} TileSurface;
+
+extern const unsigned char TILE_ATLAS[TILE_COUNT][TILE_BYTES];
+extern const TileTrim TILE_TRIMS[TILE_COUNT];
+
+void palette_reset(void);
+void palette_set(PaletteEntry entry, unsigned short color);
+unsigned short palette_color(PaletteEntry entry);
+void tile_draw(TileID tile, unsigned short x, unsigned short y, PaletteEntry ink);
+void tile_draw_over(TileID tile, unsigned short x, unsigned short y, PaletteEntry ink);
+void tile_compose(TileID tile, const TileSurface* surface, short x, short y, PaletteEntry ink);
+
+#endif /* __GAME_TILES_H */
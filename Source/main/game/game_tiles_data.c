@@ -0,0 +1,54 @@
+/* Generated by host/host_tile_pack.c from game_tiles.txt: do not edit */
+#include "game_tiles.h"
+
+// 22 tiles, 2 bits per pixel, rows of 2 bytes (leftmost pixel in the high bits)
+const unsigned char TILE_ATLAS[TILE_COUNT][TILE_BYTES] = {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},   //  0 pill
+    {0x00, 0x00, 0x01, 0x40, 0x05, 0x50, 0x15, 0x54, 0x15, 0x54, 0x05, 0x50, 0x01, 0x40, 0x00, 0x00},   //  1 special_pill
+    {0x00, 0x00, 0x05, 0x50, 0x15, 0x40, 0x15, 0x00, 0x14, 0x00, 0x15, 0x00, 0x15, 0x40, 0x05, 0x50},   //  2 pacman_right_0
+    {0x00, 0x00, 0x05, 0x50, 0x15, 0x50, 0x15, 0x40, 0x15, 0x00, 0x15, 0x40, 0x15, 0x50, 0x05, 0x50},   //  3 pacman_right_1
+    {0x00, 0x00, 0x05, 0x50, 0x01, 0x54, 0x00, 0x54, 0x00, 0x14, 0x00, 0x54, 0x01, 0x54, 0x05, 0x50},   //  4 pacman_left_0
+    {0x00, 0x00, 0x05, 0x50, 0x05, 0x54, 0x01, 0x54, 0x00, 0x54, 0x01, 0x54, 0x05, 0x54, 0x05, 0x50},   //  5 pacman_left_1
+    {0x00, 0x00, 0x00, 0x00, 0x10, 0x04, 0x14, 0x14, 0x15, 0x54, 0x15, 0x54, 0x15, 0x54, 0x05, 0x50},   //  6 pacman_up_0
+    {0x00, 0x00, 0x00, 0x00, 0x14, 0x14, 0x15, 0x54, 0x15, 0x54, 0x15, 0x54, 0x15, 0x54, 0x05, 0x50},   //  7 pacman_up_1
+    {0x00, 0x00, 0x05, 0x50, 0x15, 0x54, 0x15, 0x54, 0x15, 0x54, 0x14, 0x14, 0x10, 0x04, 0x00, 0x00},   //  8 pacman_down_0
+    {0x00, 0x00, 0x05, 0x50, 0x15, 0x54, 0x15, 0x54, 0x15, 0x54, 0x15, 0x54, 0x14, 0x14, 0x00, 0x00},   //  9 pacman_down_1
+    {0x00, 0x00, 0x05, 0x50, 0x18, 0x61, 0x1A, 0x69, 0x15, 0x54, 0x15, 0x54, 0x11, 0x44, 0x11, 0x44},   // 10 ghost_right_0
+    {0x00, 0x00, 0x05, 0x50, 0x1A, 0x69, 0x18, 0x61, 0x15, 0x54, 0x15, 0x54, 0x15, 0x54, 0x11, 0x44},   // 11 ghost_right_1
+    {0x00, 0x00, 0x05, 0x50, 0x12, 0x49, 0x1A, 0x69, 0x15, 0x54, 0x15, 0x54, 0x11, 0x44, 0x11, 0x44},   // 12 ghost_left_0
+    {0x00, 0x00, 0x05, 0x50, 0x1A, 0x69, 0x12, 0x49, 0x15, 0x54, 0x15, 0x54, 0x15, 0x54, 0x11, 0x44},   // 13 ghost_left_1
+    {0x00, 0x00, 0x05, 0x50, 0x12, 0x49, 0x1A, 0x69, 0x15, 0x54, 0x15, 0x54, 0x11, 0x44, 0x11, 0x44},   // 14 ghost_up_0
+    {0x00, 0x00, 0x05, 0x50, 0x18, 0x61, 0x1A, 0x69, 0x15, 0x54, 0x15, 0x54, 0x15, 0x54, 0x11, 0x44},   // 15 ghost_up_1
+    {0x00, 0x00, 0x05, 0x50, 0x1A, 0x69, 0x12, 0x49, 0x15, 0x54, 0x15, 0x54, 0x11, 0x44, 0x11, 0x44},   // 16 ghost_down_0
+    {0x00, 0x00, 0x05, 0x50, 0x1A, 0x69, 0x18, 0x61, 0x15, 0x54, 0x15, 0x54, 0x15, 0x54, 0x11, 0x44},   // 17 ghost_down_1
+    {0x00, 0x00, 0x00, 0x00, 0x08, 0x20, 0x0A, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},   // 18 eyes_right
+    {0x00, 0x00, 0x00, 0x00, 0x02, 0x08, 0x0A, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},   // 19 eyes_left
+    {0x00, 0x00, 0x00, 0x00, 0x02, 0x08, 0x0A, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},   // 20 eyes_up
+    {0x00, 0x00, 0x00, 0x00, 0x0A, 0x28, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}    // 21 eyes_down
+};
+
+// Rectangle around the ink of every tile (left, top, right, bottom)
+const TileTrim TILE_TRIMS[TILE_COUNT] = {
+    {3, 3, 4, 4},   //  0 pill
+    {1, 1, 6, 6},   //  1 special_pill
+    {1, 1, 5, 7},   //  2 pacman_right_0
+    {1, 1, 5, 7},   //  3 pacman_right_1
+    {2, 1, 6, 7},   //  4 pacman_left_0
+    {2, 1, 6, 7},   //  5 pacman_left_1
+    {1, 2, 6, 7},   //  6 pacman_up_0
+    {1, 2, 6, 7},   //  7 pacman_up_1
+    {1, 1, 6, 6},   //  8 pacman_down_0
+    {1, 1, 6, 6},   //  9 pacman_down_1
+    {1, 1, 7, 7},   // 10 ghost_right_0
+    {1, 1, 7, 7},   // 11 ghost_right_1
+    {1, 1, 7, 7},   // 12 ghost_left_0
+    {1, 1, 7, 7},   // 13 ghost_left_1
+    {1, 1, 7, 7},   // 14 ghost_up_0
+    {1, 1, 7, 7},   // 15 ghost_up_1
+    {1, 1, 7, 7},   // 16 ghost_down_0
+    {1, 1, 7, 7},   // 17 ghost_down_1
+    {2, 2, 6, 3},   // 18 eyes_right
+    {2, 2, 6, 3},   // 19 eyes_left
+    {2, 2, 6, 3},   // 20 eyes_up
+    {2, 2, 6, 3}    // 21 eyes_down
+};
@@ -3,57 +3,22 @@
 // Timer registers array
 static LPC_TIM_TypeDef* TIMERS[NUM_TIMERS] = {LPC_TIM0, LPC_TIM1, LPC_TIM2, LPC_TIM3};
 
-// Original game map
-GameMap map_original = {
-  {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
-	{1, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 1, 1, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 1},
-	{1, 4, 1, 1, 1, 1, 4, 1, 1, 1, 1, 1, 4, 1, 1, 4, 1, 1, 1, 1, 1, 4, 1, 1, 1, 1, 4, 1},
-	{1, 4, 1, 1, 1, 1, 4, 1, 1, 1, 1, 1, 4, 1, 1, 4, 1, 1, 1, 1, 1, 4, 1, 1, 1, 1, 4, 1},
-	{1, 4, 1, 1, 1, 1, 4, 1, 1, 1, 1, 1, 4, 1, 1, 4, 1, 1, 1, 1, 1, 4, 1, 1, 1, 1, 4, 1},
-	{1, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 1},
-	{1, 4, 1, 1, 1, 1, 4, 1, 1, 4, 1, 1, 1, 1, 1, 1, 1, 1, 4, 1, 1, 4, 1, 1, 1, 1, 4, 1},
-	{1, 4, 1, 1, 1, 1, 4, 1, 1, 4, 1, 1, 1, 1, 1, 1, 1, 1, 4, 1, 1, 4, 1, 1, 1, 1, 4, 1},
-	{1, 4, 4, 4, 4, 4, 4, 1, 1, 4, 4, 4, 4, 1, 1, 4, 4, 4, 4, 1, 1, 4, 4, 4, 4, 4, 4, 1},
-	{1, 1, 1, 1, 1, 1, 4, 1, 1, 1, 1, 1, 0, 1, 1, 0, 1, 1, 1, 1, 1, 4, 1, 1, 1, 1, 1, 1},
-	{1, 1, 1, 1, 1, 1, 4, 1, 1, 1, 1, 1, 0, 1, 1, 0, 1, 1, 1, 1, 1, 4, 1, 1, 1, 1, 1, 1},
-	{1, 1, 1, 1, 1, 1, 4, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 4, 1, 1, 1, 1, 1, 1},
-	{1, 1, 1, 1, 1, 1, 4, 1, 1, 0, 1, 1, 1, 7, 7, 1, 1, 1, 0, 1, 1, 4, 1, 1, 1, 1, 1, 1},
-	{1, 1, 1, 1, 1, 1, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 0, 1, 1, 1, 1, 1, 1},
-	{2, 0, 0, 0, 0, 0, 4, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 4, 0, 0, 0, 0, 0, 3},
-	{1, 1, 1, 1, 1, 1, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 0, 1, 1, 1, 1, 1, 1},
-	{1, 1, 1, 1, 1, 1, 4, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 4, 1, 1, 1, 1, 1, 1},
-	{1, 1, 1, 1, 1, 1, 4, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 4, 1, 1, 1, 1, 1, 1},
-	{1, 1, 1, 1, 1, 1, 4, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 4, 1, 1, 1, 1, 1, 1},
-	{1, 1, 1, 1, 1, 1, 4, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 4, 1, 1, 1, 1, 1, 1},
-	{1, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 1, 1, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 1},
-	{1, 4, 1, 1, 1, 1, 4, 1, 1, 1, 1, 1, 4, 1, 1, 4, 1, 1, 1, 1, 1, 4, 1, 1, 1, 1, 4, 1},
-	{1, 4, 1, 1, 1, 1, 4, 1, 1, 1, 1, 1, 4, 1, 1, 4, 1, 1, 1, 1, 1, 4, 1, 1, 1, 1, 4, 1},
-	{1, 4, 4, 4, 1, 1, 4, 4, 4, 4, 4, 4, 4, 0, 0, 4, 4, 4, 4, 4, 4, 4, 1, 1, 4, 4, 4, 1},
-	{1, 1, 1, 4, 1, 1, 4, 1, 1, 4, 1, 1, 1, 1, 1, 1, 1, 1, 4, 1, 1, 4, 1, 1, 4, 1, 1, 1},
-	{1, 1, 1, 4, 1, 1, 4, 1, 1, 4, 1, 1, 1, 1, 1, 1, 1, 1, 4, 1, 1, 4, 1, 1, 4, 1, 1, 1},
-	{1, 4, 4, 4, 4, 4, 4, 1, 1, 4, 4, 4, 4, 1, 1, 4, 4, 4, 4, 1, 1, 4, 4, 4, 4, 4, 4, 1},
-	{1, 4, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 4, 1, 1, 4, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 4, 1},
-	{1, 4, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 4, 1, 1, 4, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 4, 1},
-	{1, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 1},
-	{1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}
-};
-
-// Initialize the game map with the original configuration
-void initialize_game_map(GameMap* map_to_initialize) {
-    memcpy(map_to_initialize, &map_original, sizeof(GameMap));
-}
-
-// Get the spawn position for Pac-Man
+// Get the spawn position for Pac-Man in the current level
 Position get_pacman_spawn_position(void) {
-    return (Position){.y = PACMAN_SPAWN_Y, .x = PACMAN_SPAWN_X};
+    return level_get(gameRunning.level)->pacmanSpawn;
 }
 
-// Get the spawn position for ghost
-Position get_ghost_spawn_position(void) {
-		Position spawnPos;
-    spawnPos.x = GHOST_SPAWN_X;  // Assegna la posizione X
-    spawnPos.y = GHOST_SPAWN_Y;  // Assegna la posizione Y
-    return spawnPos;  // Restituisci la struttura Position
+// Get the spawn position of a ghost (Blinky starts on the door, the others inside the house)
+Position get_ghost_spawn_position(GhostID ghost) {
+    static const signed char GHOST_SPAWN_OFFSETS[GHOST_COUNT][2] = {
+        { 0, 0},   // Blinky
+        { 0, 2},   // Pinky
+        {-2, 2},   // Inky
+        { 3, 2}    // Clyde
+    };
+    const Position door = level_get(gameRunning.level)->ghostDoor;
+
+    return (Position){.x = door.x + GHOST_SPAWN_OFFSETS[ghost][0], .y = door.y + GHOST_SPAWN_OFFSETS[ghost][1]};
 }
 
 // Toggle the specified timer (start/stop)
@@ -72,3 +37,19 @@ unsigned int get_game_timer_value(uint8_t timer_id) {
 unsigned int get_RIT_value(void) {
     return LPC_RIT->RICOUNTER;
 }
+
+// Restart the deterministic pseudo-random sequence (0 selects the default seed)
+void prng_seed(PrngState* state, unsigned short seed) {
+    *state = seed ? seed : PRNG_DEFAULT_SEED;
+}
+
+// Next value of the deterministic sequence (16-bit Galois LFSR, taps 16 14 13 11)
+unsigned short prng_next(PrngState* state) {
+    const unsigned short lsb = *state & 1;
+
+    *state >>= 1;
+    if (lsb) {
+        *state ^= 0xB400;
+    }
+    return *state;
+}
@@ -4,16 +4,22 @@
 #include <stdio.h>
 #include <string.h>
 #include "game_engine.h"
+#include "game_levels.h"
 
 // Macro definitions
 #define NUM_TIMERS 4
+#define PRNG_DEFAULT_SEED 0xACE1   // Seed of the deterministic generators (must not be 0)
+
+// State of a deterministic pseudo-random generator (one per independent stream)
+typedef unsigned short PrngState;
 
 // Function prototypes
-void initialize_game_map(GameMap* map_to_initialize);
 Position get_pacman_spawn_position(void);
-Position get_ghost_spawn_position(void);
+Position get_ghost_spawn_position(GhostID ghost);
 void start_stop_game_timer(uint8_t timer_id);
 unsigned int get_game_timer_value(uint8_t timer_id);
 unsigned int get_RIT_value(void);
+void prng_seed(PrngState* state, unsigned short seed);
+unsigned short prng_next(PrngState* state);
 
 #endif /* __GAME_UTILS_H */
@@ -0,0 +1,65 @@
+#include "game_wipe.h"
+#include "game_renderer.h"
+#include "../event_scheduler.h"
+
+static WipeBandPainter painter;
+static WipeDone finisher;
+static unsigned short exposedLines;   // Lines of the new screen already drawn (and the scroll offset)
+static unsigned char active = 0;
+
+static void wipe_finish(void) {
+    scheduler_cancel_event(EVENT_SCREEN_WIPE);
+    LCD_Scroll(0);
+    active = 0;
+    finisher();
+}
+
+// Draw the next band of the new screen while it still shows at the top, then scroll it to the bottom
+static void wipe_step(void) {
+    painter(exposedLines, exposedLines + WIPE_BAND_LINES - 1);
+    exposedLines += WIPE_BAND_LINES;
+    if (exposedLines >= DISPLAY_HEIGHT) {
+        wipe_finish();
+    } else {
+        LCD_Scroll(exposedLines);
+    }
+}
+
+/**
+ * @brief Slides a new screen in from the bottom, one band per step.
+ *
+ * A wipe still running is completed first.
+ *
+ * @param paint Draws a band of the new screen.
+ * @param done Called once the new screen is whole and unscrolled.
+ */
+void wipe_start(WipeBandPainter paint, WipeDone done) {
+    wipe_complete();
+    painter = paint;
+    finisher = done;
+    exposedLines = 0;
+
+    if (!LCD_Scroll(0)) {
+        paint(0, DISPLAY_HEIGHT - 1);   // No hardware scroll: all at once
+        done();
+        return;
+    }
+    active = 1;
+    scheduler_start_event(EVENT_SCREEN_WIPE, wipe_step, WIPE_STEP_TICKS, WIPE_STEP_TICKS);
+}
+
+// Draw the rest of the running wipe at once (the game goes on and draws over it)
+void wipe_complete(void) {
+    if (!active) {
+        return;
+    }
+    if (exposedLines < DISPLAY_HEIGHT) {
+        painter(exposedLines, DISPLAY_HEIGHT - 1);
+        exposedLines = DISPLAY_HEIGHT;
+    }
+    wipe_finish();
+}
+
+unsigned char wipe_active(void) {
+    return active;
+}
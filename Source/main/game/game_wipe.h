@@ -0,0 +1,33 @@
+#ifndef __GAME_WIPE_H
+#define __GAME_WIPE_H
+
+#include "game_engine.h"
+
+/*
+ * Scroll wipes.
+ *
+ * A change of the whole screen (the next level, GAME OVER) slides in from
+ * the bottom with the panel's hardware vertical scroll instead of being
+ * repainted at once. Every WIPE_STEP_TICKS the next WIPE_BAND_LINES screen
+ * lines of the new screen are drawn at their final GRAM place, then the
+ * scroll offset moves past them: the old screen leaves by the top and the
+ * lines already drawn show at the bottom. When the offset comes round to 0
+ * the GRAM holds the new screen exactly, so a step costs one band and a
+ * register write, and nothing is redrawn at the end.
+ *
+ * The painter only has to draw what differs from the old screen in its
+ * band. On a panel without hardware scroll the whole screen is painted at
+ * once.
+ */
+
+#define WIPE_BAND_LINES TILE_SCALE   // Screen lines uncovered per step (one maze row)
+#define WIPE_STEP_TICKS 1            // Scheduler ticks between steps
+
+typedef void (*WipeBandPainter)(unsigned short yStart, unsigned short yEnd);   // Draws lines yStart..yEnd of the new screen
+typedef void (*WipeDone)(void);
+
+void wipe_start(WipeBandPainter paint, WipeDone done);
+void wipe_complete(void);
+unsigned char wipe_active(void);
+
+#endif /* __GAME_WIPE_H */
@@ -1,15 +1,55 @@
 #include "game_canComuntication.h"
+#include "./game/game_hud.h"
+#include "critical_section.h"
 
-// Static variables to store the previous state of game stats
-static unsigned char previous_time;   // Previous game time
-static unsigned short previous_score; // Previous game score
-static unsigned char previous_lives;  // Previous number of lives
+// Latest statistics received over CAN, waiting for the next frame
+static volatile unsigned char received_stats[4];
+static volatile unsigned char received_pending = 0;
+
+/**
+ * @brief Stores the game statistics received over CAN (called by the CAN interrupt).
+ * 
+ * Drawing is deferred to the next HUD update, so only the latest message
+ * received before it is shown.
+ * 
+ * @param data_array The 8 data bytes of the received message.
+ */
+void handle_CAN_receive_stats(unsigned char data_array[8]) {
+    unsigned char i;
+
+    for (i = 0; i < 4; i++) {
+        received_stats[i] = data_array[i];
+    }
+    received_pending = 1;
+    hud_request();
+}
+
+/**
+ * @brief Copies the statistics received since the last call.
+ * 
+ * @param data_array Destination of the statistics.
+ * @return 1 if new statistics were available, 0 otherwise.
+ */
+unsigned char take_CAN_received_stats(unsigned char data_array[8]) {
+    unsigned char i;
+    unsigned char available;
+    ENTER_CRITICAL();  // The CAN interrupt must not update the buffer while it is copied
+
+    available = received_pending;
+    for (i = 0; i < 4; i++) {
+        data_array[i] = received_stats[i];
+    }
+    received_pending = 0;
+    EXIT_CRITICAL();
+
+    return available;
+}
 
 /**
  * @brief Handles CAN communication to update game statistics.
  * 
  * This function decodes the incoming data array, extracts the game statistics,
- * and updates the corresponding values if there are any changes.
+ * and hands them to the HUD, which draws the digits and lives that changed.
  * 
  * @param data_array An array of 8 bytes containing the game statistics.
  *        - data_array[0]: Game time (unsigned char)
@@ -27,21 +67,5 @@ void handle_CAN_update_stats(unsigned char data_array[8]) {
     current_lives = data_array[1];                      // Extract number of lives
     current_score = (data_array[2] << 8) | data_array[3]; // Extract game score (big-endian)
 
-    // Update game time if it has changed
-    if (current_time != previous_time) {
-        previous_time = current_time;  // Update previous time
-        draw_time_stat(current_time);  // Call function to display updated time
-    }
-
-    // Update game score if it has changed
-    if (current_score != previous_score) {
-        previous_score = current_score;  // Update previous score
-        draw_stat_score(current_score);  // Call function to display updated score
-    }
-
-    // Update number of lives if it has changed
-    if (current_lives != previous_lives) {
-        previous_lives = current_lives;  // Update previous lives
-        draw_status_lives(current_lives);  // Call function to display updated lives
-    }
+    hud_set_stats(current_time, current_score, current_lives);
 }
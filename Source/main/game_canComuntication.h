@@ -1,5 +1,8 @@
 #ifndef __GAME_CANCOMUNICATION_H
 #define __GAME_CANCOMUNICATION_H
 #include "./game/game_renderer.h"
+#include "task_scheduler.h"
 void handle_CAN_update_stats(unsigned char data_array[8]);
+void handle_CAN_receive_stats(unsigned char data_array[8]);
+unsigned char take_CAN_received_stats(unsigned char data_array[8]);
 #endif //__GAME_CANCOMUNICATION_H
\ No newline at end of file
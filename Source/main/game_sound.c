@@ -1,6 +1,7 @@
 #include "game_sound.h"
 #include "game_melodies.h"
 #include "../timer/timer.h"
+#include "event_scheduler.h"
 
 unsigned short currentNote = 0;
 
@@ -17,18 +18,21 @@ void playNote(NOTE note)
 {
 	if(note.freq != REST)
 	{
-		reset_timer(2);
-		init_timer(2, 0, 0, 3, note.freq*AMPLIFIER*VOLUME);	
-		enable_timer(2);
+		// TIMER2 is set up once (initialize_buzzer_timer): a note only changes MR0,
+		// latched after the next match if the previous note still sounds
+		update_timer_interval(2, 0, note.freq*AMPLIFIER*VOLUME);
+		if((LPC_TIM2->TCR & 1) == 0)
+		{
+			reset_timer(2);
+			enable_timer(2);
+		}
 	}
-	reset_timer(3);
-	init_timer(3, 0, 0, 7, note.duration);
-	enable_timer(3);
+	scheduler_start_event(EVENT_NOTE_END, play_tone_single_note_duration, SCHEDULER_COUNTS_TO_TICKS(note.duration), 0);
 }
 
 BOOL isNotePlaying(void)
 {
-	return ((LPC_TIM2->TCR != 0) || (LPC_TIM3->TCR != 0));
+	return ((LPC_TIM2->TCR != 0) || scheduler_event_is_active(EVENT_NOTE_END));
 }
 
 void play_tone_single_note(){
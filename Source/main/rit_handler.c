@@ -22,11 +22,12 @@ void update_direction_left() {
     game_pacman_handle_direction_change(DIRECTION_LEFT);
 }
 
-// Mette in pausa il gioco
+// Mette in pausa il gioco (il disegno avviene nel task, non nell'interrupt)
 void pause_game() {
-    game_handle_pause();
+    task_post(TASK_PAUSE_TOGGLE);
 }
 
+// Richiede la prossima nota della traccia corrente
 void update_speaker_sound(){
-		game_play_tone_all_track();
+		task_post(TASK_AUDIO_SEQUENCER);
 }
\ No newline at end of file
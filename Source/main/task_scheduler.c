@@ -0,0 +1,194 @@
+#include "task_scheduler.h"
+#include "critical_section.h"
+#include "cpu_profiler.h"
+#include "event_scheduler.h"
+
+typedef struct {
+    TaskFunction function;      // Body of the task (runs to completion)
+    unsigned char priority;     // TaskPriority
+} Task;
+
+static Task tasks[TASK_COUNT];
+static TaskStats stats[TASK_COUNT];
+static volatile unsigned int readyMask[TASK_PRIORITY_COUNT]; // One ready queue per priority, one bit per task
+static IdleHook idleHook = task_idle_sleep;
+static unsigned long long idleCycles = 0;
+
+/**
+ * @brief Clears every task (the DWT cycle counter is started by profiler_init).
+ */
+void task_scheduler_init(void) {
+    unsigned char i;
+
+    for (i = 0; i < TASK_COUNT; i++) {
+        tasks[i].function = 0;
+        tasks[i].priority = TASK_PRIORITY_LOW;
+    }
+    for (i = 0; i < TASK_PRIORITY_COUNT; i++) {
+        readyMask[i] = 0;
+    }
+    idleHook = task_idle_sleep;
+    task_reset_stats();
+}
+
+/**
+ * @brief Installs the body and the priority of a task.
+ */
+void task_register(TaskID id, TaskFunction function, TaskPriority priority) {
+    ENTER_CRITICAL();
+    tasks[id].function = function;
+    tasks[id].priority = priority;
+    EXIT_CRITICAL();
+}
+
+/**
+ * @brief Moves a task to another priority (a pending post moves with it).
+ */
+void task_set_priority(TaskID id, TaskPriority priority) {
+    ENTER_CRITICAL();
+    if (readyMask[tasks[id].priority] & (1UL << id)) {
+        readyMask[tasks[id].priority] &= ~(1UL << id);
+        readyMask[priority] |= (1UL << id);
+    }
+    tasks[id].priority = priority;
+    EXIT_CRITICAL();
+}
+
+/**
+ * @brief Replaces the function called when nothing is ready (NULL restores sleeping).
+ *
+ * The hook runs with interrupts masked so that a post cannot be missed
+ * between the last check and the sleep; WFI still wakes on a pending IRQ.
+ */
+void task_set_idle_hook(IdleHook hook) {
+    idleHook = hook ? hook : task_idle_sleep;
+}
+
+/**
+ * @brief Marks a task as ready. Safe from any interrupt handler.
+ */
+void task_post(TaskID id) {
+    ENTER_CRITICAL();
+    readyMask[tasks[id].priority] |= (1UL << id);
+    stats[id].posts++;
+    EXIT_CRITICAL();
+}
+
+/**
+ * @brief Runs the highest priority ready task.
+ *
+ * @return 1 if a task ran, 0 if nothing was ready.
+ */
+unsigned char task_run_next(void) {
+    unsigned char priority;
+    unsigned char id = TASK_COUNT;
+    unsigned int mask;
+    unsigned int start;
+    unsigned int preempted;
+    unsigned int elapsed;
+
+    {
+        ENTER_CRITICAL();
+        for (priority = 0; priority < TASK_PRIORITY_COUNT; priority++) {
+            mask = readyMask[priority];
+            if (mask) {
+                id = 31 - __CLZ(mask & (0 - mask)); // Lowest ready ID of this level
+                readyMask[priority] = mask & ~(1UL << id);
+                break;
+            }
+        }
+        EXIT_CRITICAL();
+    }
+
+    if (id == TASK_COUNT) {
+        return 0;
+    }
+
+    // Interrupt handlers that preempt the task are not charged to it
+    preempted = profiler_preempted_cycles();
+    start = CPU_CYCLE_COUNT();
+    if (tasks[id].function) {
+        tasks[id].function();
+    }
+    elapsed = (CPU_CYCLE_COUNT() - start) - (profiler_preempted_cycles() - preempted);
+
+    stats[id].runs++;
+    stats[id].cycles += elapsed;
+    if (elapsed > stats[id].maxCycles) {
+        stats[id].maxCycles = elapsed;
+    }
+    return 1;
+}
+
+/**
+ * @brief Main loop: runs ready tasks and sleeps when there are none. Never returns.
+ */
+void task_scheduler_run(void) {
+    unsigned char priority;
+    unsigned int anyReady;
+    unsigned int start;
+    unsigned int preempted;
+    unsigned int elapsed;
+
+    while (1) {
+        while (task_run_next());
+
+        // DWT stops while the core sleeps: the idle time is read on the scheduler's timer
+        preempted = profiler_preempted_cycles();
+        start = scheduler_clock();
+        __disable_irq();
+        anyReady = 0;
+        for (priority = 0; priority < TASK_PRIORITY_COUNT; priority++) {
+            anyReady |= readyMask[priority];
+        }
+        if (!anyReady) {
+            idleHook();
+        }
+        __enable_irq();  // The interrupt that woke the core runs here
+        elapsed = SCHEDULER_COUNTS_TO_CYCLES(scheduler_clock() - start);
+        preempted = profiler_preempted_cycles() - preempted;
+        if (elapsed > preempted) {   // The timer counts in steps of four cycles
+            idleCycles += elapsed - preempted;
+        }
+    }
+}
+
+/**
+ * @brief Default idle hook: sleep until the next interrupt.
+ */
+void task_idle_sleep(void) {
+    __WFI();
+}
+
+const TaskStats* task_get_stats(TaskID id) {
+    return &stats[id];
+}
+
+unsigned long long task_get_idle_cycles(void) {
+    return idleCycles;
+}
+
+/**
+ * @brief CPU share of a task since the last reset, in per mille of the wall time left by the interrupts.
+ */
+unsigned int task_get_cpu_share(TaskID id) {
+    unsigned long long total = idleCycles;
+    unsigned char i;
+
+    for (i = 0; i < TASK_COUNT; i++) {
+        total += stats[i].cycles;
+    }
+    return total ? (unsigned int)((stats[id].cycles * 1000) / total) : 0;
+}
+
+void task_reset_stats(void) {
+    unsigned char i;
+
+    for (i = 0; i < TASK_COUNT; i++) {
+        stats[i].posts = 0;
+        stats[i].runs = 0;
+        stats[i].cycles = 0;
+        stats[i].maxCycles = 0;
+    }
+    idleCycles = 0;
+}
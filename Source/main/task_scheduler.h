@@ -0,0 +1,65 @@
+#ifndef __TASK_SCHEDULER_H
+#define __TASK_SCHEDULER_H
+
+#include "LPC17xx.h"
+
+/*
+ * Cooperative run-to-completion task scheduler (thread mode).
+ *
+ * Interrupt handlers only acknowledge their peripheral and post a task;
+ * the work itself runs in main() from task_scheduler_run(), highest
+ * priority first. Posting an already ready task is coalesced into a
+ * single run. Every run is timed with the DWT cycle counter, minus the
+ * interrupt time measured by the profiler, so the CPU share of each
+ * subsystem can be read with task_get_stats().
+ * When no task is ready the idle hook puts the core to sleep. DWT does not
+ * count in sleep, so the idle time is taken from the scheduler's timer
+ * (scheduler_clock) and converted to CPU cycles: tasks and idle together
+ * add up to the wall time left by the interrupt handlers.
+ */
+
+// Task priorities (lower value runs first)
+typedef enum {
+    TASK_PRIORITY_HIGH   = 0,
+    TASK_PRIORITY_NORMAL = 1,
+    TASK_PRIORITY_LOW    = 2,
+    TASK_PRIORITY_COUNT
+} TaskPriority;
+
+// Tasks of the game (the ID is also the order inside a priority level)
+typedef enum {
+    TASK_GAME_TICK          = 0, // Run the expired scheduler events (posted by TIMER0)
+    TASK_AUDIO_SEQUENCER    = 1, // Start the next note of the current track (posted by the RIT)
+    TASK_PAUSE_TOGGLE       = 2, // Pause or resume the game (posted by the INT0 debouncer)
+    TASK_RENDER_FLUSH       = 3, // Draw a frame: the dirty maze cells, then the HUD values that changed (posted by EVENT_FRAME)
+    TASK_CAN_TX_DRAIN       = 4, // Send the latest game stats over CAN
+    TASK_PROFILER_REPORT    = 5, // Report the interrupt profile (CAN or semihosting)
+    TASK_REPLAY_EXPORT      = 6, // Send the recorded replay bytes over CAN
+    TASK_COUNT
+} TaskID;
+
+typedef void (*TaskFunction)(void);
+typedef void (*IdleHook)(void);
+
+// Cycle accounting of a task
+typedef struct {
+    unsigned int posts;              // Times the task was posted
+    unsigned int runs;               // Times the task actually ran (posts are coalesced)
+    unsigned long long cycles;       // Total CPU cycles spent in the task
+    unsigned int maxCycles;          // Longest single run
+} TaskStats;
+
+void task_scheduler_init(void);
+void task_register(TaskID id, TaskFunction function, TaskPriority priority);
+void task_set_priority(TaskID id, TaskPriority priority);
+void task_set_idle_hook(IdleHook hook);
+void task_post(TaskID id);
+unsigned char task_run_next(void);
+void task_scheduler_run(void);
+const TaskStats* task_get_stats(TaskID id);
+unsigned long long task_get_idle_cycles(void);
+unsigned int task_get_cpu_share(TaskID id);
+void task_reset_stats(void);
+void task_idle_sleep(void);
+
+#endif /* __TASK_SCHEDULER_H */
@@ -1,26 +1,18 @@
 #include "timer_service.h"
 
 /**
- * @brief Handles the interrupt for Timer 0 to process various game mechanics.
+ * @brief Handles the interrupt for Timer 0 to run the event scheduler.
  * 
- * This timer is responsible for:
- * - Updating the remaining game time.
- * - Managing Blinky's respawn and vulnerability state.
- * - Generating special pills.
- * - Handling Pacman movement.
+ * This timer fires only when the closest scheduled deadline is reached. The expired
+ * events run later in thread mode, in the game tick task:
+ * - Pacman and ghost movement steps (ghost release and respawn included).
+ * - The game clock (remaining time).
+ * - Special pill generation.
+ * - The ghosts' vulnerability expiry and acceleration.
+ * - The end of the note being played.
  */
-void timer_0_next_tick_interrupt(void) {
-    game_process_next_tick();  // Process the next game tick (includes Pacman movement, time, etc.)
-}
-
-/**
- * @brief Handles the interrupt for Timer 1 to manage Blinky's movement.
- * 
- * This timer is dedicated to controlling Blinky's movement logic
- * and processing Blinky-specific behaviors.
- */
-void timer_1_move_ghost_interrupt(void) {
-    game_process_movement_of_ghost();  // Process the movement of Blinky
+void timer_0_event_scheduler_interrupt(void) {
+    task_post(TASK_GAME_TICK);  // scheduler_process_expired() catches up with every elapsed tick
 }
 
 /**
@@ -32,13 +24,3 @@ void timer_1_move_ghost_interrupt(void) {
 void timer_2_play_tone_interrupt(void) {
     game_play_tone_single_note();  // Play a single note sound
 }
-
-/**
- * @brief Handles the interrupt for Timer 3 to play sound with a specific duration.
- * 
- * This timer is responsible for managing the duration of sound effects
- * in the game, such as completing the playback of a tone.
- */
-void timer_3_play_tone_duration_interrupt(void) {
-    game_play_tone_single_note_duration();  // Play a single note with a specific duration
-}
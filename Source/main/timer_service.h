@@ -7,17 +7,15 @@
 
 /*
  * TIMER0: 
- * - Handles time management for the game.
- * - Responsible for generating special pills and controlling Pac-Man's movement.
+ * - Drives the tickless event scheduler (see event_scheduler.h).
+ * - Every game timing (movement tick, game clock, special pills, note duration) is an event.
  */
-void timer_0_next_tick_interrupt(void);
+void timer_0_event_scheduler_interrupt(void);
 
 /*
  * TIMER1: 
- * - Reserved for Blinky's movement control.
- * (Currently disabled, uncomment the line below to use.)
+ * - Paces the GPDMA fills of the LCD (see LCD_FillRectAsync in GLCD.c), no interrupt.
  */
-void timer_1_move_ghost_interrupt(void);
 
 /*
  * TIMER2: 
@@ -27,9 +25,7 @@ void timer_2_play_tone_interrupt(void);
 
 /*
  * TIMER3: 
- * - Manages the duration of sound playback.
- * - Ensures tones are played for the correct length of time.
+ * - Free (the note duration is a scheduler event).
  */
-void timer_3_play_tone_duration_interrupt(void);
 
 #endif /* End of TIMER INTERRUPTS HEADER */
@@ -12,6 +12,7 @@
 
 
 #include "../main/timer_service.h"
+#include "../main/cpu_profiler.h"
 
 
 /******************************************************************************
@@ -26,9 +27,12 @@
 
 void TIMER0_IRQHandler (void)
 {
+	PROFILE_IRQ_ENTER(PROFILE_TIMER0);
+	timer_apply_pending_intervals(0);	// Period changes take effect right after a match
+
 	if(LPC_TIM0->IR & 1) {		// MR0 
-		timer_0_next_tick_interrupt();
-		LPC_TIM0->IR = 1;			//clear interrupt flag
+		LPC_TIM0->IR = 1;			//clear interrupt flag before MR0 is reprogrammed
+		timer_0_event_scheduler_interrupt();
 	}
 	else if(LPC_TIM0->IR & 2){	// MR1
 		LPC_TIM0->IR = 2;			// clear interrupt flag 
@@ -39,6 +43,7 @@ void TIMER0_IRQHandler (void)
 	else if(LPC_TIM0->IR & 8){	// MR3
 		LPC_TIM0->IR = 8;			// clear interrupt flag 
 	}
+	PROFILE_IRQ_EXIT(PROFILE_TIMER0);
 	return;
 }
 
@@ -53,8 +58,10 @@ void TIMER0_IRQHandler (void)
 ******************************************************************************/
 void TIMER1_IRQHandler (void)
 {
+	PROFILE_IRQ_ENTER(PROFILE_TIMER1);
+	timer_apply_pending_intervals(1);	// Period changes take effect right after a match
+
 	if(LPC_TIM1->IR & 1) {		// MR0 
-		timer_1_move_ghost_interrupt();
 		LPC_TIM1->IR = 1;			//clear interrupt flag
 	}
 	else if(LPC_TIM1->IR & 2) {	// MR1
@@ -67,6 +74,7 @@ void TIMER1_IRQHandler (void)
 		LPC_TIM1->IR = 8;			// clear interrupt flag 
 	}
 
+	PROFILE_IRQ_EXIT(PROFILE_TIMER1);
 	return;
 }
 
@@ -81,6 +89,9 @@ void TIMER1_IRQHandler (void)
 ******************************************************************************/
 void TIMER2_IRQHandler (void)
 {
+	PROFILE_IRQ_ENTER(PROFILE_TIMER2);
+	timer_apply_pending_intervals(2);	// Period changes take effect right after a match
+
 	if(LPC_TIM2->IR & 1) {		// MR0 
 		timer_2_play_tone_interrupt();
 		LPC_TIM2->IR = 1;			//clear interrupt flag
@@ -94,6 +105,7 @@ void TIMER2_IRQHandler (void)
 	else if(LPC_TIM2->IR & 8){	// MR3
 		LPC_TIM2->IR = 8;			// clear interrupt flag 
 	}
+	PROFILE_IRQ_EXIT(PROFILE_TIMER2);
 	return;
 }
 
@@ -109,8 +121,10 @@ void TIMER2_IRQHandler (void)
 ******************************************************************************/
 void TIMER3_IRQHandler (void)
 {
+	PROFILE_IRQ_ENTER(PROFILE_TIMER3);
+	timer_apply_pending_intervals(3);	// Period changes take effect right after a match
+
 	if(LPC_TIM3->IR & 1) {		// MR0 
-		timer_3_play_tone_duration_interrupt();
 		LPC_TIM3->IR = 1;			//clear interrupt flag
 	}
 	else if(LPC_TIM3->IR & 2){	// MR1
@@ -122,6 +136,7 @@ void TIMER3_IRQHandler (void)
 	else if(LPC_TIM3->IR & 8){	// MR3
 		LPC_TIM3->IR = 8;			// clear interrupt flag 
 	}
+	PROFILE_IRQ_EXIT(PROFILE_TIMER3);
 	return;
 }
 
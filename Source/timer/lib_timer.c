@@ -10,32 +10,32 @@
 #include "LPC17xx.h"
 #include "timer.h"
 
+/* Peripherals, interrupt lines and priorities, indexed by timer_id */
+static LPC_TIM_TypeDef* const TIMER_REGS[TIMER_NUM] = {LPC_TIM0, LPC_TIM1, LPC_TIM2, LPC_TIM3};
+static const IRQn_Type TIMER_IRQS[TIMER_NUM] = {TIMER0_IRQn, TIMER1_IRQn, TIMER2_IRQn, TIMER3_IRQn};
+static const uint8_t TIMER_PRIORITIES[TIMER_NUM] = {4, 5, 6, 6};
+
+/* Match values waiting for the next match of their register (see update_timer_interval) */
+static volatile uint32_t pendingInterval[TIMER_NUM][TIMER_MATCH_NUM];
+static volatile uint8_t pendingMask[TIMER_NUM];
+
+/* Match register MR0..MR3 of a timer (they are contiguous in the register map) */
+#define TIMER_MATCH_REG(timer, MatchReg)	(&(timer)->MR0 + (MatchReg))
+
 /******************************************************************************
 ** Function name:		enable_timer
 **
 ** Descriptions:		Enable timer
 **
-** parameters:			timer number: 0 or 1
+** parameters:			timer number: 0 to 3
 ** Returned value:		None
 **
 ******************************************************************************/
 void enable_timer( uint8_t timer_id )
 {
-	if ( timer_id == 0 )
-	{
-		LPC_TIM0->TCR = 1;
-	}
-	else if (timer_id == 1)
-	{
-		LPC_TIM1->TCR = 1;
-	}
-	else if (timer_id == 2)
+	if ( timer_id < TIMER_NUM )
 	{
-		LPC_TIM2->TCR = 1;
-	}
-	else if (timer_id == 3)
-	{
-		LPC_TIM3->TCR = 1;
+		TIMER_REGS[timer_id]->TCR = 1;
 	}
 	return;
 }
@@ -45,27 +45,15 @@ void enable_timer( uint8_t timer_id )
 **
 ** Descriptions:		Disable timer
 **
-** parameters:			timer number: 0 or 1
+** parameters:			timer number: 0 to 3
 ** Returned value:		None
 **
 ******************************************************************************/
 void disable_timer( uint8_t timer_id )
 {
-	if ( timer_id == 0 )
-	{
-		LPC_TIM0->TCR = 0;
-	}
-	else if (timer_id == 1)
-	{
-		LPC_TIM1->TCR = 0;
-	}
-	else if (timer_id == 2)
+	if ( timer_id < TIMER_NUM )
 	{
-		LPC_TIM2->TCR = 0;
-	}
-	else if (timer_id == 3)
-	{
-		LPC_TIM3->TCR = 0;
+		TIMER_REGS[timer_id]->TCR = 0;
 	}
 	return;
 }
@@ -75,7 +63,7 @@ void disable_timer( uint8_t timer_id )
 **
 ** Descriptions:		Reset timer
 **
-** parameters:			timer number: 0 or 1
+** parameters:			timer number: 0 to 3
 ** Returned value:		None
 **
 ******************************************************************************/
@@ -83,147 +71,195 @@ void reset_timer( uint8_t timer_id )
 {
 	uint32_t regVal;
 
-	if ( timer_id == 0 )
+	if ( timer_id < TIMER_NUM )
 	{
-		regVal = LPC_TIM0->TCR;
+		regVal = TIMER_REGS[timer_id]->TCR;
 		regVal |= 0x02;
-		LPC_TIM0->TCR = regVal;
+		TIMER_REGS[timer_id]->TCR = regVal;
 	}
-	else if (timer_id == 1)
+	return;
+}
+
+/******************************************************************************
+** Function name:		toogle_timer
+**
+** Descriptions:		Start a stopped timer or stop a running one
+**
+** parameters:			timer number: 0 to 3
+** Returned value:		None
+**
+******************************************************************************/
+void toogle_timer( uint8_t timer_id )
+{
+	if ( timer_id < TIMER_NUM )
 	{
-		regVal = LPC_TIM1->TCR;
-		regVal |= 0x02;
-		LPC_TIM1->TCR = regVal;
+		TIMER_REGS[timer_id]->TCR ^= 1;
 	}
-	else if (timer_id == 2)
+	return;
+}
+
+/******************************************************************************
+** Function name:		init_timer
+**
+** Descriptions:		Inits Timer: prescaler, one match register and its
+**						MCR action bits (the previous action bits of that
+**						match register are replaced, not OR-ed)
+**
+** parameters:			timer number, prescaler, match register (0 to 3),
+**						TIMER_MATCH_* action bits, match value
+** Returned value:		0 on success, 1 on invalid timer or match register
+**
+******************************************************************************/
+uint32_t init_timer ( uint8_t timer_id, uint32_t Prescaler, uint8_t MatchReg, uint8_t SRImatchReg, uint32_t TimerInterval )
+{
+	LPC_TIM_TypeDef* timer;
+	const uint32_t shift = 3 * MatchReg;
+
+	if ( (timer_id >= TIMER_NUM) || (MatchReg >= TIMER_MATCH_NUM) )
 	{
-		regVal = LPC_TIM2->TCR;
-		regVal |= 0x02;
-		LPC_TIM2->TCR = regVal;
+		return (1);
+	}
+
+	timer = TIMER_REGS[timer_id];
+	pendingMask[timer_id] &= ~(1 << MatchReg);		// A fresh configuration drops any pending change
+
+	timer->PR = Prescaler;
+	*TIMER_MATCH_REG(timer, MatchReg) = TimerInterval;
+	timer->MCR = (timer->MCR & ~(TIMER_MATCH_ACTIONS << shift)) | ((SRImatchReg & TIMER_MATCH_ACTIONS) << shift);
+
+	NVIC_EnableIRQ(TIMER_IRQS[timer_id]);
+	NVIC_SetPriority(TIMER_IRQS[timer_id], TIMER_PRIORITIES[timer_id]);
+	return (0);
+}
+
+/******************************************************************************
+** Function name:		timer_period_from_us
+**
+** Descriptions:		Compute the prescaler and the match value of a period
+**						expressed in microseconds. The smallest prescaler whose
+**						match value fits 32 bits is chosen (best resolution).
+**
+** parameters:			period in microseconds, output prescaler and match value
+** Returned value:		None
+**
+******************************************************************************/
+void timer_period_from_us ( uint32_t PeriodUs, uint32_t* Prescaler, uint32_t* TimerInterval )
+{
+	uint64_t counts = (uint64_t)PeriodUs * (TIMER_PCLK_HZ / 1000000);
+	uint64_t prescale;
+
+	if ( counts == 0 )
+	{
+		counts = 1;
 	}
-	else if (timer_id == 3)
+
+	// Counts per prescaler step, rounded up so that the match value never overflows
+	prescale = (counts + 0xFFFFFFFFULL) >> 32;
+
+	*Prescaler = (uint32_t)(prescale - 1);
+	*TimerInterval = (uint32_t)(counts / prescale);	// TC matches after MR + 1 counts when reset on match
+	if ( *TimerInterval > 0 )
 	{
-		regVal = LPC_TIM3->TCR;
-		regVal |= 0x02;
-		LPC_TIM3->TCR = regVal;
+		(*TimerInterval)--;
 	}
-	return;
 }
 
+/******************************************************************************
+** Function name:		init_timer_us
+**
+** Descriptions:		Inits Timer from a target period in microseconds
+**						(the prescaler is shared by all the match registers)
+**
+** parameters:			timer number, match register, TIMER_MATCH_* action
+**						bits, period in microseconds
+** Returned value:		0 on success, 1 on invalid timer or match register
+**
+******************************************************************************/
+uint32_t init_timer_us ( uint8_t timer_id, uint8_t MatchReg, uint8_t SRImatchReg, uint32_t PeriodUs )
+{
+	uint32_t prescaler;
+	uint32_t interval;
+
+	timer_period_from_us(PeriodUs, &prescaler, &interval);
+	return init_timer(timer_id, prescaler, MatchReg, SRImatchReg, interval);
+}
 
 /******************************************************************************
-** Function name:		init_timer
+** Function name:		update_timer_interval
 **
-** Descriptions:		Inits Timer
+** Descriptions:		Change a match value without stopping the timer.
+**						A running timer keeps its current period: the new
+**						value is written by the interrupt handler right after
+**						the next match of that register, when TC has just
+**						been reset, so no period is shortened or skipped.
+**						A stopped timer, or a match without interrupt, is
+**						updated immediately.
 **
-** parameters:
-** Returned value:	
+** parameters:			timer number, match register, new match value
+** Returned value:		0 on success, 1 on invalid timer or match register
 **
 ******************************************************************************/
-uint32_t init_timer ( uint8_t timer_id, uint32_t Prescaler, uint8_t MatchReg, uint8_t SRImatchReg, uint32_t TimerInterval )
+uint32_t update_timer_interval ( uint8_t timer_id, uint8_t MatchReg, uint32_t TimerInterval )
 {
-	if ( timer_id == 0 )
+	LPC_TIM_TypeDef* timer;
+	uint32_t primask;
+
+	if ( (timer_id >= TIMER_NUM) || (MatchReg >= TIMER_MATCH_NUM) )
 	{
-		LPC_TIM0-> PR = Prescaler;
-		
-		if (MatchReg == 0){
-			LPC_TIM0->MR0 = TimerInterval;
-			LPC_TIM0->MCR |= SRImatchReg << 3*MatchReg;			
-		}
-		else if (MatchReg == 1){
-			LPC_TIM0->MR1 = TimerInterval;
-			LPC_TIM0->MCR |= SRImatchReg << 3*MatchReg;			
-		}
-		else if (MatchReg == 2){
-			LPC_TIM0->MR2 = TimerInterval;
-			LPC_TIM0->MCR |= SRImatchReg << 3*MatchReg;	
-		}
-		else if (MatchReg == 3){
-			LPC_TIM0->MR3 = TimerInterval;
-			LPC_TIM0->MCR |= SRImatchReg << 3*MatchReg;	
-		}
-		NVIC_EnableIRQ(TIMER0_IRQn);
-		NVIC_SetPriority(TIMER0_IRQn, 4);	//Priority TIMER0
-		return (0);
+		return (1);
+	}
+
+	timer = TIMER_REGS[timer_id];
+
+	primask = __get_PRIMASK();
+	__disable_irq();
+	if ( ((timer->TCR & 1) == 0) || ((timer->MCR & (TIMER_MATCH_INTERRUPT << (3 * MatchReg))) == 0) )
+	{
+		*TIMER_MATCH_REG(timer, MatchReg) = TimerInterval;
+		pendingMask[timer_id] &= ~(1 << MatchReg);
 	}
-	else if ( timer_id == 1 )
+	else
 	{
-		LPC_TIM1-> PR = Prescaler;
-		
-		if (MatchReg == 0){
-			LPC_TIM1->MR0 = TimerInterval;
-			LPC_TIM1->MCR |= SRImatchReg << 3*MatchReg;			
-		}
-		else if (MatchReg == 1){
-			LPC_TIM1->MR1 = TimerInterval;
-			LPC_TIM1->MCR |= SRImatchReg << 3*MatchReg;			
-		}
-		else if (MatchReg == 2){
-			LPC_TIM1->MR2 = TimerInterval;
-			LPC_TIM1->MCR |= SRImatchReg << 3*MatchReg;	
-		}
-		else if (MatchReg == 3){
-			LPC_TIM1->MR3 = TimerInterval;
-			LPC_TIM1->MCR |= SRImatchReg << 3*MatchReg;	
-		}		
-		NVIC_EnableIRQ(TIMER1_IRQn);
-		NVIC_SetPriority(TIMER1_IRQn, 5);	//Priority TIMER1
-		return (0);
+		pendingInterval[timer_id][MatchReg] = TimerInterval;
+		pendingMask[timer_id] |= (1 << MatchReg);
 	}
-	else if ( timer_id == 2 )
+	__set_PRIMASK(primask);
+
+	return (0);
+}
+
+/******************************************************************************
+** Function name:		timer_apply_pending_intervals
+**
+** Descriptions:		Write the match values latched by update_timer_interval
+**						for every match register flagged in IR. Called by the
+**						timer interrupt handlers before the flags are cleared.
+**
+** parameters:			timer number
+** Returned value:		None
+**
+******************************************************************************/
+void timer_apply_pending_intervals ( uint8_t timer_id )
+{
+	LPC_TIM_TypeDef* timer = TIMER_REGS[timer_id];
+	uint8_t ready = pendingMask[timer_id] & (timer->IR & 0x0F);
+	uint8_t MatchReg;
+
+	if ( ready == 0 )
 	{
-		LPC_TIM2-> PR = Prescaler;
-		
-		if (MatchReg == 0){
-			LPC_TIM2->MR0 = TimerInterval;
-			LPC_TIM2->MCR |= SRImatchReg << 3*MatchReg;			
-		}
-		else if (MatchReg == 1){
-			LPC_TIM2->MR1 = TimerInterval;
-			LPC_TIM2->MCR |= SRImatchReg << 3*MatchReg;			
-		}
-		else if (MatchReg == 2){
-			LPC_TIM2->MR2 = TimerInterval;
-			LPC_TIM2->MCR |= SRImatchReg << 3*MatchReg;	
-		}
-		else if (MatchReg == 3){
-			LPC_TIM2->MR3 = TimerInterval;
-			LPC_TIM2->MCR |= SRImatchReg << 3*MatchReg;	
-		}		
-		NVIC_EnableIRQ(TIMER2_IRQn);
-		NVIC_SetPriority(TIMER2_IRQn, 6);	//Priority TIMER2
-		return (0);
+		return;
 	}
-	else if ( timer_id == 3 )
+
+	for ( MatchReg = 0; MatchReg < TIMER_MATCH_NUM; MatchReg++ )
 	{
-		LPC_TIM3-> PR = Prescaler;
-		
-		if (MatchReg == 0){
-			LPC_TIM3->MR0 = TimerInterval;
-			LPC_TIM3->MCR |= SRImatchReg << 3*MatchReg;			
-		}
-		else if (MatchReg == 1){
-			LPC_TIM3->MR1 = TimerInterval;
-			LPC_TIM3->MCR |= SRImatchReg << 3*MatchReg;			
-		}
-		else if (MatchReg == 2){
-			LPC_TIM3->MR2 = TimerInterval;
-			LPC_TIM3->MCR |= SRImatchReg << 3*MatchReg;	
+		if ( ready & (1 << MatchReg) )
+		{
+			*TIMER_MATCH_REG(timer, MatchReg) = pendingInterval[timer_id][MatchReg];
 		}
-		else if (MatchReg == 3){
-			LPC_TIM3->MR3 = TimerInterval;
-			LPC_TIM3->MCR |= SRImatchReg << 3*MatchReg;	
-		}		
-		NVIC_EnableIRQ(TIMER3_IRQn);
-		NVIC_SetPriority(TIMER3_IRQn, 6);	//Priority TIMER3
-		return (0);
 	}
-	
-	return (1);
+	pendingMask[timer_id] &= ~ready;
 }
 
-
-
 /******************************************************************************
 **                            End Of File
-******************************************************************************/
\ No newline at end of file
+******************************************************************************/
@@ -12,8 +12,25 @@
 
 #include "LPC17xx.h"
 
+#define TIMER_NUM				4			/* TIMER0..TIMER3 */
+#define TIMER_MATCH_NUM			4			/* MR0..MR3 */
+#define TIMER_PCLK_HZ			25000000	/* Timer peripheral clock (CCLK / 4) */
+
+/* Registers of a timer, for a timer_id known at compile time (no table lookup) */
+#define TIMER_PERIPHERAL(timer_id)	((timer_id) == 0 ? LPC_TIM0 : (timer_id) == 1 ? LPC_TIM1 : (timer_id) == 2 ? LPC_TIM2 : LPC_TIM3)
+
+/* MCR action bits of a match register (SRImatchReg argument) */
+#define TIMER_MATCH_INTERRUPT	0x01		/* Interrupt on match */
+#define TIMER_MATCH_RESET		0x02		/* Reset TC on match */
+#define TIMER_MATCH_STOP		0x04		/* Stop TC on match (one-shot) */
+#define TIMER_MATCH_ACTIONS		0x07
+
 /* init_timer.c */
 extern uint32_t init_timer( uint8_t timer_id, uint32_t Prescaler, uint8_t MatchReg, uint8_t SRImatchReg, uint32_t TimerInterval );
+extern uint32_t init_timer_us( uint8_t timer_id, uint8_t MatchReg, uint8_t SRImatchReg, uint32_t PeriodUs );
+extern void timer_period_from_us( uint32_t PeriodUs, uint32_t* Prescaler, uint32_t* TimerInterval );
+extern uint32_t update_timer_interval( uint8_t timer_id, uint8_t MatchReg, uint32_t TimerInterval );
+extern void timer_apply_pending_intervals( uint8_t timer_id );
 extern void enable_timer( uint8_t timer_id );
 extern void disable_timer( uint8_t timer_id );
 extern void reset_timer( uint8_t timer_id );